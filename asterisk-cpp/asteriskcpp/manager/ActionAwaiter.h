@@ -0,0 +1,90 @@
+/*
+ * ActionAwaiter.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ACTIONAWAITER_H_
+#define ACTIONAWAITER_H_
+
+#include "asteriskcpp/manager/ActionFuture.h"
+
+/*
+ * The library itself is built as C++0x, the awaiter is only available to
+ * code built with coroutine support.
+ */
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <coroutine>
+#include <functional>
+
+namespace asteriskcpp {
+
+    /**
+     * Makes an ActionFuture awaitable from a C++20 coroutine:
+     * <pre>
+     * ActionFuture done = co_await connection.sendAction(new GetVarAction(channel, "X"));
+     * std::string value = done.get()->getProperty("Value");
+     * </pre>
+     * The coroutine is resumed when the response arrives or the action
+     * times out, by the executor if one was given (see resumeOn), otherwise
+     * directly on the response dispatch thread, in which case it should
+     * not block. The result is the completed future, which keeps the
+     * response alive.
+     */
+    class ActionAwaiter {
+    public:
+        /**
+         * Runs the function it is given, on whatever thread it chooses.
+         */
+        typedef std::function<void(const std::function<void()>&)> executor_t;
+
+        ActionAwaiter(const ActionFuture& future, const executor_t& executor = executor_t()) :
+        future(future), executor(executor) {
+        }
+
+        bool await_ready() const {
+            return (future.isReady());
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            // the continuation may resume, and destroy, the coroutine frame
+            // before then returns: no member is used afterwards
+            ActionFuture pending(future);
+            executor_t resumeExecutor(executor);
+            pending.then([handle, resumeExecutor](ManagerResponse*) {
+                if (resumeExecutor) {
+                    resumeExecutor([handle]() {
+                        handle.resume();
+                    });
+                } else {
+                    handle.resume();
+                }
+            });
+        }
+
+        ActionFuture await_resume() const {
+            return (future);
+        }
+
+    private:
+        ActionFuture future;
+        executor_t executor;
+    };
+
+    inline ActionAwaiter operator co_await(const ActionFuture& future) {
+        return (ActionAwaiter(future));
+    }
+
+    /**
+     * Awaits future and resumes the coroutine through executor.
+     */
+    inline ActionAwaiter resumeOn(const ActionFuture& future, const ActionAwaiter::executor_t& executor) {
+        return (ActionAwaiter(future, executor));
+    }
+
+}
+
+#endif /* __cpp_impl_coroutine */
+
+#endif /* ACTIONAWAITER_H_ */
@@ -0,0 +1,76 @@
+/*
+ * ActionBatch.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ACTIONBATCH_H_
+#define ACTIONBATCH_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "asteriskcpp/manager/ManagerResponsesHandler.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Completion of the actions given together to
+     * ManagerConnection::sendActions.<p>
+     * An action is completed when its response arrives, when it times out or
+     * when the connection drops it; timeouts and dropped actions count as
+     * failed, as the responses of type Error.
+     */
+    class ActionBatch {
+    public:
+        ActionBatch(size_t size);
+        virtual ~ActionBatch();
+
+        size_t size() const;
+        size_t getCompleted() const;
+        size_t getFailed() const;
+        bool isDone() const;
+
+        /**
+         * Waits until every action is completed.
+         */
+        void wait();
+
+        /**
+         * Waits at most timeout milliseconds.
+         * @return true if every action is completed.
+         */
+        bool wait(unsigned int timeout);
+
+    private:
+        friend class BatchResponseCallBack;
+
+        const size_t total;
+        size_t completed;
+        size_t failed;
+        mutable boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+
+        void complete(bool success);
+    };
+
+    typedef boost::shared_ptr<ActionBatch> ActionBatchPtr;
+
+    /**
+     * Response callback of one action of a batch, calls the batch callback
+     * function (if any) with the response and then completes the action.
+     */
+    class BatchResponseCallBack : public ASyncResponseCallBack {
+    public:
+        BatchResponseCallBack(ManagerAction* a, unsigned int tout, const responseCallbackFunction_t& f, const ActionBatchPtr& batch);
+        virtual ~BatchResponseCallBack();
+        virtual void fireCallBack(ManagerResponse* mr);
+
+    private:
+        ActionBatchPtr batch;
+        bool fired;
+    };
+
+}
+
+#endif /* ACTIONBATCH_H_ */
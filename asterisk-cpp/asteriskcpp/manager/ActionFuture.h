@@ -0,0 +1,108 @@
+/*
+ * ActionFuture.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef ACTIONFUTURE_H_
+#define ACTIONFUTURE_H_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "asteriskcpp/manager/ManagerResponsesHandler.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Mutex and condition shared by every future of a connection, waiting
+     * threads need no synchronization object of their own. They are all
+     * woken when any action of the connection completes and go back to
+     * wait if theirs did not.
+     */
+    class ActionCompletion {
+    public:
+        boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+    };
+
+    typedef boost::shared_ptr<ActionCompletion> ActionCompletionPtr;
+
+    /**
+     * Response to come of an action sent by ManagerConnection::sendAction.<p>
+     * Copies share the same response, which is deleted with the last of
+     * them. The response is NULL if the action was dropped without one, i.e.
+     * when the connection is closed.
+     */
+    class ActionFuture {
+    public:
+        ActionFuture();
+
+        /**
+         * false for a default constructed future, not bound to any action.
+         */
+        bool isValid() const;
+        bool isReady() const;
+
+        /**
+         * Waits for the response.
+         */
+        void wait() const;
+
+        /**
+         * Waits at most timeout milliseconds.
+         * @return true if the response arrived.
+         */
+        bool wait(unsigned int timeout) const;
+
+        /**
+         * Waits for the response, owned by the future.
+         */
+        ManagerResponse* get() const;
+
+        /**
+         * Calls continuation with the response: right away if it already
+         * arrived, from the response dispatch thread otherwise. The
+         * continuations of a future are called in the order they were added,
+         * before the threads already waiting are woken up.
+         */
+        const ActionFuture& then(const responseCallbackFunction_t& continuation) const;
+
+    private:
+        friend class ManagerConnection;
+        friend class FutureResponseCallBack;
+
+        class State;
+        boost::shared_ptr<State> state;
+
+        ActionFuture(const ActionCompletionPtr& completion);
+        void complete(ManagerResponse* mr) const;
+
+        /**
+         * Waits for the response and hands its ownership to the caller.
+         */
+        ManagerResponse* release() const;
+    };
+
+    /**
+     * Response callback completing an ActionFuture.
+     */
+    class FutureResponseCallBack : public ResponseCallBack {
+    public:
+        /**
+         * @param ownsAction true to delete the action with the callback.
+         */
+        FutureResponseCallBack(ManagerAction* a, unsigned int tout, const ActionFuture& future, bool ownsAction);
+        virtual ~FutureResponseCallBack();
+        virtual void fireCallBack(ManagerResponse* mr);
+
+    private:
+        ActionFuture future;
+        bool ownsAction;
+        bool fired;
+    };
+
+}
+
+#endif /* ACTIONFUTURE_H_ */
@@ -15,6 +15,7 @@
 #include "asteriskcpp/manager/actions/ChallengeAction.h"
 #include "asteriskcpp/manager/actions/CommandAction.h"
 #include "asteriskcpp/manager/actions/EventsAction.h"
+#include "asteriskcpp/manager/actions/FilterAction.h"
 #include "asteriskcpp/manager/actions/ListCommandsAction.h"
 #include "asteriskcpp/manager/actions/LoginAction.h"
 #include "asteriskcpp/manager/actions/LogoffAction.h"
@@ -0,0 +1,132 @@
+/*
+ * CommandStream.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef COMMANDSTREAM_H_
+#define COMMANDSTREAM_H_
+
+#include <deque>
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "asteriskcpp/manager/ManagerResponsesHandler.h"
+#include "asteriskcpp/structs/BufferSlab.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Output of a CommandAction handed over line by line as it arrives, see
+     * ManagerConnection::sendStreamingCommand.<p>
+     * The lines are taken from the "Response: Follows" output, or from the
+     * "Output:" lines of the servers replying with a plain response. The
+     * headers are not part of the output.
+     * <p/>
+     * With a capacity set, the stream fails when a line arrives while that
+     * many are not taken yet. The lines already there can still be taken,
+     * the next ones are dropped. The dispatch of the connection responses
+     * never waits for a stream.
+     */
+    class CommandStream {
+    public:
+        CommandStream();
+        virtual ~CommandStream();
+
+        /**
+         * Takes the next line, waiting for it.
+         * @return false once the output ended.
+         */
+        bool nextLine(std::string& line);
+
+        /**
+         * Same as nextLine, waiting at most timeout milliseconds.
+         * @return false on timeout as well, see isComplete.
+         */
+        bool nextLine(std::string& line, unsigned int timeout);
+
+        /**
+         * Waits at most timeout milliseconds for the end of the output.
+         * @return true if the output ended.
+         */
+        bool wait(unsigned int timeout);
+
+        /**
+         * Drops the lines not taken and those to come.
+         */
+        void cancel();
+
+        bool isComplete() const;
+
+        /**
+         * true if the whole output was received.
+         */
+        bool isSuccess() const;
+
+        /**
+         * Why the output ended early, i.e. the error message of the response.
+         */
+        std::string getMessage() const;
+
+        /**
+         * Lines received, taken or not.
+         */
+        size_t getReceived() const;
+
+        size_t getCapacity() const;
+
+        /**
+         * Sets the most lines waiting to be taken, 0 (the default) for no
+         * limit. Beyond, the stream fails with the message "Overflow".
+         */
+        void setCapacity(size_t capacity);
+
+    private:
+        friend class CommandStreamCallBack;
+
+        std::deque<std::string> lines;
+        std::string message;
+        size_t received;
+        size_t capacity;
+        // the first lines are the headers of the response
+        bool headers;
+        bool complete;
+        bool canceled;
+        mutable boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+
+        void append(const char* data, size_t length);
+        void addLine(const char* data, size_t length);
+        void finish();
+        void fail(const std::string& message);
+    };
+
+    typedef boost::shared_ptr<CommandStream> CommandStreamPtr;
+
+    /**
+     * Response callback of a streaming command. The parts of a Follows
+     * response are appended as they arrive, see
+     * Dispatcher::dispatchResponsePart; any other response ends the stream.
+     */
+    class CommandStreamCallBack : public ResponseCallBack {
+    public:
+        CommandStreamCallBack(ManagerAction* a, unsigned int tout, const CommandStreamPtr& stream);
+        virtual ~CommandStreamCallBack();
+        virtual void fireCallBack(ManagerResponse* mr);
+
+        void append(const SlabView& part);
+
+        /**
+         * The last part was appended.
+         */
+        void complete();
+
+    private:
+        CommandStreamPtr stream;
+        bool fired;
+    };
+
+}
+
+#endif /* COMMANDSTREAM_H_ */
@@ -12,8 +12,13 @@
 #include "responses/ManagerResponse.h"
 #include "AsteriskVersion.h"
 #include "../structs/Thread.h"
+#include "../structs/BufferSlab.h"
+#include "../structs/BlockingRingQueue.h"
 
-#include <queue>
+#include <set>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace asteriskcpp {
 
@@ -24,64 +29,170 @@ namespace asteriskcpp {
         }
 
         virtual void dispatchAsteriskVersion(AsteriskVersion* version) = 0;
-        virtual void dispatchResponse(const std::string& response) = 0;
-        virtual void dispatchEvent(const std::string& event) = 0;
+        virtual void dispatchResponse(const SlabView& response) = 0;
+
+        /**
+         * Receives the parts of a Follows response too big to be held in
+         * full, in order, the first one starting with its headers and the
+         * last one flagged last. An empty part means the response was cut
+         * short by a disconnection. The responses given to dispatchResponse
+         * meanwhile, made up by the connection, do not end it.
+         */
+        virtual void dispatchResponsePart(const SlabView& part, bool last) = 0;
+        virtual void dispatchEvent(const SlabView& event) = 0;
+
+        /**
+         * Called from the response dispatch thread when the Reader lost the
+         * connection, after the responses read before.
+         */
         virtual void notifyDisconnect() = 0;
     };
 
-    class MessageTable {
-    private:
-        std::queue<std::string> messageQueue;
-        boost::mutex mutex;
-        boost::condition_variable condition;
+    struct DispatchBarrier;
+
+    /**
+     * Frame waiting for a dispatch thread.
+     */
+    struct DispatchMessage {
+        Dispatcher* dispatcher;
+        SlabView frame;
+        // part of a response, see Dispatcher::dispatchResponsePart
+        bool partial;
+        bool last;
+        // the connection was lost, see Dispatcher::notifyDisconnect
+        bool hangup;
+        // set on the markers of DispatchGroup::detach, which have no frame
+        DispatchBarrier* barrier;
+
+        DispatchMessage() :
+        dispatcher(NULL), partial(false), last(false), hangup(false), barrier(NULL) {
+        }
 
+        DispatchMessage(Dispatcher* dispatcher, const SlabView& frame, bool partial = false, bool last = false) :
+        dispatcher(dispatcher), frame(frame), partial(partial), last(last), hangup(false), barrier(NULL) {
+        }
+    };
+
+    /**
+     * Messages waiting for a dispatch thread.<p>
+     * When it is full the Reader stops reading its socket until there is
+     * room: a slow listener slows down the socket reads instead of letting
+     * the backlog grow.
+     */
+    class MessageTable : public BlockingRingQueue<DispatchMessage> {
     public:
-        MessageTable() {}
-        ~MessageTable();
-        void put(std::string message);
-        std::string take();
+        MessageTable(size_t capacity = 8192);
+        virtual ~MessageTable();
     };
 
+    class DispatchGroup;
+
     class DispatchThread : public Thread {
     private:
-        boost::mutex m_mutex;
-        boost::condition_variable m_cond;
-
         MessageTable* messageTable;
+        std::vector<DispatchMessage> batch;
 
     public:
-        DispatchThread(MessageTable* mt, Dispatcher* f);
+        DispatchThread(MessageTable* mt, const DispatchGroup* g);
         virtual ~DispatchThread();
 
         virtual void stop();
         virtual void run();
 
+        /**
+         * Dispatches message unless its dispatcher was detached.
+         */
+        void dispatch(const DispatchMessage& message);
+
     protected:
-        Dispatcher* dispatcher;
-        virtual void fireDispatch(std::string message) = 0;
+        const DispatchGroup* group;
+        virtual void fireDispatch(const DispatchMessage& message) = 0;
     };
 
     class ResponseDispatchThread : public DispatchThread {
     public:
-        ResponseDispatchThread(MessageTable* mt, Dispatcher* f)
-            : DispatchThread(mt, f) {}
+        ResponseDispatchThread(MessageTable* mt, const DispatchGroup* g)
+            : DispatchThread(mt, g) {}
         virtual ~ResponseDispatchThread() {}
     protected:
-        virtual void fireDispatch(std::string message) {
-            this->dispatcher->dispatchResponse(message);
+        virtual void fireDispatch(const DispatchMessage& message) {
+            if (message.hangup) {
+                message.dispatcher->notifyDisconnect();
+            } else if (message.partial) {
+                message.dispatcher->dispatchResponsePart(message.frame, message.last);
+            } else {
+                message.dispatcher->dispatchResponse(message.frame);
+            }
         }
     };
 
     class EventDispatchThread : public DispatchThread {
     public:
-        EventDispatchThread(MessageTable* mt, Dispatcher* f)
-            : DispatchThread(mt, f) {}
+        EventDispatchThread(MessageTable* mt, const DispatchGroup* g)
+            : DispatchThread(mt, g) {}
         virtual ~EventDispatchThread() {}
     protected:
-        virtual void fireDispatch(std::string message) {
-            this->dispatcher->dispatchEvent(message);
+        virtual void fireDispatch(const DispatchMessage& message) {
+            message.dispatcher->dispatchEvent(message.frame);
         }
     };
+
+    /**
+     * The two dispatch threads, responses and events, with their queues.<p>
+     * Every connection has a group of its own unless it is given one shared
+     * with other connections, as ManagerCluster does: the messages of all of
+     * them are then dispatched by the same two threads, in the order they
+     * were read. A listener slow on one connection delays the others.
+     */
+    class DispatchGroup {
+    public:
+        DispatchGroup(size_t capacity = 8192);
+        virtual ~DispatchGroup();
+
+        /**
+         * Queues a message, waits while the queue is full. From the dispatch
+         * thread itself the message is then dispatched at once.
+         */
+        void putResponse(Dispatcher* d, const SlabView& frame, bool partial = false);
+        void putEvent(Dispatcher* d, const SlabView& frame);
+
+        /**
+         * Queues message unless the queue is full, onSpace is then called from
+         * the dispatch thread once there is room. Never waits.
+         */
+        bool tryPutResponse(const DispatchMessage& message, const MessageTable::SpaceCallback& onSpace);
+        bool tryPutEvent(const DispatchMessage& message, const MessageTable::SpaceCallback& onSpace);
+
+        /**
+         * Drops the messages of d not dispatched yet and waits for the one
+         * being dispatched, d is not called anymore once it returns.<p>
+         * From a dispatch thread of the group it does not wait, the other
+         * thread may still be dispatching a message of d when it returns.
+         */
+        void detach(Dispatcher* d);
+        bool isDetached(Dispatcher* d) const;
+
+    private:
+        MessageTable responseMessages;
+        MessageTable eventMessages;
+        DispatchThread* responseThread;
+        DispatchThread* eventThread;
+
+        std::multiset<Dispatcher*> detached;
+        boost::atomic<size_t> detachedCount;
+        mutable boost::mutex detachedMutex;
+
+        friend struct DispatchBarrier;
+
+        void put(MessageTable& messages, DispatchThread* thread, const DispatchMessage& message);
+        void putBarrier(MessageTable* messages, DispatchBarrier* barrier);
+        void attach(Dispatcher* d);
+
+        DispatchGroup(const DispatchGroup&);
+        DispatchGroup& operator=(const DispatchGroup&);
+    };
+
+    typedef boost::shared_ptr<DispatchGroup> DispatchGroupPtr;
 }
 
 #endif /* DISPATCHER_H_ */
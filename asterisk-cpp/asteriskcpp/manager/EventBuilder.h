@@ -8,58 +8,51 @@
 #ifndef EVENTBUILDER_H_
 #define EVENTBUILDER_H_
 
-#include <typeinfo>
 #include "asteriskcpp/manager/events/ManagerEvent.h"
-#include <boost/shared_ptr.hpp>
-#include "asteriskcpp/utils/LogHandler.h"
+#include "asteriskcpp/manager/EventPool.h"
 
 namespace asteriskcpp {
 
-    class EventFactory {
-    public:
-
-        virtual ~EventFactory() {
-        }
-        virtual ManagerEvent* create(const std::string& s) = 0;
-    };
-
-    template<class C>
-    class factory : public EventFactory {
-    public:
-
-        ManagerEvent* create(const std::string& s) {
-            return (new C(s));
-        }
-    };
-
-    typedef std::map<const std::string, boost::shared_ptr<EventFactory> > EnventFactoryMapType;
-
+    /**
+     * Builds the typed ManagerEvent of an event frame, the class is found in
+     * the EventRegistry.
+     */
     class EventBuilder {
     public:
         EventBuilder();
         virtual ~EventBuilder();
 
-        template<class C>
-        void RegisterClass() {
-            //LOG_TRACE_DATA("REGISTER EVENT CLASS " << C::getEventName());
-            C tmlEvent("");
-            eventFactoryMap.insert(std::make_pair(tmlEvent.getEventName(), boost::shared_ptr<EventFactory>(new factory<C>())));
-        }
-
-        template<class C>
-        void UnegisterClass() {
-            C tmpEvent("");
-            LOG_TRACE_STR("UNREGISTER EVENT CLASS " + tmpEvent.getEventName());
-            EnventFactoryMapType::iterator it = eventFactoryMap.find(tmpEvent.getEventName());
-            if (it != eventFactoryMap.end()) {
-                eventFactoryMap.erase(it);
-            }
-            eventFactoryMap.insert(std::make_pair(tmpEvent.getEventName(), new factory<C>()));
-        }
-
-        ManagerEvent* buildEvent(const std::string& eventStr);
+        ManagerEvent* buildEvent(const SlabView& frame);
+
+        /**
+         * Gives back an event returned by buildEvent once dispatched, it is
+         * recycled for the next events of its type.
+         */
+        void releaseEvent(ManagerEvent* event);
+
+        /**
+         * In lazy mode only the event name, and the Uniqueid when
+         * preloadUniqueId is set, are decoded when the event is built; the
+         * other properties are parsed on the first access.
+         */
+        void setLazy(bool lazy, bool preloadUniqueId = false);
+        bool isLazy() const;
+
+        /**
+         * Sets the name getServer returns for the events built, instead of
+         * their Server property. Empty for none, not to be changed while
+         * events are built.
+         */
+        void setServer(const std::string& server);
+        const std::string& getServer() const;
+
+        EventPool& getEventPool();
+        const EventPool& getEventPool() const;
     private:
-        EnventFactoryMapType eventFactoryMap;
+        bool lazy;
+        bool preloadUniqueId;
+        std::string server;
+        EventPool eventPool;
 
     };
 
@@ -0,0 +1,119 @@
+/*
+ * EventList.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EVENTLIST_H_
+#define EVENTLIST_H_
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include "asteriskcpp/manager/events/ManagerEvent.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Events sent in reply to a list action (SipPeersAction, StatusAction,
+     * QueueStatusAction...), see ManagerConnection::sendEventListAction.<p>
+     * The entries are handed over as they arrive, they are not given to the
+     * event listeners. The list ends with the Complete event, or with an
+     * error when the action fails or the connection is closed.
+     * <p/>
+     * With a capacity set, the list fails when an entry arrives while that
+     * many are not taken yet. The entries already there can still be taken,
+     * the next ones are dropped. The dispatch of the connection events never
+     * waits for a list.
+     */
+    class EventList {
+    public:
+        EventList();
+        virtual ~EventList();
+
+        /**
+         * Takes the next entry, waiting for it.
+         * @return the entry, owned by the caller, NULL once the list ended.
+         */
+        ManagerEvent* next();
+
+        /**
+         * Same as next, waiting at most timeout milliseconds.
+         * @return NULL on timeout as well, see isComplete.
+         */
+        ManagerEvent* next(unsigned int timeout);
+
+        /**
+         * Takes the entries until the end of the list.
+         * @return the entries, owned by the caller.
+         */
+        std::vector<ManagerEvent*> getAll();
+
+        /**
+         * Waits at most timeout milliseconds for the end of the list.
+         * @return true if the list ended.
+         */
+        bool wait(unsigned int timeout);
+
+        /**
+         * Drops the entries not taken and those to come.
+         */
+        void cancel();
+
+        bool isComplete() const;
+
+        /**
+         * true if the list ended with its Complete event.
+         */
+        bool isSuccess() const;
+
+        /**
+         * Why the list ended without its Complete event.
+         */
+        std::string getMessage() const;
+
+        /**
+         * The event that ended the list, owned by the list. NULL until then
+         * or if it ended with an error.
+         */
+        const ManagerEvent* getCompleteEvent() const;
+
+        /**
+         * Entries received, taken or not.
+         */
+        size_t getReceived() const;
+
+        size_t getCapacity() const;
+
+        /**
+         * Sets the most entries waiting to be taken, 0 (the default) for no
+         * limit. Beyond, the list fails with the message "Overflow".
+         */
+        void setCapacity(size_t capacity);
+
+    private:
+        friend class ManagerConnection;
+
+        std::deque<ManagerEvent*> entries;
+        ManagerEvent* completeEvent;
+        std::string message;
+        size_t received;
+        size_t capacity;
+        bool complete;
+        bool canceled;
+        mutable boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+
+        void add(ManagerEvent* event);
+        void finish(ManagerEvent* event);
+        void fail(const std::string& message);
+    };
+
+    typedef boost::shared_ptr<EventList> EventListPtr;
+
+}
+
+#endif /* EVENTLIST_H_ */
@@ -0,0 +1,59 @@
+/*
+ * EventPool.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EVENTPOOL_H_
+#define EVENTPOOL_H_
+
+#include "asteriskcpp/manager/events/ManagerEvent.h"
+#include <vector>
+#include <boost/thread/mutex.hpp>
+
+namespace asteriskcpp {
+
+    struct EventDescriptor;
+
+    /**
+     * Free lists of dispatched events, one per event type.<p>
+     * A released event is emptied but not destroyed: the next event of the
+     * same type reuses the object together with its field and value storage,
+     * so an event costs no allocation once the pool is warm.
+     */
+    class EventPool {
+    public:
+        EventPool(size_t maxPerType);
+        virtual ~EventPool();
+
+        /**
+         * Returns an empty event of the descriptor type, a plain ManagerEvent
+         * if descriptor is NULL.
+         */
+        ManagerEvent* acquire(const EventDescriptor* descriptor);
+
+        /**
+         * Gives event back, it is deleted when its free list is full.
+         */
+        void release(ManagerEvent* event);
+
+        size_t getMaxPerType() const;
+
+        /**
+         * Sets how many idle events of each type are kept, 0 disables the
+         * pool.
+         */
+        void setMaxPerType(size_t maxPerType);
+
+    private:
+        std::vector<ManagerEvent*> freeLists[EVENT_TYPE_COUNT];
+        size_t maxPerType;
+        boost::mutex poolMutex;
+
+        EventPool(const EventPool&);
+        EventPool& operator=(const EventPool&);
+    };
+
+}
+
+#endif /* EVENTPOOL_H_ */
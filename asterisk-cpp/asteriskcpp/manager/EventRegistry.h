@@ -0,0 +1,60 @@
+/*
+ * EventRegistry.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EVENTREGISTRY_H_
+#define EVENTREGISTRY_H_
+
+#include <string>
+#include <vector>
+#include "asteriskcpp/manager/EventTypes.h"
+#include "asteriskcpp/structs/PropertyMap.h"
+
+namespace asteriskcpp {
+
+    class ManagerEvent;
+
+    struct EventDescriptor {
+        EventType type;
+        PropertyKey name;
+        EventCategory category;
+        ManagerEvent* (*create)();
+    };
+
+    /**
+     * Static table of the events listed in EventTypes.h.<p>
+     * AMI names are looked up through a perfect hash (hash and displace): one
+     * hash of the name, one probe and one compare, whatever the number of
+     * events. The name hashes are computed at compile time, the displacement
+     * table once, the first time the registry is used.
+     */
+    class EventRegistry {
+    public:
+
+        /**
+         * Returns the event called name (case insensitive), NULL if unknown.
+         */
+        static const EventDescriptor* find(const char* name, size_t length);
+
+        static const EventDescriptor& get(EventType type);
+
+        static const std::string& getName(EventType type);
+
+    private:
+        std::vector<std::string> names;
+        std::vector<uint32_t> displacements;
+        std::vector<int> slots;
+        uint32_t bucketMask;
+        uint32_t slotMask;
+
+        EventRegistry();
+        static const EventRegistry& instance();
+        static const EventDescriptor* descriptors();
+        static uint32_t slotOf(uint32_t hash, uint32_t displacement);
+    };
+
+}
+
+#endif /* EVENTREGISTRY_H_ */
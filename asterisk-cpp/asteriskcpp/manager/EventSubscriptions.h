@@ -0,0 +1,103 @@
+/*
+ * EventSubscriptions.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EVENTSUBSCRIPTIONS_H_
+#define EVENTSUBSCRIPTIONS_H_
+
+#include "asteriskcpp/manager/ManagerEventListener.h"
+#include "asteriskcpp/manager/EventTypes.h"
+#include <map>
+#include <string>
+#include <vector>
+#include <boost/regex.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * What every event listener wants to receive: all events, or a list of
+     * event types, each optionally restricted to the events whose field key
+     * starts with a match of a regular expression.<p>
+     * From it the smallest EventsAction mask and the AMI filters asking the
+     * server for those events only are derived, see getEventMask and
+     * getFilters.<p>
+     * The subscriptions are compiled into an immutable snapshot replaced on
+     * every change, events are matched against it without locking.
+     */
+    class EventSubscriptions {
+        struct Subscription;
+        typedef std::map<const ManagerEventListener*, std::vector<Subscription> > subscriptionsMap_t;
+
+    public:
+        typedef boost::shared_ptr<const subscriptionsMap_t> Snapshot;
+
+        EventSubscriptions();
+        virtual ~EventSubscriptions();
+
+        /**
+         * listener receives every event.
+         */
+        void subscribeAll(const ManagerEventListener* listener);
+
+        /**
+         * Adds type to the events listener receives, if key is not empty only
+         * those whose key value matches pattern (a POSIX extended expression,
+         * anchored at the start of the value).
+         * @throw IllegalArgumentException if pattern is not a valid expression.
+         */
+        void subscribe(const ManagerEventListener* listener, EventType type, const std::string& key = "", const std::string& pattern = "");
+
+        void unsubscribe(const ManagerEventListener* listener);
+
+        bool accepts(const ManagerEventListener* listener, const ManagerEvent& event) const;
+
+        /**
+         * Returns the current subscriptions, to match an event for every
+         * listener against the same snapshot.
+         */
+        Snapshot getSnapshot() const;
+        static bool accepts(const Snapshot& snapshot, const ManagerEventListener* listener, const ManagerEvent& event);
+
+        /**
+         * Returns the EventsAction mask enabling every subscribed event:
+         * "on", "off" or the list of the categories required.
+         */
+        std::string getEventMask() const;
+
+        /**
+         * Returns the AMI filters letting through the subscribed events only,
+         * empty when some listener wants every event.
+         */
+        std::vector<std::string> getFilters() const;
+
+        /**
+         * Returns the EventsAction names of categories, comma separated.
+         */
+        static std::string getCategoryNames(int categories);
+
+    private:
+
+        struct Subscription {
+            EventType type;
+            std::string key;
+            std::string pattern;
+            boost::regex expression;
+        };
+
+        // an empty list subscribes to every event
+        Snapshot subscriptions;
+        // serializes the changes, the readers do not take it
+        mutable boost::mutex subscriptionsMutex;
+
+        boost::shared_ptr<subscriptionsMap_t> copy() const;
+
+        static std::string caseless(const std::string& text);
+    };
+
+}
+
+#endif /* EVENTSUBSCRIPTIONS_H_ */
@@ -0,0 +1,185 @@
+/*
+ * EventTypes.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef EVENTTYPES_H_
+#define EVENTTYPES_H_
+
+/**
+ * Every event known to the library: EVENT_TYPE(id, class, name, category).<p>
+ * name is the AMI "Event:" value, matched case insensitively, and category
+ * the class of the manager.conf read permission that enables it.
+ * CATEGORY_NONE events are action results, sent whatever the event mask.
+ * To support a new event add its class here and its header to Events.hpp.
+ */
+#define ASTERISKCPP_EVENT_TYPES(EVENT_TYPE) \
+    EVENT_TYPE(AGENTCALLBACKLOGIN, AgentCallbackLoginEvent, "AgentCallbackLogin", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTCALLBACKLOGOFF, AgentCallbackLogoffEvent, "AgentCallbackLogoff", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTCALLED, AgentCalledEvent, "AgentCalled", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTCOMPLETE, AgentCompleteEvent, "AgentComplete", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTCONNECT, AgentConnectEvent, "AgentConnect", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTDUMP, AgentDumpEvent, "AgentDump", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTLOGIN, AgentLoginEvent, "AgentLogin", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTLOGOFF, AgentLogoffEvent, "AgentLogoff", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTRINGNOANSWER, AgentRingNoAnswer, "AgentRingNoAnswer", CATEGORY_AGENT) \
+    EVENT_TYPE(AGENTSCOMPLETE, AgentsCompleteEvent, "AgentsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(AGENTS, AgentsEvent, "Agents", CATEGORY_NONE) \
+    EVENT_TYPE(AGIEXEC, AgiExecEvent, "AgiExec", CATEGORY_AGI) \
+    EVENT_TYPE(ALARMCLEAR, AlarmClearEvent, "AlarmClear", CATEGORY_SYSTEM) \
+    EVENT_TYPE(ALARM, AlarmEvent, "Alarm", CATEGORY_SYSTEM) \
+    EVENT_TYPE(ASYNCAGI, AsyncAgiEvent, "AsyncAgi", CATEGORY_AGI) \
+    EVENT_TYPE(BRIDGE, BridgeEvent, "Bridge", CATEGORY_CALL) \
+    EVENT_TYPE(BRIDGEEXEC, BridgeExecEvent, "BridgeExec", CATEGORY_CALL) \
+    EVENT_TYPE(CDR, CdrEvent, "Cdr", CATEGORY_CDR) \
+    EVENT_TYPE(CHANNELRELOAD, ChannelReloadEvent, "ChannelReload", CATEGORY_SYSTEM) \
+    EVENT_TYPE(CHANNELUPDATE, ChannelUpdateEvent, "ChannelUpdate", CATEGORY_SYSTEM) \
+    EVENT_TYPE(CONFBRIDGEEND, ConfbridgeEndEvent, "ConfbridgeEnd", CATEGORY_CALL) \
+    EVENT_TYPE(CONFBRIDGEJOIN, ConfbridgeJoinEvent, "ConfbridgeJoin", CATEGORY_CALL) \
+    EVENT_TYPE(CONFBRIDGELEAVE, ConfbridgeLeaveEvent, "ConfbridgeLeave", CATEGORY_CALL) \
+    EVENT_TYPE(CONFBRIDGELISTCOMPLETE, ConfbridgeListCompleteEvent, "ConfbridgeListComplete", CATEGORY_NONE) \
+    EVENT_TYPE(CONFBRIDGELIST, ConfbridgeListEvent, "ConfbridgeList", CATEGORY_NONE) \
+    EVENT_TYPE(CONFBRIDGELISTROOMSCOMPLETE, ConfbridgeListRoomsCompleteEvent, "ConfbridgeListRoomsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(CONFBRIDGELISTROOMS, ConfbridgeListRoomsEvent, "ConfbridgeListRooms", CATEGORY_NONE) \
+    EVENT_TYPE(CONFBRIDGESTART, ConfbridgeStartEvent, "ConfbridgeStart", CATEGORY_CALL) \
+    EVENT_TYPE(CONFBRIDGETALKING, ConfbridgeTalkingEvent, "ConfbridgeTalking", CATEGORY_CALL) \
+    EVENT_TYPE(CONNECT, ConnectEvent, "Connect", CATEGORY_NONE) \
+    EVENT_TYPE(CORESHOWCHANNEL, CoreShowChannelEvent, "CoreShowChannel", CATEGORY_NONE) \
+    EVENT_TYPE(CORESHOWCHANNELSCOMPLETE, CoreShowChannelsCompleteEvent, "CoreShowChannelsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(DAHDISHOWCHANNELSCOMPLETE, DahdiShowChannelsCompleteEvent, "DahdiShowChannelsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(DAHDISHOWCHANNELS, DahdiShowChannelsEvent, "DahdiShowChannels", CATEGORY_NONE) \
+    EVENT_TYPE(DBGETRESPONSE, DbGetResponseEvent, "DbGetResponse", CATEGORY_NONE) \
+    EVENT_TYPE(DIAL, DialEvent, "Dial", CATEGORY_CALL) \
+    EVENT_TYPE(DISCONNECT, DisconnectEvent, "Disconnect", CATEGORY_NONE) \
+    EVENT_TYPE(DNDSTATE, DndStateEvent, "DndState", CATEGORY_SYSTEM) \
+    EVENT_TYPE(DTMF, DtmfEvent, "Dtmf", CATEGORY_DTMF) \
+    EVENT_TYPE(EXTENSIONSTATUS, ExtensionStatusEvent, "ExtensionStatus", CATEGORY_CALL) \
+    EVENT_TYPE(FAXDOCUMENTSTATUS, FaxDocumentStatusEvent, "FaxDocumentStatus", CATEGORY_CALL) \
+    EVENT_TYPE(FAXRECEIVED, FaxReceivedEvent, "FaxReceived", CATEGORY_CALL) \
+    EVENT_TYPE(FAXSTATUS, FaxStatusEvent, "FaxStatus", CATEGORY_CALL) \
+    EVENT_TYPE(FULLYBOOTED, FullyBootedEvent, "FullyBooted", CATEGORY_SYSTEM) \
+    EVENT_TYPE(HANGUP, HangupEvent, "Hangup", CATEGORY_CALL) \
+    EVENT_TYPE(HOLD, HoldEvent, "Hold", CATEGORY_CALL) \
+    EVENT_TYPE(HOLDEDCALL, HoldedCallEvent, "HoldedCall", CATEGORY_CALL) \
+    EVENT_TYPE(JABBEREVENT, JabberEventEvent, "JabberEvent", CATEGORY_SYSTEM) \
+    EVENT_TYPE(JITTERBUFSTATS, JitterBufStatsEvent, "JitterBufStats", CATEGORY_REPORTING) \
+    EVENT_TYPE(JOIN, JoinEvent, "Join", CATEGORY_CALL) \
+    EVENT_TYPE(LEAVE, LeaveEvent, "Leave", CATEGORY_CALL) \
+    EVENT_TYPE(LINK, LinkEvent, "Link", CATEGORY_CALL) \
+    EVENT_TYPE(LISTDIALPLAN, ListDialplanEvent, "ListDialplan", CATEGORY_NONE) \
+    EVENT_TYPE(LOGCHANNEL, LogChannelEvent, "LogChannel", CATEGORY_SYSTEM) \
+    EVENT_TYPE(MASQUERADE, MasqueradeEvent, "Masquerade", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMEEND, MeetMeEndEvent, "MeetMeEnd", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMEJOIN, MeetMeJoinEvent, "MeetMeJoin", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMELEAVE, MeetMeLeaveEvent, "MeetMeLeave", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMEMUTE, MeetMeMuteEvent, "MeetMeMute", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMETALKING, MeetMeTalkingEvent, "MeetMeTalking", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMESTOPTALKING, MeetMeStopTalkingEvent, "MeetMeStopTalking", CATEGORY_CALL) \
+    EVENT_TYPE(MEETMETALKINGREQUEST, MeetMeTalkingRequestEvent, "MeetMeTalkingRequest", CATEGORY_CALL) \
+    EVENT_TYPE(MESSAGEWAITING, MessageWaitingEvent, "MessageWaiting", CATEGORY_CALL) \
+    EVENT_TYPE(MODULELOADREPORT, ModuleLoadReportEvent, "ModuleLoadReport", CATEGORY_SYSTEM) \
+    EVENT_TYPE(MONITORSTART, MonitorStartEvent, "MonitorStart", CATEGORY_CALL) \
+    EVENT_TYPE(MONITORSTOP, MonitorStopEvent, "MonitorStop", CATEGORY_CALL) \
+    EVENT_TYPE(MUSICONHOLD, MusicOnHoldEvent, "MusicOnHold", CATEGORY_CALL) \
+    EVENT_TYPE(NEWACCOUNTCODE, NewAccountCodeEvent, "NewAccountCode", CATEGORY_CALL) \
+    EVENT_TYPE(NEWCALLERID, NewCallerIdEvent, "NewCallerId", CATEGORY_CALL) \
+    EVENT_TYPE(NEWCHANNEL, NewChannelEvent, "NewChannel", CATEGORY_CALL) \
+    EVENT_TYPE(NEWEXTEN, NewExtenEvent, "NewExten", CATEGORY_DIALPLAN) \
+    EVENT_TYPE(NEWSTATE, NewStateEvent, "NewState", CATEGORY_CALL) \
+    EVENT_TYPE(ORIGINATEFAILURE, OriginateFailureEvent, "OriginateFailure", CATEGORY_CALL) \
+    EVENT_TYPE(ORIGINATERESPONSE, OriginateResponseEvent, "OriginateResponse", CATEGORY_CALL) \
+    EVENT_TYPE(ORIGINATESUCCESS, OriginateSuccessEvent, "OriginateSuccess", CATEGORY_CALL) \
+    EVENT_TYPE(PARKEDCALL, ParkedCallEvent, "ParkedCall", CATEGORY_CALL) \
+    EVENT_TYPE(PARKEDCALLGIVEUP, ParkedCallGiveUpEvent, "ParkedCallGiveUp", CATEGORY_CALL) \
+    EVENT_TYPE(PARKEDCALLTIMEOUT, ParkedCallTimeOutEvent, "ParkedCallTimeOut", CATEGORY_CALL) \
+    EVENT_TYPE(PARKEDCALLSCOMPLETE, ParkedCallsCompleteEvent, "ParkedCallsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(PEERENTRY, PeerEntryEvent, "PeerEntry", CATEGORY_NONE) \
+    EVENT_TYPE(PEERSTATUS, PeerStatusEvent, "PeerStatus", CATEGORY_SYSTEM) \
+    EVENT_TYPE(PEERLISTCOMPLETE, PeerlistCompleteEvent, "PeerlistComplete", CATEGORY_NONE) \
+    EVENT_TYPE(PRIEVENT, PriEventEvent, "PriEvent", CATEGORY_CALL) \
+    EVENT_TYPE(PROTOCOLIDENTIFIERRECEIVED, ProtocolIdentifierReceivedEvent, "ProtocolIdentifierReceived", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUECALLERABANDON, QueueCallerAbandonEvent, "QueueCallerAbandon", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEENTRY, QueueEntryEvent, "QueueEntry", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUE, QueueEvent, "Queue", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUEMEMBERADDED, QueueMemberAddedEvent, "QueueMemberAdded", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEMEMBER, QueueMemberEvent, "QueueMember", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUEMEMBERPAUSED, QueueMemberPausedEvent, "QueueMemberPaused", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEMEMBERPENALTY, QueueMemberPenaltyEvent, "QueueMemberPenalty", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEMEMBERREMOVED, QueueMemberRemovedEvent, "QueueMemberRemoved", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEMEMBERSTATUS, QueueMemberStatusEvent, "QueueMemberStatus", CATEGORY_AGENT) \
+    EVENT_TYPE(QUEUEPARAMS, QueueParamsEvent, "QueueParams", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUESTATUSCOMPLETE, QueueStatusCompleteEvent, "QueueStatusComplete", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUESUMMARYCOMPLETE, QueueSummaryCompleteEvent, "QueueSummaryComplete", CATEGORY_NONE) \
+    EVENT_TYPE(QUEUESUMMARY, QueueSummaryEvent, "QueueSummary", CATEGORY_NONE) \
+    EVENT_TYPE(RECEIVEFAX, ReceiveFaxEvent, "ReceiveFax", CATEGORY_CALL) \
+    EVENT_TYPE(REGISTRATIONSCOMPLETE, RegistrationsCompleteEvent, "RegistrationsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(REGISTRYENTRY, RegistryEntryEvent, "RegistryEntry", CATEGORY_NONE) \
+    EVENT_TYPE(REGISTRY, RegistryEvent, "Registry", CATEGORY_SYSTEM) \
+    EVENT_TYPE(RELOAD, ReloadEvent, "Reload", CATEGORY_SYSTEM) \
+    EVENT_TYPE(RENAME, RenameEvent, "Rename", CATEGORY_CALL) \
+    EVENT_TYPE(RTCPRECEIVED, RtcpReceivedEvent, "RtcpReceived", CATEGORY_REPORTING) \
+    EVENT_TYPE(RTCPSENT, RtcpSentEvent, "RtcpSent", CATEGORY_REPORTING) \
+    EVENT_TYPE(RTPRECEIVERSTAT, RtpReceiverStatEvent, "RtpReceiverStat", CATEGORY_REPORTING) \
+    EVENT_TYPE(RTPSENDERSTAT, RtpSenderStatEvent, "RtpSenderStat", CATEGORY_REPORTING) \
+    EVENT_TYPE(SENDFAX, SendFaxEvent, "SendFax", CATEGORY_CALL) \
+    EVENT_TYPE(SENDFAXSTATUS, SendFaxStatusEvent, "SendFaxStatus", CATEGORY_CALL) \
+    EVENT_TYPE(SHOWDIALPLANCOMPLETE, ShowDialplanCompleteEvent, "ShowDialplanComplete", CATEGORY_NONE) \
+    EVENT_TYPE(SHUTDOWN, ShutdownEvent, "Shutdown", CATEGORY_SYSTEM) \
+    EVENT_TYPE(SKYPEACCOUNTSTATUS, SkypeAccountStatusEvent, "SkypeAccountStatus", CATEGORY_SYSTEM) \
+    EVENT_TYPE(SKYPEBUDDYENTRY, SkypeBuddyEntryEvent, "SkypeBuddyEntry", CATEGORY_NONE) \
+    EVENT_TYPE(SKYPEBUDDYLISTCOMPLETE, SkypeBuddyListCompleteEvent, "SkypeBuddyListComplete", CATEGORY_NONE) \
+    EVENT_TYPE(SKYPEBUDDYSTATUS, SkypeBuddyStatusEvent, "SkypeBuddyStatus", CATEGORY_SYSTEM) \
+    EVENT_TYPE(SKYPECHATMESSAGE, SkypeChatMessageEvent, "SkypeChatMessage", CATEGORY_SYSTEM) \
+    EVENT_TYPE(SKYPELICENSE, SkypeLicenseEvent, "SkypeLicense", CATEGORY_NONE) \
+    EVENT_TYPE(SKYPELICENSELISTCOMPLETE, SkypeLicenseListCompleteEvent, "SkypeLicenseListComplete", CATEGORY_NONE) \
+    EVENT_TYPE(STATUSCOMPLETE, StatusCompleteEvent, "StatusComplete", CATEGORY_NONE) \
+    EVENT_TYPE(STATUS, StatusEvent, "Status", CATEGORY_NONE) \
+    EVENT_TYPE(T38FAXSTATUS, T38FaxStatusEvent, "T38FaxStatus", CATEGORY_CALL) \
+    EVENT_TYPE(TRANSFER, TransferEvent, "Transfer", CATEGORY_CALL) \
+    EVENT_TYPE(UNHOLD, UnholdEvent, "Unhold", CATEGORY_CALL) \
+    EVENT_TYPE(UNLINK, UnlinkEvent, "Unlink", CATEGORY_CALL) \
+    EVENT_TYPE(UNPARKEDCALL, UnparkedCallEvent, "UnparkedCall", CATEGORY_CALL) \
+    EVENT_TYPE(VARSET, VarSetEvent, "VarSet", CATEGORY_DIALPLAN) \
+    EVENT_TYPE(VOICEMAILUSERENTRYCOMPLETE, VoicemailUserEntryCompleteEvent, "VoicemailUserEntryComplete", CATEGORY_NONE) \
+    EVENT_TYPE(VOICEMAILUSERENTRY, VoicemailUserEntryEvent, "VoicemailUserEntry", CATEGORY_NONE) \
+    EVENT_TYPE(ZAPSHOWCHANNELSCOMPLETE, ZapShowChannelsCompleteEvent, "ZapShowChannelsComplete", CATEGORY_NONE) \
+    EVENT_TYPE(ZAPSHOWCHANNELS, ZapShowChannelsEvent, "ZapShowChannels", CATEGORY_NONE)
+
+namespace asteriskcpp {
+
+    /**
+     * AMI event classes, as set by an EventsAction mask.
+     */
+    enum EventCategory {
+        CATEGORY_NONE = 0,
+        CATEGORY_SYSTEM = 1 << 0,
+        CATEGORY_CALL = 1 << 1,
+        CATEGORY_LOG = 1 << 2,
+        CATEGORY_VERBOSE = 1 << 3,
+        CATEGORY_COMMAND = 1 << 4,
+        CATEGORY_AGENT = 1 << 5,
+        CATEGORY_USER = 1 << 6,
+        CATEGORY_CONFIG = 1 << 7,
+        CATEGORY_DTMF = 1 << 8,
+        CATEGORY_REPORTING = 1 << 9,
+        CATEGORY_CDR = 1 << 10,
+        CATEGORY_DIALPLAN = 1 << 11,
+        CATEGORY_ORIGINATE = 1 << 12,
+        CATEGORY_AGI = 1 << 13
+    };
+
+    /**
+     * Numeric type of a ManagerEvent, see ManagerEvent::getEventType.
+     */
+    enum EventType {
+        EVENT_UNKNOWN = 0,
+#define EVENT_TYPE_ENUM(id, cls, name, category) EVENT_##id,
+        ASTERISKCPP_EVENT_TYPES(EVENT_TYPE_ENUM)
+#undef EVENT_TYPE_ENUM
+        EVENT_TYPE_COUNT
+    };
+
+}
+
+#endif /* EVENTTYPES_H_ */
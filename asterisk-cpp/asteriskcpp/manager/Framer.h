@@ -0,0 +1,99 @@
+/*
+ * Framer.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef FRAMER_H_
+#define FRAMER_H_
+
+#include <vector>
+#include "asteriskcpp/structs/BufferSlab.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Cuts the raw AMI byte stream into protocol, response and event frames.<p>
+     * The socket reads straight into a ring of fixed size BufferSlab's
+     * (see writePtr/commit) and every complete frame is handed out as a
+     * SlabView, so no data is copied on the way to the dispatch threads.
+     * Delimiter search resumes where the previous one stopped, which keeps the
+     * cost linear for big "Response: Follows" outputs.
+     * <p/>
+     * A slab is only written again once every view on it has been released;
+     * frames bigger than a slab get a dedicated, bigger, slab. The exception
+     * are "Response: Follows" frames, handed out in parts of whole lines
+     * (FRAME_FOLLOWS_PART) once half a slab is pending: the output of a
+     * command is never held in full. The last part is a FRAME_FOLLOWS.
+     */
+    class Framer {
+    public:
+
+        enum FrameType {
+            FRAME_UNKNOWN = 0, FRAME_PROTOCOL = 1, FRAME_FOLLOWS = 2, FRAME_RESPONSE = 3, FRAME_EVENT = 4, FRAME_FOLLOWS_PART = 5
+        };
+
+        Framer(size_t slabSize = 65536, size_t ringSize = 8);
+        ~Framer();
+
+        /**
+         * Returns where the next socket read must store its data, at least
+         * getMinRead() bytes are available.
+         */
+        char* writePtr();
+
+        /**
+         * Returns how many bytes can be stored at writePtr().
+         */
+        size_t writeCapacity() const;
+
+        /**
+         * Marks length bytes stored at writePtr() as received.
+         */
+        void commit(size_t length);
+
+        /**
+         * Extracts the next complete frame, without the delimiter, or the
+         * next part of a Follows frame.
+         *
+         * @return false if more data is needed.
+         */
+        bool next(SlabView& frame, FrameType& type);
+
+        /**
+         * Drops any partial frame (i.e. after a reconnect).
+         */
+        void reset();
+
+        size_t getMinRead() const;
+
+        /**
+         * Returns the value of the first "name: value" line of frame, the
+         * name compared case insensitively, or an empty view. The lines are
+         * scanned in place, the body of a Follows frame is only reached if
+         * the header is missing.
+         */
+        static SlabView header(const SlabView& frame, const char* name);
+
+    private:
+        size_t slabSize;
+        std::vector<BufferSlabPtr> ring;
+        size_t ringPos;
+
+        BufferSlabPtr slab;
+        size_t begin;
+        size_t end;
+        size_t scan;
+        FrameType type;
+        const char* delimiter;
+        size_t delimiterLength;
+
+        void prepareWrite();
+        BufferSlabPtr acquireSlab(size_t minSize);
+        size_t search(const char* str, size_t length);
+        bool detectType();
+    };
+
+}
+
+#endif /* FRAMER_H_ */
@@ -0,0 +1,130 @@
+/*
+ * ManagerCluster.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef MANAGERCLUSTER_H_
+#define MANAGERCLUSTER_H_
+
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include <map>
+#include <string>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * Connections to several Asterisk servers, each one known by a key.<p>
+     * The connections share their dispatch threads (see DispatchGroup) on
+     * top of the IOReactor every connection shares: the listeners get the
+     * events of all the servers as one stream, in the order they were read,
+     * and ManagerEvent::getServer tells the key of the server each one comes
+     * from.
+     * <p/>
+     * Actions are sent to a server by its key, or to the server a channel is
+     * on. The channels are learnt from the NewChannel, Rename and Hangup
+     * events, or given with setChannelServer.
+     */
+    class ManagerCluster {
+    public:
+        ManagerCluster();
+        virtual ~ManagerCluster();
+
+        /**
+         * Adds a server, the returned connection can be configured further
+         * before connecting. The cluster owns it.
+         * @throws IllegalArgumentException if key is already used.
+         */
+        ManagerConnection& addServer(const std::string& key, const std::string& hostname, unsigned int port,
+                const std::string& username, const std::string& password);
+
+        /**
+         * Returns the connection of key, NULL if there is none.
+         */
+        ManagerConnection* getConnection(const std::string& key) const;
+        std::vector<std::string> getServers() const;
+
+        /**
+         * Connects and logs in every server not authenticated yet, all at
+         * once: it takes as long as the slowest server, at most the connect
+         * and login timeouts.
+         * @return the number of servers authenticated.
+         */
+        size_t connect(const std::string& eventMask = "ON");
+        void logoff();
+        void disconnect();
+
+        /**
+         * Sends action to the server of key, which takes ownership of it, see
+         * ManagerConnection::sendAction.
+         * @throws IllegalArgumentException if there is no such server, the
+         * action is deleted.
+         */
+        ActionFuture sendAction(const std::string& key, ManagerAction* action, const responseCallbackFunction_t& rcbf = responseCallbackFunction_t());
+
+        /**
+         * Sends action to the server channel is on.
+         * @throws IllegalArgumentException if the server of channel is not
+         * known, the action is deleted.
+         */
+        ActionFuture sendActionToChannel(const std::string& channel, ManagerAction* action, const responseCallbackFunction_t& rcbf = responseCallbackFunction_t());
+
+        /**
+         * Returns the key of the server channel is on, empty if unknown.
+         */
+        std::string getChannelServer(const std::string& channel) const;
+        void setChannelServer(const std::string& channel, const std::string& key);
+        void removeChannel(const std::string& channel);
+
+        /**
+         * Registers mel on every server, present or added later.
+         */
+        void addEventListener(const ManagerEventListener& mel);
+        void addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key = "", const std::string& pattern = "");
+        void removeEventListener(const ManagerEventListener& mel);
+
+    private:
+
+        /**
+         * Keeps the channels map, registered on each connection.
+         */
+        class ChannelTracker : public ManagerEventListener {
+        public:
+            ChannelTracker(ManagerCluster* cluster);
+            virtual void onManagerEvent(const ManagerEvent& me);
+        private:
+            ManagerCluster* cluster;
+        };
+
+        struct Subscription {
+            const ManagerEventListener* listener;
+            bool all;
+            EventType type;
+            std::string key;
+            std::string pattern;
+        };
+
+        typedef std::map<std::string, ManagerConnection*> connections_t;
+        typedef std::map<std::string, std::string> channels_t;
+
+        DispatchGroupPtr dispatchGroup;
+        ChannelTracker tracker;
+        connections_t connections;
+        std::vector<Subscription> subscriptions;
+        mutable boost::mutex connectionsMutex;
+        channels_t channels;
+        mutable boost::mutex channelsMutex;
+
+        ManagerCluster(const ManagerCluster&);
+        ManagerCluster& operator=(const ManagerCluster&);
+
+        void subscribe(ManagerConnection& connection, const Subscription& subscription);
+        static void connectServer(ManagerConnection* connection, const std::string& eventMask);
+        std::vector<ManagerConnection*> getConnections() const;
+    };
+
+}
+
+#endif /* MANAGERCLUSTER_H_ */
@@ -10,13 +10,26 @@
 
 #include "asteriskcpp/net/IPAddress.h"
 #include "asteriskcpp/net/TCPSocket.h"
+#include "asteriskcpp/net/SSLSocket.h"
 #include "asteriskcpp/manager/Reader.h"
+#include "asteriskcpp/manager/Writer.h"
 #include "asteriskcpp/manager/Dispatcher.h"
 #include "asteriskcpp/manager/ManagerEventsHandler.h"
 #include "asteriskcpp/manager/ManagerResponsesHandler.h"
 #include "asteriskcpp/manager/actions/ManagerAction.h"
 #include "asteriskcpp/manager/EventBuilder.h"
 #include "asteriskcpp/manager/ResponseBuilder.h"
+#include "asteriskcpp/manager/ActionBatch.h"
+#include "asteriskcpp/manager/ActionFuture.h"
+#include "asteriskcpp/manager/ActionAwaiter.h"
+#include "asteriskcpp/manager/EventList.h"
+#include "asteriskcpp/manager/CommandStream.h"
+#include "asteriskcpp/manager/Reconnector.h"
+#include "asteriskcpp/manager/actions/CommandAction.h"
+#include <map>
+#include <set>
+#include <boost/atomic.hpp>
+#include <boost/thread/mutex.hpp>
 
 namespace asteriskcpp {
 
@@ -41,41 +54,203 @@ namespace asteriskcpp {
         bool isConnected() const;
         bool isAuthenticated() const;
 
-        void sendAction(ManagerAction* action);
-        void sendAction(ManagerAction* action, responseCallbackFunction_t rcbf);
+        /**
+         * Sends action, the connection takes ownership of it.
+         * @param rcbf if set, called with the response, see ActionFuture::then.
+         * @return the response to come.
+         */
+        ActionFuture sendAction(ManagerAction* action);
+        ActionFuture sendAction(ManagerAction* action, const responseCallbackFunction_t& rcbf);
+
+        /**
+         * Sends the actions as one write and registers their responses at
+         * once, the connection takes ownership of them as with sendAction.
+         * rcbf, if any, is called with the response of each action.
+         * @return the completion of the whole batch.
+         */
+        ActionBatchPtr sendActions(const std::vector<ManagerAction*>& actions, const responseCallbackFunction_t& rcbf = responseCallbackFunction_t());
+
+        /**
+         * Sends a list action, SipPeersAction or StatusAction for instance,
+         * whose entries are collected in the returned list instead of being
+         * given to the event listeners. The connection takes ownership of the
+         * action.
+         * @param capacity see EventList::setCapacity.
+         */
+        EventListPtr sendEventListAction(ManagerAction* action, size_t capacity = 0);
+
+        /**
+         * Sends a command whose output is handed over line by line as it
+         * arrives, instead of a CommandResponse holding all of it. The
+         * connection takes ownership of the action.
+         * @param capacity see CommandStream::setCapacity.
+         */
+        CommandStreamPtr sendStreamingCommand(CommandAction* action, size_t capacity = 0);
         ManagerResponse* syncSendAction(ManagerAction& action);
         ManagerResponse* syncSendAction(ManagerAction& action, unsigned int timeout);
 
         void addEventCallback(onManagerEventCallback_t callback);
 
+        void addEventListener(const ManagerEventListener& mel);
+
+        /**
+         * Registers mel for the events of type only, optionally those whose
+         * key field matches pattern, see EventSubscriptions::subscribe.
+         */
+        void addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key = "", const std::string& pattern = "");
+        void removeEventListener(const ManagerEventListener& mel);
+
         State getState() const;
         unsigned int getDefaultResponseTimeout() const;
+        unsigned int getConnectTimeout() const;
         std::string getHostname() const;
         std::string getPassword() const;
         unsigned int getPort() const;
         std::string getUsername() const;
         bool isSsl() const;
+        SSLContextPtr getSslContext() const;
+        bool isLazyEvents() const;
+        bool isAutoEventMask() const;
+        bool isAutoReconnect() const;
+        unsigned int getReconnectInitialDelay() const;
+        unsigned int getReconnectMaxDelay() const;
+        size_t getEventPoolSize() const;
+        size_t getDispatchLanes() const;
+        std::string getServerName() const;
+        size_t getWriteQueueCapacity() const;
+        Writer::OverflowMode getWriteOverflowMode() const;
+
+        /**
+         * Data queued to be written to the server, see Writer. Producers may
+         * slow down when these grow.
+         */
+        size_t getWriteQueueDepth() const;
+        size_t getWritePendingBytes() const;
         void setDefaultResponseTimeout(unsigned int defaultResponseTimeout);
+
+        /**
+         * Sets how long, in milliseconds, connect tries the addresses of the
+         * hostname before giving up, see TCPSocket.
+         */
+        void setConnectTimeout(unsigned int connectTimeout);
         void setHostname(std::string hostname);
         void setPassword(std::string password);
         void setPort(unsigned int port);
         void setSsl(bool ssl);
+
+        /**
+         * Sets the context the SSL connections are made with, shared by the
+         * connections given the same one so that they resume each other's
+         * sessions. By default one verifying the server against the system
+         * certificate authorities is made on the first connection.
+         */
+        void setSslContext(const SSLContextPtr& sslContext);
         void setUsername(std::string username);
 
+        /**
+         * Events are parsed the first time one of their properties is read,
+         * see EventBuilder::setLazy.
+         */
+        void setLazyEvents(bool lazy, bool preloadUniqueId = false);
+
+        /**
+         * When set the event mask given to login is ignored: the server is
+         * asked for the events the listeners subscribed to only, through an
+         * EventsAction mask and AMI filters, updated as listeners are added
+         * and removed.<p>
+         * Asterisk can not remove a filter, the filters of removed listeners
+         * stay until logoff and once a listener wants every event a filter
+         * matching all of them is added.
+         */
+        void setAutoEventMask(bool autoEventMask);
+
+        /**
+         * When set a connection that drops after login is brought back by a
+         * Reconnector thread: it connects and logs in again with the same
+         * event mask, the subscriptions of setAutoEventMask are sent again,
+         * then the pending actions whose policy is REPLAY_ON_RECONNECT are
+         * sent again, in order, keeping their response timeout.
+         * <p>
+         * Either way the other pending actions get an Error response
+         * right away when the connection drops, as those sent while it is
+         * down. disconnect and logoff stop the reconnection.
+         */
+        void setAutoReconnect(bool autoReconnect);
+
+        /**
+         * Sets, in milliseconds, the delay before the first reconnection
+         * attempt and the one it doubles up to, see Reconnector.
+         */
+        void setReconnectDelay(unsigned int initialDelay, unsigned int maxDelay);
+
+        /**
+         * Sets how many dispatched events of each type are kept for reuse,
+         * 0 deletes every event after dispatch, see EventPool.
+         */
+        void setEventPoolSize(size_t eventPoolSize);
+
+        /**
+         * Fires the events of different calls in parallel on lanes threads,
+         * see ManagerEventsHandler::setDispatchLanes. To be set before
+         * connecting.
+         */
+        void setDispatchLanes(size_t lanes);
+
+        /**
+         * Dispatches the responses and events with the threads of group,
+         * which may be shared with other connections, see DispatchGroup. To
+         * be set before connecting.
+         */
+        void setDispatchGroup(const DispatchGroupPtr& group);
+
+        /**
+         * Names the server, ManagerEvent::getServer returns it for the events
+         * of this connection. To be set before connecting.
+         */
+        void setServerName(const std::string& serverName);
+
+        /**
+         * Sets the maximum number of actions waiting to be written and what
+         * to do once it is reached, see Writer. An action refused in
+         * FAIL_FAST mode gets an Error response right away, one dropped in
+         * DROP_OLDEST mode times out.
+         */
+        void setWriteQueueCapacity(size_t capacity);
+        void setWriteOverflowMode(Writer::OverflowMode overflowMode);
+
     protected:
-        void send(const std::string& data);
+        /**
+         * Queues data to the writer.
+         * @return false if the writer refused it.
+         */
+        bool send(const std::string& data);
+        bool send(const std::vector<std::string>& data);
+
+        /**
+         * Serializes actions into buffers recycled by the writer and queues
+         * them, refusing them as send does.
+         */
+        bool send(const ManagerAction& action);
+        bool send(const std::vector<ManagerAction*>& actions);
 
         void dispatchAsteriskVersion(AsteriskVersion* version);
-        void dispatchResponse(const std::string& response);
-        void dispatchEvent(const std::string& event);
+        void dispatchResponse(const SlabView& frame);
+        void dispatchResponsePart(const SlabView& part, bool last);
+        void dispatchEvent(const SlabView& frame);
         void notifyDisconnect();
+        virtual void releaseEvent(ManagerEvent* me);
         virtual void notifyResponseMessage(const std::string& responseMessage);
 
     private:
+        friend class Reconnector;
 
         TCPSocket* socket;
-        Reader reader;
+        // the socket is torn down by close or from the response dispatch thread
+        boost::recursive_mutex connectionMutex;
+        // declared first, the event pool outlives the reader dispatch threads
         EventBuilder eventBuilder;
+        Reader reader;
+        Writer writer;
         ResponseBuilder responseBuilder;
         AsteriskVersion* asteriskVersion;
 
@@ -97,6 +272,12 @@ namespace asteriskcpp {
          */
         bool ssl;
 
+        /**
+         * The context of the SSL connections, it keeps the sessions to
+         * resume.
+         */
+        SSLContextPtr sslContext;
+
         /**
          * The username to use for login as defined in Asterisk's
          * <code>manager.conf</code>.
@@ -115,8 +296,74 @@ namespace asteriskcpp {
          */
         unsigned int defaultResponseTimeout;
 
+        /**
+         * The time to wait for the TCP connection to be set up.
+         */
+        unsigned int connectTimeout;
+
+        /**
+         * <code>true</code> to derive the event mask and filters from the
+         * listeners subscriptions.
+         */
+        bool autoEventMask;
+
+        /* mask and filters the server was last given */
+        std::string appliedMask;
+        std::set<std::string> appliedFilters;
+        boost::mutex subscriptionsMutex;
+
+        /*
+         * Action ids are actionIdPrefix followed by a number, unique to this
+         * connection, that keys the pending responses.
+         */
+        std::string actionIdPrefix;
+        boost::atomic<uint64_t> lastActionId;
+
+        // shared by the futures of the actions sent
+        ActionCompletionPtr completion;
+
+        /* lists being received, keyed as the responses */
+        typedef std::map<uint64_t, EventListPtr> eventLists_t;
+        eventLists_t eventLists;
+        boost::atomic<size_t> pendingEventLists;
+        boost::mutex eventListsMutex;
+
+        /* Follows response received in parts, used by the response dispatch thread only */
+        bool followsStarted;
+        uint64_t followsId;
+        // the parts, unless they go to a stream
+        std::string followsBuffer;
+        CommandStreamCallBack* followsStream;
+
+        /* Reconnection */
+        Reconnector reconnector;
+        bool autoReconnect;
+        // logged in and neither disconnected nor logged off since
+        boost::atomic<bool> wantConnected;
+        std::string loginEventMask;
+        /*
+         * While restoring the REPLAY_ON_RECONNECT actions are held back,
+         * replayedIds are those sent again whose own send may be yet to come.
+         */
+        bool restoring;
+        std::set<uint64_t> replayedIds;
+        boost::mutex restoreMutex;
+
+        void close();
+        void connectionLost();
+        bool reconnect();
+        bool authenticate(const std::string& eventMask);
+        void failPending(bool restore);
+        bool deferAction(const ManagerAction& action);
         void setState(State state);
-        std::string extractActionID(const std::string& response);
+        void applySubscriptions();
+        void refuseAction(ManagerAction& action);
+        bool dispatchEventList(const SlabView& frame);
+        void eventListResponse(uint64_t id, ManagerResponse* mr);
+        void failEventLists(const std::string& message);
+        uint64_t generateID(ManagerAction& action);
+        uint64_t parseActionID(const SlabView& actionId) const;
+        uint64_t parseActionID(const char* data, size_t length) const;
 
     };
 
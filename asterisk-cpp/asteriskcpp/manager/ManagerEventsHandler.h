@@ -9,9 +9,15 @@
 #define MANAGEREVENTSHANDLER_H_
 
 #include "ManagerEventListener.h"
+#include "EventSubscriptions.h"
+#include "../structs/Thread.h"
+#include "../structs/BlockingRingQueue.h"
 #include <set>
+#include <vector>
 #include <typeinfo>
 #include <string>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
 
 namespace asteriskcpp {
 
@@ -26,19 +32,86 @@ namespace asteriskcpp {
         onManagerEventCallback_t function;
     };
 
+    class ManagerEventsHandler;
+
+    /**
+     * Thread firing the events of one dispatch lane, in the order they were
+     * posted.
+     */
+    class EventLane : public Thread {
+    public:
+        EventLane(ManagerEventsHandler* handler, size_t capacity);
+        virtual ~EventLane();
+
+        void post(ManagerEvent* me);
+
+        /**
+         * Stops the thread, the events not fired yet are released.
+         */
+        void shutdown();
+
+        virtual void run();
+
+    private:
+        ManagerEventsHandler* handler;
+        BlockingRingQueue<ManagerEvent*> queue;
+        std::vector<ManagerEvent*> batch;
+        size_t fired;
+    };
+
     class ManagerEventsHandler {
+        friend class EventLane;
         typedef std::set<const ManagerEventListener*> EventListenersList;
+        typedef boost::shared_ptr<const EventListenersList> EventListenersPtr;
     public:
+        ManagerEventsHandler();
         virtual ~ManagerEventsHandler();
         void addEventListener(const ManagerEventListener& mel);
+
+        /**
+         * Registers mel for the events of type only, see
+         * EventSubscriptions::subscribe. May be called several times to add
+         * other types.
+         */
+        void addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key = "", const std::string& pattern = "");
         void removeEventListener(const ManagerEventListener& mel);
 
+        /**
+         * Fires the events on lanes call lanes plus one for the events that
+         * belong to no call (PeerStatus, Reload...), instead of inline.<p>
+         * The events of a channel, as told by their Uniqueid or else Channel,
+         * always go to the same lane and keep their order; the listeners are
+         * called from several threads at once. Only the order of each channel
+         * is kept: the two legs of a bridged call are two channels, their
+         * events may be fired in another order than they were received.
+         * Keying on Linkedid would not keep them together either, it changes
+         * when calls are bridged. 0 (the default) fires every event inline,
+         * in order. Must not be changed while events are dispatched.
+         */
+        void setDispatchLanes(size_t lanes);
+        size_t getDispatchLanes() const;
+
     protected:
-        EventListenersList listeners;
+        /*
+         * Copied on write, the lanes fire the events to a snapshot without
+         * locking.
+         */
+        EventListenersPtr listeners;
+        boost::mutex listenersMutex;
+        EventSubscriptions subscriptions;
         void fireEvent(ManagerEvent* me);
 
+        /**
+         * Called with each event once every listener got it, deletes it.
+         */
+        virtual void releaseEvent(ManagerEvent* me);
+
     private:
+        std::vector<EventLane*> lanes;
+
+        void insertListener(const ManagerEventListener* mel);
         void internalFireEvent(ManagerEvent* me);
+        size_t laneOf(const ManagerEvent& me) const;
 
     };
 
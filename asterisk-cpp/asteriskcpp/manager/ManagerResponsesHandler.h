@@ -8,28 +8,34 @@
 #ifndef MANAGERRESPONSESHANDLER_H_
 #define MANAGERRESPONSESHANDLER_H_
 
-#include <map>
+#include <stdint.h>
 #include <typeinfo>
 #include <string>
 #include <ctime>
 #include <memory>
+#include <functional>
+#include <utility>
+#include <map>
+#include <vector>
 #include <boost/thread/thread.hpp>
 #include <boost/date_time.hpp>
 #include "asteriskcpp/manager/responses/ManagerResponse.h"
 #include "asteriskcpp/structs/Thread.h"
+#include "asteriskcpp/structs/TimerWheel.h"
+#include "asteriskcpp/structs/IdTable.h"
 #include "asteriskcpp/manager/actions/ManagerAction.h"
 #include "asteriskcpp/utils/LogHandler.h"
 
 namespace asteriskcpp {
 
-    class ResponseCallBack {
+    class ResponseCallBack : public TimerWheel::Timer {
     public:
-        boost::system_time timeout;
+        // milliseconds
+        unsigned int timeout;
         bool isTimeout;
         ResponseCallBack(ManagerAction* a, unsigned int tout);
         virtual ~ResponseCallBack();
 
-        void fireTimeout();
         virtual void fireCallBack(ManagerResponse* mr) = 0;
         ManagerAction* getAction() const;
 
@@ -38,11 +44,15 @@ namespace asteriskcpp {
         void setAction(ManagerAction *action);
     };
 
-    typedef void (*responseCallbackFunction_t)(ManagerResponse*);
+    /**
+     * Called with a response, which it does not own. Any callable fits,
+     * i.e. a function, a functor or a lambda with its own context.
+     */
+    typedef std::function<void(ManagerResponse*)> responseCallbackFunction_t;
 
     class ASyncResponseCallBack : public ResponseCallBack {
     public:
-        ASyncResponseCallBack(ManagerAction* a, unsigned int tout, responseCallbackFunction_t f);
+        ASyncResponseCallBack(ManagerAction* a, unsigned int tout, const responseCallbackFunction_t& f);
         virtual ~ASyncResponseCallBack();
         virtual void fireCallBack(ManagerResponse* mr);
 
@@ -50,41 +60,50 @@ namespace asteriskcpp {
         responseCallbackFunction_t function;
     };
 
-    class SyncResponseCallBack : public ResponseCallBack {
-        boost::mutex m_mutex;
-        boost::condition_variable m_cond;
-        bool isReady;
-        bool isStollEnd;
-
-    public:
-        virtual ~SyncResponseCallBack();
-
-        ManagerResponse *response;
-        SyncResponseCallBack(ManagerAction* a, unsigned int timeOut);
-        ManagerResponse* stoll();
-        virtual void fireCallBack(ManagerResponse* mr);
-    };
-
     class ManagerResponsesHandler : public Thread {
         boost::mutex m_mutex;
-        typedef std::map<std::string, ResponseCallBack*> listenersList_t;
+        // keyed by the number of the action id, see ManagerConnection
+        typedef IdTable<ResponseCallBack> listenersList_t;
         boost::condition_variable m_cond;
+        TimerWheel timeouts;
+        std::vector<TimerWheel::Timer*> expired;
 
     public:
+        ManagerResponsesHandler();
         virtual ~ManagerResponsesHandler();
-        void addResponsetListener(const std::string& key, ResponseCallBack* bcb);
-        void removeResponseListener(const std::string& key);
+        void addResponsetListener(uint64_t id, ResponseCallBack* bcb);
+
+        /**
+         * Registers several listeners at once, under a single lock.
+         */
+        void addResponseListeners(const std::vector<std::pair<uint64_t, ResponseCallBack*> >& callbacks);
+        void removeResponseListener(uint64_t id);
+
+        /**
+         * Removes the listener of id without deleting it, it will not time
+         * out either.
+         * @return the listener, owned by the caller, NULL if none.
+         */
+        ResponseCallBack* detachResponseListener(uint64_t id);
+
+        /**
+         * Sorts the actions still waiting for their response, and not timed
+         * out: the ids of those to fail, and keyed by id the text of those to
+         * send again, the REPLAY_ON_RECONNECT ones when replay is set.
+         * failed may be NULL, the other actions are then left waiting.
+         */
+        void collectPending(bool replay, std::vector<std::string>* failed, std::map<uint64_t, std::string>& replayed);
         bool isEmpty();
 
         virtual void stop();
         virtual void run();
 
-        ResponseCallBack* getListener(const std::string& key);
+        ResponseCallBack* getListener(uint64_t id);
 
     protected:
         listenersList_t listeners;
         void clear();
-        void fireResponseCallback(ManagerResponse* mr);
+        void fireResponseCallback(uint64_t id, ManagerResponse* mr);
         virtual void notifyResponseMessage(const std::string& responseMessage) {};
 
     };
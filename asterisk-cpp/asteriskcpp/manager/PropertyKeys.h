@@ -0,0 +1,327 @@
+/*
+ * PropertyKeys.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef PROPERTYKEYS_H_
+#define PROPERTYKEYS_H_
+
+#include "asteriskcpp/structs/PropertyMap.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Names of the properties read and written by the typed getters and
+     * setters of actions, events and responses, hashed at compile time.
+     */
+    namespace keys {
+        constexpr PropertyKey Abandoned("Abandoned");
+        constexpr PropertyKey About("About");
+        constexpr PropertyKey AccountCode("AccountCode");
+        constexpr PropertyKey AckCall("AckCall");
+        constexpr PropertyKey Acl("Acl");
+        constexpr PropertyKey AddressIp("AddressIp");
+        constexpr PropertyKey AddressPort("AddressPort");
+        constexpr PropertyKey Agent("Agent");
+        constexpr PropertyKey Alarm("Alarm");
+        constexpr PropertyKey AmaFlags("AmaFlags");
+        constexpr PropertyKey AmiVersion("AmiVersion");
+        constexpr PropertyKey Append("Append");
+        constexpr PropertyKey AsteriskVersion("AsteriskVersion");
+        constexpr PropertyKey AttachmentFormat("AttachmentFormat");
+        constexpr PropertyKey AttachMessage("AttachMessage");
+        constexpr PropertyKey AuthMsg("AuthMsg");
+        constexpr PropertyKey AuthType("AuthType");
+        constexpr PropertyKey Availability("Availability");
+        constexpr PropertyKey Available("Available");
+        constexpr PropertyKey AverageLag("AverageLag");
+        constexpr PropertyKey AverageLagInMilliSeconds("AverageLagInMilliSeconds");
+        constexpr PropertyKey AverageRxDataRate("AverageRxDataRate");
+        constexpr PropertyKey AverageRxDataRateInBps("AverageRxDataRateInBps");
+        constexpr PropertyKey AverageTxDataRate("AverageTxDataRate");
+        constexpr PropertyKey AverageTxDataRateInBps("AverageTxDataRateInBps");
+        constexpr PropertyKey BridgedChannel("BridgedChannel");
+        constexpr PropertyKey BridgedUniqueId("BridgedUniqueId");
+        constexpr PropertyKey Buddy("Buddy");
+        constexpr PropertyKey BuddyStatus("BuddyStatus");
+        constexpr PropertyKey BusyLevel("BusyLevel");
+        constexpr PropertyKey Callback("Callback");
+        constexpr PropertyKey CallerId("CallerId");
+        constexpr PropertyKey CallerIdName("CallerIdName");
+        constexpr PropertyKey CallerIdNum("CallerIdNum");
+        constexpr PropertyKey Callers("Callers");
+        constexpr PropertyKey CallGroup("CallGroup");
+        constexpr PropertyKey CallLimit("CallLimit");
+        constexpr PropertyKey CallOperator("CallOperator");
+        constexpr PropertyKey Calls("Calls");
+        constexpr PropertyKey CallsTaken("CallsTaken");
+        constexpr PropertyKey CanReview("CanReview");
+        constexpr PropertyKey Cause("Cause");
+        constexpr PropertyKey Challenge("Challenge");
+        constexpr PropertyKey Channel("Channel");
+        constexpr PropertyKey Channel1("Channel1");
+        constexpr PropertyKey Channel2("Channel2");
+        constexpr PropertyKey ChannelDriver("ChannelDriver");
+        constexpr PropertyKey Channels("Channels");
+        constexpr PropertyKey ChannelState("ChannelState");
+        constexpr PropertyKey ChannelStateDesc("ChannelStateDesc");
+        constexpr PropertyKey ChannelType("ChannelType");
+        constexpr PropertyKey ChanObjectType("ChanObjectType");
+        constexpr PropertyKey ChanVariable("ChanVariable");
+        constexpr PropertyKey CidCallingPres("CidCallingPres");
+        constexpr PropertyKey CodecOrder("CodecOrder");
+        constexpr PropertyKey Codecs("Codecs");
+        constexpr PropertyKey Command("Command");
+        constexpr PropertyKey CommandId("CommandId");
+        constexpr PropertyKey Completed("Completed");
+        constexpr PropertyKey Conference("Conference");
+        constexpr PropertyKey Connectedlinename("Connectedlinename");
+        constexpr PropertyKey Connectedlinenum("Connectedlinenum");
+        constexpr PropertyKey Context("Context");
+        constexpr PropertyKey CoreCdrEnabled("CoreCdrEnabled");
+        constexpr PropertyKey CoreCurrentCalls("CoreCurrentCalls");
+        constexpr PropertyKey CoreHttpEnabled("CoreHttpEnabled");
+        constexpr PropertyKey CoreMaxCalls("CoreMaxCalls");
+        constexpr PropertyKey CoreMaxFilehandles("CoreMaxFilehandles");
+        constexpr PropertyKey CoreMaxLoadAvg("CoreMaxLoadAvg");
+        constexpr PropertyKey CoreRealtimeEnabled("CoreRealtimeEnabled");
+        constexpr PropertyKey CoreReloadDate("CoreReloadDate");
+        constexpr PropertyKey CoreReloadDateTimeAsDate("CoreReloadDateTimeAsDate");
+        constexpr PropertyKey CoreReloadTime("CoreReloadTime");
+        constexpr PropertyKey CoreRunGroup("CoreRunGroup");
+        constexpr PropertyKey CoreRunUser("CoreRunUser");
+        constexpr PropertyKey CoreStartupDate("CoreStartupDate");
+        constexpr PropertyKey CoreStartupDateTimeAsDate("CoreStartupDateTimeAsDate");
+        constexpr PropertyKey CoreStartupTime("CoreStartupTime");
+        constexpr PropertyKey Country("Country");
+        constexpr PropertyKey CumulativeLoss("CumulativeLoss");
+        constexpr PropertyKey DChannel("DChannel");
+        constexpr PropertyKey DefaultAddrIp("DefaultAddrIp");
+        constexpr PropertyKey DefaultAddrPort("DefaultAddrPort");
+        constexpr PropertyKey DefaultUsername("DefaultUsername");
+        constexpr PropertyKey DeleteMessage("DeleteMessage");
+        constexpr PropertyKey Dialout("Dialout");
+        constexpr PropertyKey Digit("Digit");
+        constexpr PropertyKey Direction("Direction");
+        constexpr PropertyKey Dnd("Dnd");
+        constexpr PropertyKey Domain("Domain");
+        constexpr PropertyKey Dynamic("Dynamic");
+        constexpr PropertyKey Email("Email");
+        constexpr PropertyKey Event("Event");
+        constexpr PropertyKey EventList("EventList");
+        constexpr PropertyKey EventMask("EventMask");
+        constexpr PropertyKey Events("Events");
+        constexpr PropertyKey ExitContext("ExitContext");
+        constexpr PropertyKey Expires("Expires");
+        constexpr PropertyKey Exten("Exten");
+        constexpr PropertyKey Extension("Extension");
+        constexpr PropertyKey ExtraChannel("ExtraChannel");
+        constexpr PropertyKey ExtraContext("ExtraContext");
+        constexpr PropertyKey ExtraExten("ExtraExten");
+        constexpr PropertyKey ExtraPriority("ExtraPriority");
+        constexpr PropertyKey Family("Family");
+        constexpr PropertyKey File("File");
+        constexpr PropertyKey Filename("Filename");
+        constexpr PropertyKey Filter("Filter");
+        constexpr PropertyKey FileName("FileName");
+        constexpr PropertyKey Format("Format");
+        constexpr PropertyKey From("From");
+        constexpr PropertyKey FromAddress("FromAddress");
+        constexpr PropertyKey FromPort("FromPort");
+        constexpr PropertyKey Fullname("Fullname");
+        constexpr PropertyKey HighestSequence("HighestSequence");
+        constexpr PropertyKey Hint("Hint");
+        constexpr PropertyKey HoldTime("HoldTime");
+        constexpr PropertyKey Host("Host");
+        constexpr PropertyKey HostId("HostId");
+        constexpr PropertyKey ImapUser("ImapUser");
+        constexpr PropertyKey Interface("Interface");
+        constexpr PropertyKey Items("Items");
+        constexpr PropertyKey Jabber("Jabber");
+        constexpr PropertyKey JitterBufferOverflows("JitterBufferOverflows");
+        constexpr PropertyKey Key("Key");
+        constexpr PropertyKey Language("Language");
+        constexpr PropertyKey LastCall("LastCall");
+        constexpr PropertyKey LastMsgsSent("LastMsgsSent");
+        constexpr PropertyKey LastSr("LastSr");
+        constexpr PropertyKey ListContexts("ListContexts");
+        constexpr PropertyKey ListExtensions("ListExtensions");
+        constexpr PropertyKey ListItems("ListItems");
+        constexpr PropertyKey ListPriorities("ListPriorities");
+        constexpr PropertyKey LoadType("LoadType");
+        constexpr PropertyKey LocalStationId("LocalStationId");
+        constexpr PropertyKey Location("Location");
+        constexpr PropertyKey LoggedIn("LoggedIn");
+        constexpr PropertyKey LongestHoldTime("LongestHoldTime");
+        constexpr PropertyKey Mailbox("Mailbox");
+        constexpr PropertyKey MailCommand("MailCommand");
+        constexpr PropertyKey Max("Max");
+        constexpr PropertyKey MaxCallBr("MaxCallBr");
+        constexpr PropertyKey MaxLag("MaxLag");
+        constexpr PropertyKey MaxLagInMilliSeconds("MaxLagInMilliSeconds");
+        constexpr PropertyKey MaxMessageCount("MaxMessageCount");
+        constexpr PropertyKey MaxMessageLength("MaxMessageLength");
+        constexpr PropertyKey Md5SecretExist("Md5SecretExist");
+        constexpr PropertyKey MeetMe("MeetMe");
+        constexpr PropertyKey Member("Member");
+        constexpr PropertyKey MemberName("MemberName");
+        constexpr PropertyKey Membership("Membership");
+        constexpr PropertyKey Message("Message");
+        constexpr PropertyKey MinimumJitterSpace("MinimumJitterSpace");
+        constexpr PropertyKey Mix("Mix");
+        constexpr PropertyKey Module("Module");
+        constexpr PropertyKey Name("Name");
+        constexpr PropertyKey New("New");
+        constexpr PropertyKey NewMessageCount("NewMessageCount");
+        constexpr PropertyKey NewMessages("NewMessages");
+        constexpr PropertyKey Newname("Newname");
+        constexpr PropertyKey NewUniqueId("NewUniqueId");
+        constexpr PropertyKey Number("Number");
+        constexpr PropertyKey ObjectName("ObjectName");
+        constexpr PropertyKey Old("Old");
+        constexpr PropertyKey OldMessageCount("OldMessageCount");
+        constexpr PropertyKey OldMessages("OldMessages");
+        constexpr PropertyKey Operation("Operation");
+        constexpr PropertyKey OriginalPosition("OriginalPosition");
+        constexpr PropertyKey OurSsrc("OurSsrc");
+        constexpr PropertyKey PacketsLost("PacketsLost");
+        constexpr PropertyKey Pager("Pager");
+        constexpr PropertyKey PagesTransferred("PagesTransferred");
+        constexpr PropertyKey ParkingLot("ParkingLot");
+        constexpr PropertyKey Paused("Paused");
+        constexpr PropertyKey Peer("Peer");
+        constexpr PropertyKey Penalty("Penalty");
+        constexpr PropertyKey PhoneHome("PhoneHome");
+        constexpr PropertyKey PhoneMobile("PhoneMobile");
+        constexpr PropertyKey PhoneOffice("PhoneOffice");
+        constexpr PropertyKey PickupGroup("PickupGroup");
+        constexpr PropertyKey Ping("Ping");
+        constexpr PropertyKey Port("Port");
+        constexpr PropertyKey Position("Position");
+        constexpr PropertyKey PriEvent("PriEvent");
+        constexpr PropertyKey PriEventCode("PriEventCode");
+        constexpr PropertyKey Priority("Priority");
+        constexpr PropertyKey Privilege("Privilege");
+        constexpr PropertyKey ProtocolIdentifier("ProtocolIdentifier");
+        constexpr PropertyKey Pt("Pt");
+        constexpr PropertyKey QualifyFreq("QualifyFreq");
+        constexpr PropertyKey Queue("Queue");
+        constexpr PropertyKey Reason("Reason");
+        constexpr PropertyKey ReceivedPackets("ReceivedPackets");
+        constexpr PropertyKey ReceptionReports("ReceptionReports");
+        constexpr PropertyKey Refresh("Refresh");
+        constexpr PropertyKey RegContact("RegContact");
+        constexpr PropertyKey RegExpire("RegExpire");
+        constexpr PropertyKey RegExtension("RegExtension");
+        constexpr PropertyKey RegistrationTime("RegistrationTime");
+        constexpr PropertyKey RemoteSecretExist("RemoteSecretExist");
+        constexpr PropertyKey RemoteStationId("RemoteStationId");
+        constexpr PropertyKey Resolution("Resolution");
+        constexpr PropertyKey Restart("Restart");
+        constexpr PropertyKey RrCount("RrCount");
+        constexpr PropertyKey Rtt("Rtt");
+        constexpr PropertyKey SayCid("SayCid");
+        constexpr PropertyKey SayDurationMinimum("SayDurationMinimum");
+        constexpr PropertyKey SayEnvelope("SayEnvelope");
+        constexpr PropertyKey ScreenName("ScreenName");
+        constexpr PropertyKey Seconds("Seconds");
+        constexpr PropertyKey Secret("Secret");
+        constexpr PropertyKey SecretExist("SecretExist");
+        constexpr PropertyKey SenderSsrc("SenderSsrc");
+        constexpr PropertyKey SentNtp("SentNtp");
+        constexpr PropertyKey SentOctets("SentOctets");
+        constexpr PropertyKey SentPackets("SentPackets");
+        constexpr PropertyKey SentRtp("SentRtp");
+        constexpr PropertyKey SequenceNumberCycles("SequenceNumberCycles");
+        constexpr PropertyKey Server("Server");
+        constexpr PropertyKey ServerEmail("ServerEmail");
+        constexpr PropertyKey ServiceLevel("ServiceLevel");
+        constexpr PropertyKey ServiceLevelPerf("ServiceLevelPerf");
+        constexpr PropertyKey Shutdown("Shutdown");
+        constexpr PropertyKey Signalling("Signalling");
+        constexpr PropertyKey SipAuthInsecure("SipAuthInsecure");
+        constexpr PropertyKey SipCallId("SipCallId");
+        constexpr PropertyKey SipCanReinvite("SipCanReinvite");
+        constexpr PropertyKey SipDirectMedia("SipDirectMedia");
+        constexpr PropertyKey SipDtmfMode("SipDtmfMode");
+        constexpr PropertyKey SipFromDomain("SipFromDomain");
+        constexpr PropertyKey SipFromUser("SipFromUser");
+        constexpr PropertyKey SipNatSupport("SipNatSupport");
+        constexpr PropertyKey SipPromiscRedir("SipPromiscRedir");
+        constexpr PropertyKey SipSessExpires("SipSessExpires");
+        constexpr PropertyKey SipSessMin("SipSessMin");
+        constexpr PropertyKey SipSessRefresh("SipSessRefresh");
+        constexpr PropertyKey SipSessTimers("SipSessTimers");
+        constexpr PropertyKey SipT38ec("SipT38ec");
+        constexpr PropertyKey SipT38MaxDtgrm("SipT38MaxDtgrm");
+        constexpr PropertyKey SipT38support("SipT38support");
+        constexpr PropertyKey SipTextSupport("SipTextSupport");
+        constexpr PropertyKey SipUserAgent("SipUserAgent");
+        constexpr PropertyKey SipUserPhone("SipUserPhone");
+        constexpr PropertyKey SipVideoSupport("SipVideoSupport");
+        constexpr PropertyKey Skypename("Skypename");
+        constexpr PropertyKey Soft("Soft");
+        constexpr PropertyKey Span("Span");
+        constexpr PropertyKey SrCount("SrCount");
+        constexpr PropertyKey State("State");
+        constexpr PropertyKey StateInterface("StateInterface");
+        constexpr PropertyKey Status("Status");
+        constexpr PropertyKey Strategy("Strategy");
+        constexpr PropertyKey SystemName("SystemName");
+        constexpr PropertyKey T38OctetsReceived("T38OctetsReceived");
+        constexpr PropertyKey T38OctetsSent("T38OctetsSent");
+        constexpr PropertyKey T38PacketsReceived("T38PacketsReceived");
+        constexpr PropertyKey T38PacketsSent("T38PacketsSent");
+        constexpr PropertyKey T38SessionDuration("T38SessionDuration");
+        constexpr PropertyKey T38SessionDurationInSeconds("T38SessionDurationInSeconds");
+        constexpr PropertyKey TalkTime("TalkTime");
+        constexpr PropertyKey TargetChannel("TargetChannel");
+        constexpr PropertyKey TargetUniqueId("TargetUniqueId");
+        constexpr PropertyKey TheirLastSr("TheirLastSr");
+        constexpr PropertyKey Timeout("Timeout");
+        constexpr PropertyKey Timestamp("Timestamp");
+        constexpr PropertyKey Timezone("Timezone");
+        constexpr PropertyKey To("To");
+        constexpr PropertyKey ToAddress("ToAddress");
+        constexpr PropertyKey ToHost("ToHost");
+        constexpr PropertyKey Tone("Tone");
+        constexpr PropertyKey ToPort("ToPort");
+        constexpr PropertyKey TotalEvents("TotalEvents");
+        constexpr PropertyKey TotalLag("TotalLag");
+        constexpr PropertyKey TotalLagInMilliSeconds("TotalLagInMilliSeconds");
+        constexpr PropertyKey Transfer2Parking("Transfer2Parking");
+        constexpr PropertyKey TransferContext("TransferContext");
+        constexpr PropertyKey TransferExten("TransferExten");
+        constexpr PropertyKey TransferMethod("TransferMethod");
+        constexpr PropertyKey TransferMode("TransferMode");
+        constexpr PropertyKey TransferRate("TransferRate");
+        constexpr PropertyKey TransferType("TransferType");
+        constexpr PropertyKey Transit("Transit");
+        constexpr PropertyKey UniqueId("UniqueId");
+        constexpr PropertyKey UniqueId1("UniqueId1");
+        constexpr PropertyKey UnrecoverablePackets("UnrecoverablePackets");
+        constexpr PropertyKey User("User");
+        constexpr PropertyKey UserEvent("UserEvent");
+        constexpr PropertyKey UserField("UserField");
+        constexpr PropertyKey Username("Username");
+        constexpr PropertyKey UserNum("UserNum");
+        constexpr PropertyKey Val("Val");
+        constexpr PropertyKey Value("Value");
+        constexpr PropertyKey Variable("Variable");
+        constexpr PropertyKey Variables("Variables");
+        constexpr PropertyKey Version("Version");
+        constexpr PropertyKey VmContext("VmContext");
+        constexpr PropertyKey Voicemailbox("Voicemailbox");
+        constexpr PropertyKey VoiceMailbox("VoiceMailbox");
+        constexpr PropertyKey VolumeGain("VolumeGain");
+        constexpr PropertyKey Wait("Wait");
+        constexpr PropertyKey Waiting("Waiting");
+        constexpr PropertyKey Weight("Weight");
+        constexpr PropertyKey WrapupTime("WrapupTime");
+        constexpr PropertyKey ZapChannel("ZapChannel");
+    }
+
+}
+
+#endif /* PROPERTYKEYS_H_ */
@@ -10,35 +10,91 @@
 
 #include <iostream>
 
+#include <boost/shared_ptr.hpp>
+
 #include "../structs/Thread.h"
 #include "../net/TCPSocket.h"
+#include "../net/IOReactor.h"
 #include "Dispatcher.h"
+#include "Framer.h"
 
 namespace asteriskcpp {
 
-    class Reader : public Thread {
+    /**
+     * Frames the data of a connection socket and hands it to the dispatch
+     * threads.<p>
+     * The socket is watched by an IOReactor shared by all connections, the
+     * Reader runs only when data is available. The dispatch threads are
+     * those of a DispatchGroup, its own one unless it was given another.
+     * When their queue is full the socket is paused, the reactor thread
+     * never waits for them.
+     */
+    class Reader : public IOHandler {
     public:
         Reader();
         void start(TCPSocket* s, Dispatcher* d);
-        void stop();
-        void run();
+
+        /**
+         * Stops reading the socket.
+         * @return true if the connection was not stopped nor lost before.
+         */
+        bool stop();
+
+        /**
+         * Called by the dispatcher given the disconnection of the Reader, see
+         * Dispatcher::notifyDisconnect.
+         * @return false if the connection was stopped or restarted meanwhile,
+         * nothing is left to tear down.
+         */
+        bool takeHangup();
+
+        /**
+         * Dispatches the messages with the threads of group, to be set before
+         * the first start.
+         */
+        void setDispatchGroup(const DispatchGroupPtr& group);
+
+        /**
+         * Stops dispatching, the messages not dispatched yet are dropped.
+         * The threads are stopped if the group is not shared.
+         */
+        void stopDispatching();
+        void onReadable();
         virtual ~Reader();
 
-        void delegeteResponseMessage(const std::string& responseMessage);
-        void delegeteEventMessage(const std::string& eventMessage);
+        /**
+         * Queues a message made up by the connection.
+         * @return false if there is no dispatch thread yet, never connected.
+         */
+        bool delegeteResponseMessage(const std::string& responseMessage);
+        bool delegeteEventMessage(const std::string& eventMessage);
 
     private:
-        using Thread::start;
+        boost::shared_ptr<IOReactor> reactor;
+        boost::mutex stateMutex;
         TCPSocket* connectionSocket;
         Dispatcher* dispatcher;
-        std::string unprocessedStr;
+        Framer framer;
+        // parts of a Follows response were dispatched, not its end
+        bool followsPending;
+        // the connection was lost, the dispatcher is told from the dispatch thread
+        bool lost;
+        // message the full queue did not take, the socket is paused meanwhile
+        DispatchMessage pending;
+        bool pendingEvent;
+        bool blocked;
+        // resumes the socket once the queue has room
+        MessageTable::SpaceCallback resumeCallback;
 
-        MessageTable* responseMessageTable;
-        MessageTable* eventMessageTable;
-        DispatchThread* responseThread;
-        DispatchThread* eventThread;
+        DispatchGroupPtr dispatchGroup;
+        // the dispatcher of the messages, kept between connections
+        Dispatcher* target;
 
-        void processIncomming(const std::string& newStr);
+        void processIncomming();
+        bool post(const DispatchMessage& message, bool event);
+        void hangup();
+        void postHangup();
+        Dispatcher* release(bool lostOnly);
 
     };
 
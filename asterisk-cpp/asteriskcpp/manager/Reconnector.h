@@ -0,0 +1,75 @@
+/*
+ * Reconnector.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef RECONNECTOR_H_
+#define RECONNECTOR_H_
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "../structs/Thread.h"
+
+namespace asteriskcpp {
+
+    class ManagerConnection;
+
+    /**
+     * Brings a dropped ManagerConnection back from its own thread.<p>
+     * Once scheduled, attempts are made until one succeeds or the schedule
+     * is cancelled, the delay before each one doubles from the initial delay
+     * up to the maximum one. Each delay is drawn between its half and its
+     * whole, so that clients dropped together by a server restart do not
+     * all come back at the same time.
+     */
+    class Reconnector : public Thread {
+    public:
+        Reconnector(ManagerConnection* connection);
+        virtual ~Reconnector();
+
+        /**
+         * Starts the attempts, if not started yet.
+         */
+        void schedule();
+        void cancel();
+        bool isScheduled() const;
+
+        /**
+         * Attempts failed since the connection dropped.
+         */
+        size_t getAttempts() const;
+
+        unsigned int getInitialDelay() const;
+        unsigned int getMaxDelay() const;
+
+        /**
+         * Sets the delays in milliseconds.
+         */
+        void setDelays(unsigned int initialDelay, unsigned int maxDelay);
+
+        /**
+         * Stops the thread, after the attempt in progress if any.
+         */
+        virtual void stop();
+        virtual void run();
+
+    private:
+        ManagerConnection* connection;
+        mutable boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+        bool scheduled;
+        // scheduled again during an attempt
+        bool rescheduled;
+        size_t attempts;
+        unsigned int initialDelay;
+        unsigned int maxDelay;
+        boost::random::mt19937 random;
+
+        unsigned int nextDelay();
+    };
+
+}
+
+#endif /* RECONNECTOR_H_ */
@@ -18,6 +18,12 @@ namespace asteriskcpp {
         ResponseBuilder();
         virtual ~ResponseBuilder();
         virtual ManagerResponse* buildResponse(ManagerAction* action, const std::string& responseStr);
+
+        /**
+         * Same as above, the properties stay in the frame instead of being
+         * copied.
+         */
+        virtual ManagerResponse* buildResponse(ManagerAction* action, const SlabView& frame);
     };
 
 }
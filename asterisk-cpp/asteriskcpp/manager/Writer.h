@@ -8,24 +8,119 @@
 #ifndef WRITER_H_
 #define WRITER_H_
 
+#include <deque>
+#include <string>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 #include "../structs/Thread.h"
 #include "../net/TCPSocket.h"
-#include "../structs/SynchronisedQueue.h"
 
 namespace asteriskcpp {
 
+    /**
+     * Writes the data of a connection socket from its own thread, so a slow
+     * peer never blocks the threads sending actions.<p>
+     * Data is queued in a bounded queue, what is queued when the thread
+     * wakes up is written with a single system call. When the queue is full
+     * the overflow mode decides between waiting for room (BLOCK), refusing
+     * the data (FAIL_FAST) and dropping the oldest queued data (DROP_OLDEST).
+     * <p>
+     * Written buffers are kept in a small pool for acquireBuffer, the
+     * callers serializing into them allocate nothing once it is warm.
+     * <p>
+     * A write error shuts the socket down, the Reader then sees the
+     * disconnection as for any other one.
+     */
     class Writer : public Thread {
     public:
+
+        enum OverflowMode {
+            BLOCK = 0, FAIL_FAST = 1, DROP_OLDEST = 2
+        };
+
         Writer();
         virtual ~Writer();
 
-        void start(TCPSocket* s, SynchronisedQueue<std::string>* wq);
+        void start(TCPSocket* s);
+
+        /**
+         * Stops the thread, the data not written yet is dropped.
+         */
+        virtual void stop();
         void run();
 
+        /**
+         * Queues data, the entries of a vector are written in order and
+         * kept or refused together.
+         * @return false if the data was refused: the queue is full in
+         * FAIL_FAST mode, or the writer is not running.
+         */
+        bool write(const std::string& data);
+        bool write(const std::vector<std::string>& data);
+
+        /**
+         * Same as write but the data is moved to the queue instead of being
+         * copied. data is left empty when it is queued.
+         */
+        bool writeBuffer(std::string& data);
+        bool writeBuffers(std::vector<std::string>& data);
+
+        /**
+         * Replaces data by an empty buffer already written by the thread, if
+         * one is available, so serializing into it needs no allocation.
+         */
+        void acquireBuffer(std::string& data);
+        void acquireBuffers(std::vector<std::string>& data);
+
+        /**
+         * Waits at most timeout milliseconds for the queued data to be
+         * written.
+         * @return true if nothing is left to write.
+         */
+        bool flush(unsigned int timeout);
+
+        /**
+         * Entries queued and not written yet.
+         */
+        size_t getQueueDepth() const;
+
+        /**
+         * Bytes queued or being written.
+         */
+        size_t getPendingBytes() const;
+
+        size_t getCapacity() const;
+        OverflowMode getOverflowMode() const;
+
+        /**
+         * Sets the maximum number of queued entries, a vector bigger than
+         * capacity is still accepted when the queue is empty.
+         */
+        void setCapacity(size_t capacity);
+        void setOverflowMode(OverflowMode overflowMode);
+
     private:
         using Thread::start;
         TCPSocket* m_connectionSocket;
-        SynchronisedQueue<std::string>* m_WriteQueue;
+
+        std::deque<std::string> queue;
+        // data taken from the queue by the thread
+        std::vector<std::string> batch;
+        // written buffers, handed out again by acquireBuffer
+        std::vector<std::string> pool;
+        size_t pendingBytes;
+        size_t capacity;
+        OverflowMode overflowMode;
+        bool running;
+        bool writing;
+        mutable boost::mutex m_mutex;
+        boost::condition_variable notEmpty;
+        boost::condition_variable notFull;
+
+        bool makeRoom(boost::unique_lock<boost::mutex>& lock, size_t count);
+        void push(std::string& data);
+        void recycle();
     };
 
 }
@@ -26,8 +26,12 @@ namespace asteriskcpp {
 
         virtual const std::string toString() const;
 
+        virtual void serialize(std::string& out) const;
+
         const std::string& generateID();
 
+        const std::string& generateID(const std::string& prefix, uint64_t number);
+
         /**
          *@see
          */
@@ -0,0 +1,53 @@
+/*
+ * FilterAction.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef FILTERACTION_H_
+#define FILTERACTION_H_
+
+#include "AbstractManagerAction.h"
+
+namespace asteriskcpp {
+
+    /**
+     * The FilterAction adds an event filter to this manager connection.<p>
+     * Once a filter is set only the events whose text matches one of the
+     * filters are sent, filters starting with '!' exclude the events they
+     * match. Filters are regular expressions matched against the whole event.
+     * <p>
+     * It is implemented in <code>main/manager.c</code>.<p>
+     * Available since Asterisk 13, Asterisk offers no way to remove a filter.
+     */
+    class FilterAction : public AbstractManagerAction {
+    public:
+
+        /**
+         * Creates a new FilterAction adding filter.
+         */
+        FilterAction(const std::string& filter);
+
+        FilterAction(const std::string& operation, const std::string& filter);
+
+        virtual ~FilterAction();
+
+        /**
+         * Returns the operation, only "Add" is supported by Asterisk.
+         */
+        const std::string& getOperation() const;
+
+        void setOperation(const std::string& operation);
+
+        /**
+         * Returns the filter expression.
+         */
+        const std::string& getFilter() const;
+
+        void setFilter(const std::string& filter);
+
+    };
+
+} //NS
+
+#endif /* FILTERACTION_H_ */
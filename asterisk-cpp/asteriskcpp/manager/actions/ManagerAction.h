@@ -8,8 +8,9 @@
 #ifndef MANAGERACTION_H_
 #define MANAGERACTION_H_
 
-#include "../../structs/PropertyMap.h"
+#include "../PropertyKeys.h"
 #include "../responses/ManagerResponse.h"
+#include <stdint.h>
 
 namespace asteriskcpp {
 
@@ -27,12 +28,29 @@ namespace asteriskcpp {
     class ManagerAction : public PropertyMap {
     public:
 
+        /**
+         * What becomes of the action when the connection drops before its
+         * response arrives, see ManagerConnection::setAutoReconnect.
+         * <p>
+         * FAIL_ON_DISCONNECT: the action gets an Error response right
+         * away.
+         * <p>
+         * REPLAY_ON_RECONNECT: the action is sent again once the connection
+         * is back, if it did not time out meanwhile. Only for actions that can
+         * safely run twice, the first one may have reached the server.
+         */
+        enum ReconnectPolicy {
+            FAIL_ON_DISCONNECT = 0, REPLAY_ON_RECONNECT = 1
+        };
+
         ManagerAction();
 
         /**
-         * Returns the name of the action for example "Hangup".
+         * Returns the name of the action for example "Hangup".<p>
+         * The name is taken from the class name the first time an action of
+         * that class asks for it.
          */
-        virtual const std::string getAction() const;
+        virtual const std::string& getAction() const;
 
         /**
          * Generate a valid ID
@@ -40,6 +58,12 @@ namespace asteriskcpp {
          */
         virtual const std::string& generateID() = 0;
 
+        /**
+         * Sets the ID to prefix followed by number in decimal, the form
+         * ManagerConnection matches responses with.
+         */
+        virtual const std::string& generateID(const std::string& prefix, uint64_t number) = 0;
+
         /**
          * Returns the action id.
          * @return the user provied action id.
@@ -52,10 +76,23 @@ namespace asteriskcpp {
          */
         virtual const std::string toString() const = 0;
 
+        /**
+         * Appends the action string representation to out, with no
+         * temporary string on the way. Sending an action uses this, with a
+         * buffer reused from previous writes.
+         */
+        virtual void serialize(std::string& out) const;
+
         virtual ManagerResponse* expectedResponce(const std::string& response);
 
+        ReconnectPolicy getReconnectPolicy() const;
+        void setReconnectPolicy(ReconnectPolicy reconnectPolicy);
+
     protected:
         std::string action;
+
+    private:
+        ReconnectPolicy reconnectPolicy;
     };
 
 }
@@ -0,0 +1,110 @@
+/*
+ * PreparedAction.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef PREPAREDACTION_H_
+#define PREPAREDACTION_H_
+
+#include "AbstractManagerAction.h"
+#include <boost/shared_ptr.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * An action serialized once, with slots for its ActionID and for the
+     * values that change from one send to the next.<p>
+     * The template is made from a prototype action, the line of each
+     * parameter is replaced by a slot, parameters the prototype does not
+     * have are added at its end and only sent when they are not empty.
+     * Sending a PreparedAction made from it only
+     * copies the text with the slots filled in, no property is parsed or
+     * looked up again.
+     * <p/>
+     * A template is immutable and can be shared by several threads.
+     */
+    class ActionTemplate {
+    public:
+        /**
+         * @param prototype the action to serialize, owned by the template,
+         * which also uses it to build the responses.
+         * @param parameters the keys of the properties given on each send.
+         */
+        ActionTemplate(ManagerAction* prototype, const std::vector<std::string>& parameters);
+        virtual ~ActionTemplate();
+
+        const std::string& getAction() const;
+        size_t getParameterCount() const;
+        const std::string& getParameterName(size_t index) const;
+
+        /**
+         * Returns the index of the parameter named key, case insensitively,
+         * or getParameterCount() if there is none.
+         */
+        size_t getParameterIndex(const std::string& key) const;
+
+    private:
+        friend class PreparedAction;
+
+        struct Slot {
+            // where the value goes in text
+            size_t offset;
+            // index in parameters, parameters.size() for the ActionID
+            size_t parameter;
+            // start of the line of a parameter left out when empty, npos
+            // for the ones always sent
+            size_t optionalLine;
+        };
+
+        ManagerAction* prototype;
+        std::vector<std::string> parameters;
+        // values of the parameters in the prototype
+        std::vector<std::string> defaults;
+        std::string text;
+        std::vector<Slot> slots;
+
+        ActionTemplate(const ActionTemplate&);
+        ActionTemplate& operator=(const ActionTemplate&);
+
+        void checkParameter(size_t index) const;
+
+        void serialize(std::string& out, const std::string& actionId, const std::vector<std::string>& values) const;
+    };
+
+    typedef boost::shared_ptr<const ActionTemplate> ActionTemplatePtr;
+
+    /**
+     * Action sent from an ActionTemplate, only its parameters are set.<p>
+     * The parameters start with the values of the prototype. They are not
+     * properties, getProperty does not see them.
+     */
+    class PreparedAction : public AbstractManagerAction {
+    public:
+        PreparedAction(const ActionTemplatePtr& actionTemplate);
+        virtual ~PreparedAction();
+
+        virtual const std::string& getAction() const;
+        virtual void serialize(std::string& out) const;
+        virtual ManagerResponse* expectedResponce(const std::string& response);
+
+        const ActionTemplatePtr& getTemplate() const;
+
+        /**
+         * Gets or sets the value of a parameter.
+         * @throws IndexOutOfBoundsException if there is no such parameter.
+         */
+        const std::string& getParameter(size_t index) const;
+        const std::string& getParameter(const std::string& key) const;
+
+        void setParameter(size_t index, const std::string& value);
+        void setParameter(const std::string& key, const std::string& value);
+
+    private:
+        ActionTemplatePtr actionTemplate;
+        std::vector<std::string> values;
+    };
+
+}
+
+#endif /* PREPAREDACTION_H_ */
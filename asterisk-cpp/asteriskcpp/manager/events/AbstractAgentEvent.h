@@ -9,6 +9,7 @@
 #define ABSTRACTAGENTEVENT_H_
 
 #include "asteriskcpp/manager/events/ManagerEvent.h"
+#include <map>
 
 namespace asteriskcpp {
 
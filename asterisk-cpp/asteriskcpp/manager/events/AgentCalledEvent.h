@@ -9,6 +9,7 @@
 #define AGENTCALLEDEVENT_H_
 
 #include "asteriskcpp/manager/events/ManagerEvent.h"
+#include <map>
 
 namespace asteriskcpp {
 
@@ -8,7 +8,8 @@
 #ifndef MANAGEREVENT_H_
 #define MANAGEREVENT_H_
 
-#include "../../structs/PropertyMap.h"
+#include "../PropertyKeys.h"
+#include "../EventTypes.h"
 #include <ctime>
 
 namespace asteriskcpp {
@@ -24,12 +25,25 @@ namespace asteriskcpp {
      * Event.
      */
     class ManagerEvent : public PropertyMap {
+        friend class EventBuilder;
+        friend class EventPool;
+
     public:
         ManagerEvent();
         ManagerEvent(const std::string& values);
         virtual ~ManagerEvent();
 
-        virtual const std::string getEventName() const;
+        /**
+         * Returns the name of the event, i.e. "NewChannel" for a
+         * NewChannelEvent or the "Event:" value of an event without class.
+         */
+        virtual const std::string& getEventName() const;
+
+        /**
+         * Returns the type of the event, EVENT_UNKNOWN for events without
+         * class.
+         */
+        EventType getEventType() const;
 
         unsigned long getInternalNumber() const;
 
@@ -73,7 +87,8 @@ namespace asteriskcpp {
         /**
          * Returns the name of the Asterisk server from which this event has been received.
          * <p/>
-         * This property is only available when using to AstManProxy.
+         * This property is only available when using to AstManProxy, or when
+         * the connection was given a name, see ManagerConnection::setServerName.
          *
          * @return the name of the Asterisk server from which this event has been received
          *         or <code>null</code> when directly connected to an Asterisk server
@@ -140,6 +155,13 @@ namespace asteriskcpp {
     protected:
         time_t received;
         unsigned long internalNumber;
+        EventType eventType;
+
+    private:
+        // name of the connection, see EventBuilder::setServer
+        const std::string* server;
+
+        void stamp();
     };
 
 }
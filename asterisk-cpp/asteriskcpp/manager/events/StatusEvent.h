@@ -9,6 +9,7 @@
 #define STATUSEVENT_H_
 
 #include "ResponseEvent.h"
+#include <map>
 
 namespace asteriskcpp {
 
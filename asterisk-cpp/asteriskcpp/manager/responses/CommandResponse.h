@@ -28,6 +28,8 @@ namespace asteriskcpp {
         CommandResponse(const std::string& responseStr);
         virtual ~CommandResponse();
 
+        virtual void loadFrame(const SlabView& frame);
+
         /**
          * Returns the AMI authorization class of this response.
          *
@@ -9,7 +9,7 @@
 #define MANAGERRESPONSE_H_
 
 #include <map>
-#include "../../structs/PropertyMap.h"
+#include "../PropertyKeys.h"
 
 namespace asteriskcpp {
 
@@ -31,6 +31,13 @@ namespace asteriskcpp {
         ManagerResponse(const std::string& responseStr);
         virtual ~ManagerResponse();
 
+        /**
+         * Loads the properties of a response frame, see
+         * PropertyMap::convertFrame. Subclasses deriving more from the
+         * properties do it here as well as in their constructor.
+         */
+        virtual void loadFrame(const SlabView& frame);
+
         Type getType();
 
         bool inline isTypeSuccess() {
@@ -0,0 +1,111 @@
+/*
+ * IOReactor.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef IOREACTOR_H_
+#define IOREACTOR_H_
+
+#include <map>
+#include <vector>
+#include <boost/thread.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "asteriskcpp/structs/Thread.h"
+#include "asteriskcpp/structs/Singleton.h"
+
+namespace asteriskcpp {
+
+    /**
+     * Receives the readiness notifications of a file descriptor registered on
+     * an IOReactor.
+     */
+    class IOHandler {
+    public:
+        virtual ~IOHandler();
+
+        /**
+         * Called from the reactor thread when the descriptor has data to read,
+         * was closed or is in error, or after resume. It must not block, the
+         * thread serves all the descriptors.
+         */
+        virtual void onReadable() = 0;
+    };
+
+    /**
+     * epoll based I/O loop.<p>
+     * One thread blocks until any registered descriptor is readable, so a
+     * single reactor serves any number of ManagerConnection's.
+     * The thread is started with the first registration. The handlers are
+     * called without any lock held, a handler that can not take what it read
+     * pauses its descriptor until it is resumed.
+     */
+    class IOReactor : public Thread, public Singleton<IOReactor> {
+        friend class Singleton<IOReactor>;
+
+    public:
+        IOReactor();
+        virtual ~IOReactor();
+
+        /**
+         * Starts watching fd, h is called on every read readiness until remove.
+         */
+        void add(int fd, IOHandler* h);
+
+        /**
+         * Stops notifying h.<p>
+         * When called from another thread, returns only after a running
+         * notification has finished, so the handler can be deleted right away.
+         */
+        void remove(IOHandler* h);
+
+        /**
+         * Stops watching the descriptor of h until resume, for a handler that
+         * can not take more data for now.
+         */
+        void pause(IOHandler* h);
+
+        /**
+         * Watches the descriptor of h again and calls h once from the reactor
+         * thread, even if nothing new was received. Can be called from any
+         * thread.
+         */
+        void resume(IOHandler* h);
+
+        virtual void stop();
+        virtual void run();
+
+    private:
+        using Thread::start;
+
+        struct Registration {
+            IOHandler* handler;
+            bool paused;
+
+            Registration(IOHandler* handler = NULL) :
+            handler(handler), paused(false) {
+            }
+        };
+        typedef std::map<int, Registration> handlersMap_t;
+
+        int epollFD;
+        int wakeFD;
+        bool running;
+        handlersMap_t handlers;
+        // the handlers to call after resume
+        std::vector<IOHandler*> resumed;
+        // the handler being called, remove waits for it
+        IOHandler* busy;
+        boost::mutex handlersMutex;
+        boost::condition_variable idle;
+
+        void wakeup();
+        handlersMap_t::iterator find(IOHandler* h);
+        void notify(IOHandler* h);
+        void resumeHandlers();
+    };
+
+}
+
+#endif /* IOREACTOR_H_ */
@@ -14,9 +14,11 @@
 #include <assert.h>
 #include <string.h>
 #include <iostream>
+#include <vector>
 #include <boost/thread.hpp>
 #ifdef _WIN32
 #include <winsock2.h>
+#include <ws2tcpip.h>
 #else
 #include <netdb.h>
 #include <net/if.h>
@@ -27,9 +29,12 @@
 
 namespace asteriskcpp {
 
+    /**
+     * IPv4 or IPv6 address and port.
+     */
     class IPAddress {
     private:
-        int ip;
+        struct sockaddr_storage address;
         std::string host;
         unsigned short port;
         static boost::mutex mut;
@@ -39,29 +44,60 @@ namespace asteriskcpp {
         IPAddress(unsigned short port);
         IPAddress(int ip, unsigned short port);
         IPAddress(const std::string& host, unsigned short port);
+        IPAddress(const struct sockaddr* address, socklen_t length);
         IPAddress(const IPAddress& ipAddress);
         ~IPAddress();
 
+        IPAddress& operator=(const IPAddress& ipAddress);
+
+        /**
+         * Returns every address of host, IPv6 and IPv4, in the order
+         * getaddrinfo prefers them. Names are looked up once per resolve
+         * cache time.
+         * @throws UnknownHostException if host has no address.
+         */
+        static std::vector<IPAddress> resolve(const std::string& host, unsigned short port);
+
+        /**
+         * Sets for how many seconds names stay resolved, 0 disables the
+         * cache. 60 by default.
+         */
+        static void setResolveCacheTime(unsigned int seconds);
+        static unsigned int getResolveCacheTime();
+        static void clearResolveCache();
+
         void setHost(const std::string& host);
         void setIP(int ip);
         void setPort(unsigned short port);
 
         std::string getHost() const;
+
+        /**
+         * Returns the IPv4 address, 0 for an IPv6 one.
+         */
         int getIP() const;
         unsigned short getPort() const;
 
+        /**
+         * AF_INET or AF_INET6.
+         */
+        int getFamily() const;
+        const struct sockaddr* getSockAddr() const;
+        socklen_t getSockAddrLength() const;
+
         operator const bool() {
-            return (ip != 0);
+            return (getIP() != 0 || getFamily() == AF_INET6);
         }
 
         //not a full comparison (args ignored)
 
         friend inline bool operator !=(const IPAddress& a, const IPAddress& b) {
-            return (a.ip != b.ip || a.port != b.port);
+            return (!(a == b));
         }
 
         friend inline bool operator ==(const IPAddress& a, const IPAddress& b) {
-            return (a.ip == b.ip && a.port == b.port);
+            return (a.port == b.port && a.getSockAddrLength() == b.getSockAddrLength()
+                    && memcmp(a.getSockAddr(), b.getSockAddr(), a.getSockAddrLength()) == 0);
         }
 
         friend std::ostream& operator<<(std::ostream& os, IPAddress& o) {
@@ -75,6 +111,7 @@ namespace asteriskcpp {
         }
 
     private:
+        void setAddress(const struct sockaddr* address, socklen_t length);
         void resolveAddr();
         void toStringAddr();
         void getLocalIP();
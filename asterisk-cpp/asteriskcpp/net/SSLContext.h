@@ -9,10 +9,12 @@
 #ifdef _WIN32
 #include <winsock2.h>
 #endif
+#include <map>
 #include <vector>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <boost/thread.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "../exceptions/RuntimeException.h"
 
@@ -24,6 +26,10 @@ namespace asteriskcpp {
     private:
         SSL_CTX* ctx;
 
+        /* last session of each server, resumed by the next connection */
+        std::map<std::string, SSL_SESSION*> sessions;
+        boost::mutex sessionsMutex;
+
         static bool sslInit;
         static std::string password2check;
         static std::vector<boost::mutex*> mutexVector;
@@ -32,6 +38,11 @@ namespace asteriskcpp {
         static boost::mutex mut;
 
     public:
+        /**
+         * Client context verifying the servers against the system
+         * certificate authorities.
+         */
+        SSLContext();
         SSLContext(const std::string& certFileList);
         SSLContext(const std::string& keyFile, const std::string& certFile, const std::string& pass);
         SSLContext(const std::string& keyFile, const std::string& certFile, const std::string& certFileList, const std::string& pass,
@@ -40,7 +51,27 @@ namespace asteriskcpp {
 
         SSL_CTX* getContext();
 
+        /**
+         * Returns a reference to the last session of server, NULL if none.
+         * The caller frees it with SSL_SESSION_free.
+         */
+        SSL_SESSION* getSession(const std::string& server);
+        void clearSessions();
+
+        /**
+         * Asks OpenSSL to hand the record encryption of the connections made
+         * afterwards to the kernel (Linux kTLS) once their handshake is done.
+         * The connections where the kernel, OpenSSL or the cipher do not
+         * allow it keep encrypting in OpenSSL.
+         * @return false if this OpenSSL cannot do it at all.
+         */
+        bool setKernelTLS(bool enable);
+        bool isKernelTLS();
+
     private:
+        SSLContext(const SSLContext&);
+        SSLContext& operator=(const SSLContext&);
+
         void createCTX();
         void loadKeys(const std::string& keyFile, const std::string& certFile, const std::string& pass);
         void loadCerts(const std::string& certFileList, bool requireCertification);
@@ -48,8 +79,11 @@ namespace asteriskcpp {
         static int passwordCheck(char *buffer, int num, int rwflag, void *userdata);
         static void lock(int mode, int n, const char *file, int line);
         static unsigned long getID();
+        static int newSession(SSL* ssl, SSL_SESSION* session);
     };
 
+    typedef boost::shared_ptr<SSLContext> SSLContextPtr;
+
 }
 
 #endif
@@ -9,6 +9,7 @@
 #ifdef _WIN32
 #include <winsock2.h>
 #endif
+#include <stdint.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 
@@ -18,18 +19,47 @@
 
 namespace asteriskcpp {
 
-    class SSLSocket : private TCPSocket {
+    /**
+     * TLS over a TCPSocket.<p>
+     * The descriptor is non-blocking: receive returns what can be decrypted
+     * without waiting, as TCPSocket::receive does, and writes wait for the
+     * socket with poll. Each socket has its own lock around its SSL calls,
+     * so that reading and writing threads can share it, sockets do not wait
+     * for each other.
+     */
+    class SSLSocket : public TCPSocket {
     private:
         SSL *ssl;
         bool certified;
         SSLContext* sslContext;
+        // key of the sessions of the server, alive as long as ssl
+        std::string server;
+        boost::mutex sslMutex;
+        // the kernel encrypts the records (kTLS), writes are plain sends
+        bool kernelSend;
+        bool kernelReceive;
 
     public:
         SSLSocket(SSLContext* sslContext, const int socketFD);
         SSLSocket(SSLContext* sslContext, const IPAddress& ipAddress);
 
+        /**
+         * Connects as TCPSocket does, then handshakes with serverName, within
+         * connectTimeout as well. The certificate of the server must be valid
+         * for serverName if the context verifies it. The last session to the
+         * same server and port is resumed when the server agrees.
+         */
+        SSLSocket(SSLContext* sslContext, const std::vector<IPAddress>& addresses, const std::string& serverName,
+                const unsigned long connectTimeout);
+
         ~SSLSocket();
 
+        using TCPSocket::writeData;
+
+        virtual int receive(char* buf, const unsigned int size);
+        virtual void writeData(const char* buf, const unsigned int size);
+        virtual void writeData(const std::vector<std::string>& buffers);
+
         int readEncryptedData(char* buffer, const unsigned int size);
         void writeEncryptedData(const char* buffer, const unsigned int size);
 
@@ -44,6 +74,40 @@ namespace asteriskcpp {
         IPAddress getPeerAddress();
 
         bool isCertifiedConnection();
+
+        /**
+         * Tells whether the handshake resumed a previous session.
+         */
+        bool isSessionReused();
+
+        /**
+         * Tells whether the kernel encrypts what is written, when the context
+         * enables it (see SSLContext::setKernelTLS) and the kernel supports
+         * the cipher. Writes are then plain sends on the socket.
+         */
+        bool isKernelSend();
+
+        /**
+         * Tells whether the kernel decrypts what is read. Reads still go
+         * through OpenSSL, which takes the records other than data, as
+         * session tickets. OpenSSL before 3.2 does not offload the reading
+         * side of TLS 1.3. A key update the server asks for fails the read
+         * when the kernel sends, its keys cannot follow.
+         */
+        bool isKernelReceive();
+
+    private:
+        /**
+         * Handshakes by the connect deadline of TCPSocket, connect and
+         * handshake share the one timeout.
+         */
+        void connectSSL(const std::string& serverName);
+        void freeSSL();
+        void writeAll(const char* buf, const size_t size);
+        void checkKernelTLS();
+        void sendAll(const char* buf, const size_t size, const int flags);
+        bool waitFor(short events, uint64_t deadline);
+        std::string getError(const std::string& what);
     };
 
 }
@@ -9,6 +9,7 @@
 #define TCPSOCKET_H_
 
 #include <errno.h>
+#include <stdint.h>
 #include <string.h>
 #ifdef _WIN32
 #include <io.h>
@@ -21,6 +22,8 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #endif
+#include <string>
+#include <vector>
 #include <boost/thread/mutex.hpp>
 
 #include "IPAddress.h"
@@ -39,17 +42,53 @@ namespace asteriskcpp {
         IPAddress peerAddress;
         struct timeval timeout;
 
+        /**
+         * When the connect timeout runs out (see TimerWheel::now), UINT64_MAX
+         * without one. What connect left of it is the handshake time of
+         * SSLSocket.
+         */
+        uint64_t connectDeadline;
+
+        void setBlocking(const bool blocking);
+
     public:
         TCPSocket();
         TCPSocket(const int socketFD);
-        TCPSocket(const IPAddress& ipAddress);
+
+        /**
+         * Connects to ipAddress, giving up after connectTimeout milliseconds.
+         */
+        TCPSocket(const IPAddress& ipAddress, const unsigned long connectTimeout = NO_TIMEOUT);
+
+        /**
+         * Connects to the first of addresses to answer, happy eyeballs style
+         * (RFC 8305): an attempt starts every CONNECT_ATTEMPT_DELAY, or as
+         * soon as the previous one fails, the pending ones race each other.
+         * IPv6 and IPv4 addresses take turns, a broken family costs one delay
+         * only.
+         * @param connectTimeout for all the attempts in milliseconds,
+         * NO_TIMEOUT waits as long as the system does.
+         */
+        TCPSocket(const std::vector<IPAddress>& addresses, const unsigned long connectTimeout);
         virtual ~TCPSocket();
 
         int readData(char* buf, const unsigned int size);
+
+        /**
+         * Reads the data already available without waiting.
+         * @return the number of bytes read, 0 if nothing was available.
+         */
+        virtual int receive(char* buf, const unsigned int size);
         std::string readData();
-        void writeData(const char* buf, const unsigned int size);
+        virtual void writeData(const char* buf, const unsigned int size);
         void writeData(const std::string& data);
 
+        /**
+         * Writes the buffers one after the other, in as few system calls as
+         * possible (writev), and without other data in between.
+         */
+        virtual void writeData(const std::vector<std::string>& buffers);
+
         void setTimeout(const unsigned long timeout);
         unsigned long getTimeout();
 
@@ -64,6 +103,7 @@ namespace asteriskcpp {
         int getSocketFD();
 
     private:
+        void connect(const std::vector<IPAddress>& addresses, const unsigned long connectTimeout);
         void resolvePeerAddr();
         void resolveLocalAddr();
     };
@@ -0,0 +1,173 @@
+/*
+ * BlockingRingQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef BLOCKINGRINGQUEUE_H_
+#define BLOCKINGRINGQUEUE_H_
+
+#include "asteriskcpp/structs/RingQueue.h"
+#include <vector>
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * RingQueue with one consumer thread that sleeps while it is empty.<p>
+     * put and take stay lock free, the mutex is only taken to park the
+     * consumer when the queue is empty, or a producer when it is full: a slow
+     * consumer then slows its producers down instead of letting the backlog
+     * grow. Producers that must not wait use tryPut, they are called back
+     * when there is room again.
+     */
+    template<typename T> class BlockingRingQueue {
+    public:
+        typedef boost::function<void () > SpaceCallback;
+
+        BlockingRingQueue(size_t capacity) :
+        queue(capacity), consumerWaiting(false), producersWaiting(0) {
+        }
+
+        virtual ~BlockingRingQueue() {
+            boost::mutex::scoped_lock lock(mutex);
+            notEmpty.notify_all();
+            notFull.notify_all();
+        }
+
+        void put(const T& value) {
+            if (!queue.tryPush(value)) {
+                boost::mutex::scoped_lock lock(mutex);
+                producersWaiting++;
+                // pairs with the fence of notifyProducers
+                boost::atomic_thread_fence(boost::memory_order_seq_cst);
+                while (!queue.tryPush(value)) {
+                    // the consumer notifies under the mutex, the wake up can not be missed
+                    notFull.wait(lock);
+                }
+                producersWaiting--;
+            }
+            notifyConsumer();
+        }
+
+        /**
+         * Puts value and returns true if there is room, never waits.
+         */
+        bool tryPut(const T& value) {
+            if (!queue.tryPush(value)) {
+                return (false);
+            }
+            notifyConsumer();
+            return (true);
+        }
+
+        /**
+         * Puts value and returns true if there is room. Otherwise returns
+         * false, and onSpace is called from the consumer thread once it took
+         * values out; it must not block.
+         */
+        bool tryPut(const T& value, const SpaceCallback& onSpace) {
+            if (!queue.tryPush(value)) {
+                boost::mutex::scoped_lock lock(mutex);
+                spaceCallbacks.push_back(onSpace);
+                producersWaiting++;
+                boost::atomic_thread_fence(boost::memory_order_seq_cst);
+                if (!queue.tryPush(value)) {
+                    return (false);
+                }
+                // room was made meanwhile
+                spaceCallbacks.pop_back();
+                producersWaiting--;
+            }
+            notifyConsumer();
+            return (true);
+        }
+
+        /**
+         * Moves up to max values to batch, waits for one if there are none.
+         */
+        void take(std::vector<T>& batch, size_t max) {
+            T value;
+            for (;;) {
+                while (batch.size() < max && queue.tryPop(value)) {
+                    batch.push_back(value);
+                }
+                if (!batch.empty()) {
+                    notifyProducers();
+                    break;
+                }
+
+                boost::mutex::scoped_lock lock(mutex);
+                consumerWaiting.store(true);
+                if (queue.tryPop(value)) {
+                    consumerWaiting.store(false);
+                    batch.push_back(value);
+                    continue;
+                }
+                // put notifies under the mutex, the wake up can not be missed
+                notEmpty.wait(lock);
+                consumerWaiting.store(false);
+            }
+        }
+
+        /**
+         * Returns false if the queue is empty, never waits.
+         */
+        bool tryTake(T& value) {
+            if (!queue.tryPop(value)) {
+                return (false);
+            }
+            notifyProducers();
+            return (true);
+        }
+
+    private:
+        RingQueue<T> queue;
+        boost::mutex mutex;
+        boost::condition_variable notEmpty;
+        boost::condition_variable notFull;
+        boost::atomic<bool> consumerWaiting;
+        // producers waiting in put plus the callbacks of tryPut
+        boost::atomic<int> producersWaiting;
+        std::vector<SpaceCallback> spaceCallbacks;
+
+        void notifyConsumer() {
+            // pairs with the store of consumerWaiting in take
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (consumerWaiting.load(boost::memory_order_relaxed)) {
+                boost::mutex::scoped_lock lock(mutex);
+                notEmpty.notify_one();
+            }
+        }
+
+        /**
+         * Called after values were taken out, wakes the producers waiting
+         * for room.
+         */
+        void notifyProducers() {
+            // a producer either sees the room or is seen waiting
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            if (producersWaiting.load(boost::memory_order_relaxed) == 0) {
+                return;
+            }
+
+            std::vector<SpaceCallback> callbacks;
+            {
+                boost::mutex::scoped_lock lock(mutex);
+                notFull.notify_all();
+                callbacks.swap(spaceCallbacks);
+                producersWaiting -= (int) callbacks.size();
+            }
+            for (typename std::vector<SpaceCallback>::iterator it = callbacks.begin(); it != callbacks.end(); ++it) {
+                (*it)();
+            }
+        }
+
+        BlockingRingQueue(const BlockingRingQueue&);
+        BlockingRingQueue& operator=(const BlockingRingQueue&);
+    };
+
+}
+
+#endif /* BLOCKINGRINGQUEUE_H_ */
@@ -0,0 +1,80 @@
+/*
+ * BufferSlab.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef BUFFERSLAB_H_
+#define BUFFERSLAB_H_
+
+#include <string>
+#include <cstddef>
+#include <boost/shared_ptr.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * Fixed size block of memory the Reader receives socket data into.<p>
+     * Slabs are reference counted: every frame cut out of a slab keeps it alive
+     * through a SlabView, so data goes from the socket to the dispatch threads
+     * without being copied.
+     */
+    class BufferSlab {
+    public:
+        BufferSlab(size_t capacity);
+        ~BufferSlab();
+
+        char* data();
+        const char* data() const;
+        size_t capacity() const;
+
+    private:
+        char* buffer;
+        size_t size;
+
+        BufferSlab(const BufferSlab&);
+        BufferSlab& operator=(const BufferSlab&);
+    };
+
+    typedef boost::shared_ptr<BufferSlab> BufferSlabPtr;
+
+    /**
+     * Read only window over a part of a BufferSlab.<p>
+     * Copying a view only bumps the slab reference count.
+     */
+    class SlabView {
+    public:
+        SlabView();
+        SlabView(const BufferSlabPtr& slab, size_t offset, size_t length);
+
+        /**
+         * Creates a view over a private copy of the given string, used for
+         * messages that are not received from the socket (time outs...).
+         */
+        static SlabView fromString(const std::string& str);
+
+        const char* data() const;
+        size_t length() const;
+        bool empty() const;
+
+        SlabView sub(size_t offset, size_t length = std::string::npos) const;
+
+        /**
+         * Returns the position of the first occurrence of str at or after from
+         * or std::string::npos if not found.
+         */
+        size_t find(const char* str, size_t from = 0) const;
+
+        bool istartsWith(const char* prefix) const;
+
+        std::string str() const;
+
+    private:
+        BufferSlabPtr slab;
+        const char* ptr;
+        size_t len;
+    };
+
+}
+
+#endif /* BUFFERSLAB_H_ */
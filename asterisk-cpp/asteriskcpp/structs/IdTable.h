@@ -0,0 +1,162 @@
+/*
+ * IdTable.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef IDTABLE_H_
+#define IDTABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace asteriskcpp {
+
+    /**
+     * Open addressing hash table from non zero 64 bit ids to pointers.<p>
+     * Linear probing in a power of 2 array kept at most half full, erasing
+     * shifts the following entries back instead of leaving tombstones, so a
+     * lookup is a multiply and a few adjacent compares.
+     * <p/>
+     * Not thread safe.
+     */
+    template<typename V> class IdTable {
+    public:
+
+        IdTable(size_t capacity = 64) :
+        count(0) {
+            size_t size = 8;
+            while (size < capacity * 2) {
+                size <<= 1;
+            }
+            entries.resize(size);
+        }
+
+        /**
+         * Stores value under id, replacing the previous one.
+         */
+        void insert(uint64_t id, V* value) {
+            if ((count + 1) * 2 > entries.size()) {
+                grow();
+            }
+            size_t i = indexOf(id);
+            while (entries[i].id != 0 && entries[i].id != id) {
+                i = (i + 1) & (entries.size() - 1);
+            }
+            if (entries[i].id == 0) {
+                count++;
+            }
+            entries[i].id = id;
+            entries[i].value = value;
+        }
+
+        /**
+         * Returns the value of id, NULL if there is none.
+         */
+        V* find(uint64_t id) const {
+            for (size_t i = indexOf(id); entries[i].id != 0; i = (i + 1) & (entries.size() - 1)) {
+                if (entries[i].id == id) {
+                    return (entries[i].value);
+                }
+            }
+            return (NULL);
+        }
+
+        /**
+         * Removes id and returns its value, NULL if there is none.
+         */
+        V* erase(uint64_t id) {
+            size_t mask = entries.size() - 1;
+            size_t i = indexOf(id);
+            while (entries[i].id != id) {
+                if (entries[i].id == 0) {
+                    return (NULL);
+                }
+                i = (i + 1) & mask;
+            }
+            V* value = entries[i].value;
+            count--;
+
+            // moves back the entries that probed past the freed one
+            for (size_t j = (i + 1) & mask; entries[j].id != 0; j = (j + 1) & mask) {
+                size_t home = indexOf(entries[j].id);
+                if (((j - home) & mask) >= ((j - i) & mask)) {
+                    entries[i] = entries[j];
+                    i = j;
+                }
+            }
+            entries[i] = Entry();
+            return (value);
+        }
+
+        size_t size() const {
+            return (count);
+        }
+
+        bool empty() const {
+            return (count == 0);
+        }
+
+        /**
+         * Appends every value to values.
+         */
+        void values(std::vector<V*>& values) const {
+            for (typename std::vector<Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                if (it->id != 0) {
+                    values.push_back(it->value);
+                }
+            }
+        }
+
+        /**
+         * Appends every id with its value to items.
+         */
+        void items(std::vector<std::pair<uint64_t, V*> >& items) const {
+            for (typename std::vector<Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                if (it->id != 0) {
+                    items.push_back(std::make_pair(it->id, it->value));
+                }
+            }
+        }
+
+        void clear() {
+            entries.assign(entries.size(), Entry());
+            count = 0;
+        }
+
+    private:
+
+        struct Entry {
+            uint64_t id;
+            V* value;
+
+            Entry() :
+            id(0), value(NULL) {
+            }
+        };
+
+        std::vector<Entry> entries;
+        size_t count;
+
+        size_t indexOf(uint64_t id) const {
+            // Fibonacci hashing, sequential ids spread over the whole array
+            return ((size_t) ((id * 0x9E3779B97F4A7C15ull) >> 32) & (entries.size() - 1));
+        }
+
+        void grow() {
+            std::vector<Entry> old;
+            old.swap(entries);
+            entries.resize(old.size() * 2);
+            count = 0;
+            for (typename std::vector<Entry>::const_iterator it = old.begin(); it != old.end(); ++it) {
+                if (it->id != 0) {
+                    insert(it->id, it->value);
+                }
+            }
+        }
+    };
+
+}
+
+#endif /* IDTABLE_H_ */
@@ -9,66 +9,145 @@
 #define PROPERTYMAP_H_
 
 #include "asteriskcpp/utils/StringUtils.h"
+#include "asteriskcpp/structs/BufferSlab.h"
 #include <iostream>
 #include <sstream>
 #include <string>
-#include <list>
-#include <map>
+#include <vector>
+#include <deque>
 #include <typeinfo>
+#include <stdint.h>
+#include <boost/atomic.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/utility/string_ref.hpp>
 
-/*
- * Comparator for case-insensitive comparison in STL assos. containers
- * case-independent (ci) compare_less binary function
- */
-struct ci_less : std::binary_function<std::string&, std::string&, bool> {
+namespace asteriskcpp {
 
-    struct nocase_compare : public std::binary_function<unsigned char, unsigned char, bool> {
+    /**
+     * Property name with its case-folded hash computed at compile time, see
+     * PropertyKeys.h.
+     */
+    class PropertyKey {
+    public:
 
-        bool operator()(const unsigned char& c1, const unsigned char& c2) const {
-            return (tolower(c1) < tolower(c2));
+        template<size_t N>
+        constexpr PropertyKey(const char (&name)[N]) :
+        name(name), length(N - 1), hash(hashOf(name, N - 1, 2166136261u)) {
         }
-    };
 
-    bool operator()(const std::string & s1, const std::string & s2) const {
-        return (std::lexicographical_compare(s1.begin(), s1.end(), // source range
-                s2.begin(), s2.end(), // dest range
-                nocase_compare())); // comparison
-    }
-};
+        const char* const name;
+        const size_t length;
+        const uint32_t hash;
+
+        static constexpr char lower(char c) {
+            return (c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+        }
 
-typedef std::map<const std::string, std::string, ci_less> propertyMap;
-typedef const std::pair<const std::string, std::string> propertyPair;
-typedef std::list<std::string> propertyIndex;
+    private:
 
-namespace asteriskcpp {
+        static constexpr uint32_t hashOf(const char* str, size_t n, uint32_t hash) {
+            return (n == 0 ? hash : hashOf(str + 1, n - 1, (hash ^ (uint32_t) (unsigned char) lower(*str)) * 16777619u));
+        }
+    };
 
+    /**
+     * Ordered list of "Key: Value" properties.<p>
+     * Properties are kept as spans over the text they were parsed from: either
+     * the AMI frame itself (see convertFrame) or a single local buffer, so
+     * loading a frame costs no allocation per field. Keys are compared case
+     * insensitively through a precomputed hash.
+     * <p/>
+     * Repeated keys (i.e. several "Variable:" lines) are all kept, getProperty
+     * returns the last one and getProperties all of them.
+     * <p/>
+     * A changed value is written over the previous one when it fits, the
+     * local buffer is compacted once it is mostly left over values, so an
+     * object changed over and over keeps the same size. A reference returned
+     * by a getter then shows the new value.
+     * <p/>
+     * Several threads may read the same object without locking: an attached
+     * frame is parsed once, by the first reader needing it, and the values
+     * getters return are materialized once per field. Those first accesses
+     * only take a spin lock. Changes must not run concurrently with reads.
+     */
     class PropertyMap {
     public:
         PropertyMap();
         PropertyMap(const std::string& str);
+        PropertyMap(const PropertyMap& other);
+        PropertyMap& operator=(const PropertyMap& other);
         virtual ~PropertyMap();
 
         virtual const std::string toString() const;
         std::string toLog() const;
 
+        /**
+         * Appends the "Key: Value" lines of the properties to out, as
+         * toString does without the ending empty line.
+         */
+        void appendProperties(std::string& out) const;
+
         const std::string& getGetterValue(const char *functionName) const;
 
         template<class T> T getGetterValue(const char *functionName) const {
             return (convertFromString<T>(getProperty(func2property(functionName))));
         }
 
+        const std::string& getGetterValue(const PropertyKey& key) const;
+
+        template<class T> T getGetterValue(const PropertyKey& key) const {
+            return (convertFromString<T>(getGetterValue(key)));
+        }
+
         const std::string& getProperty(const std::string& key) const;
 
+        /**
+         * Returns the value of key with no copy, as a view over the frame or
+         * the local buffer. It stays valid until the object is changed.
+         */
+        boost::string_ref getPropertyView(const std::string& key) const;
+        boost::string_ref getPropertyView(const PropertyKey& key) const;
+
         template<class T> T getProperty(const std::string& key) const {
             if (typeid (T) == typeid (bool)) {
                 return (stringToBool(getProperty(key)));
             }
             return (convertFromString<T>(getProperty(key)));
         }
-    protected:
-        propertyIndex index;
-        propertyMap values;
 
+        /**
+         * Returns every value stored under key, in the order they were added.
+         */
+        std::vector<std::string> getProperties(const std::string& key) const;
+
+        bool hasProperty(const std::string& key) const;
+
+        /**
+         * Loads the properties of an AMI frame.<p>
+         * The values stay in the frame slab, which is released with this
+         * object.
+         */
+        void convertFrame(const SlabView& frame);
+
+        /**
+         * Same as convertFrame but the frame is only parsed the first time a
+         * property is read or written.
+         */
+        void attachFrame(const SlabView& frame);
+
+        /**
+         * Decodes key from a frame given to attachFrame without parsing the
+         * rest of it, reading key alone then costs no full parse. To be called
+         * before the object is shared with other threads.
+         */
+        void preloadProperty(const PropertyKey& key);
+
+        /**
+         * Case insensitive FNV-1a hash of a property key.
+         */
+        static uint32_t hashKey(const char* key, size_t length);
+
+    protected:
         virtual const std::string getClassName() const;
 
         void setSetterValue(const char *functionName, const std::string& value);
@@ -77,6 +156,12 @@ namespace asteriskcpp {
             setProperty(func2property(functionName), value);
         }
 
+        void setSetterValue(const PropertyKey& key, const std::string& value);
+
+        template<class T> void setSetterValue(const PropertyKey& key, T value) {
+            setSetterValue(key, convertToString(value));
+        }
+
         void setProperty(const std::string& key, const std::string& value);
 
         template<class T> void setProperty(const std::string& key, const T& t) {
@@ -86,10 +171,66 @@ namespace asteriskcpp {
         static std::string makeStdLine(const std::string& key, const std::string& value);
 
         void convertStr(const std::string& propertyStr);
+
+        /**
+         * Removes every property and releases the frame, the memory used for
+         * the fields and cached values is kept for the next properties.
+         */
+        void reset();
     private:
 
-        void addProperty(const std::string& key, const std::string& value);
-        void editProperty(const std::string& key, const std::string& value);
+        struct Field {
+            uint32_t hash;
+            uint32_t keyOffset;
+            uint32_t keyLength;
+            uint32_t valueOffset;
+            uint32_t valueLength;
+            bool local;
+            // the value handed out by the getters, NULL until asked for
+            mutable boost::atomic<const std::string*> cached;
+            // entry of cache the value is materialized in, kept when it changes
+            mutable uint32_t slot;
+
+            Field();
+            Field(const Field& other);
+            Field& operator=(const Field& other);
+        };
+
+        typedef boost::container::small_vector<Field, 16> fieldsList_t;
+
+        SlabView frame;
+        std::string buffer;
+        // bytes of buffer no field refers to any more
+        size_t dead;
+        fieldsList_t fields;
+        // decoded by preloadProperty, searched until the frame is parsed
+        fieldsList_t preloaded;
+        // frame given to attachFrame and not parsed yet
+        mutable boost::atomic<bool> pending;
+
+        // getters hand out references, values are materialized on first access, one entry per field
+        mutable std::deque<std::string> cache;
+        // entries of cache given to a field, the others are kept for their capacity
+        mutable size_t cacheUsed;
+        // taken to parse the frame or to materialize a value, the first time only
+        mutable boost::atomic_flag spin;
+
+        const char* base(const Field& field) const;
+        const Field* findField(const char* key, size_t length, uint32_t hash) const;
+        const Field* findField(const fieldsList_t& list, const char* key, size_t length, uint32_t hash) const;
+        const Field* lookupField(const char* key, size_t length, uint32_t hash) const;
+        const std::string& lookup(const char* key, size_t length, uint32_t hash) const;
+        boost::string_ref view(const Field* field) const;
+        void parseFrame();
+        void ensureParsed() const;
+        void lock() const;
+        void unlock() const;
+        void parse(const char* data, size_t offset, size_t length, bool local);
+        void addField(fieldsList_t& list, size_t keyOffset, size_t keyLength, size_t valueOffset, size_t valueLength, bool local);
+        void storeProperty(const char* key, size_t length, uint32_t hash, const std::string& value);
+        void addProperty(const char* key, size_t length, const std::string& value);
+        void editProperty(Field& field, const std::string& value);
+        void compact();
         static const std::string func2property(const char *functionName);
 
     };
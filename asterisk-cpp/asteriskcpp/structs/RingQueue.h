@@ -0,0 +1,129 @@
+/*
+ * RingQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef RINGQUEUE_H_
+#define RINGQUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <boost/atomic.hpp>
+
+#define RING_QUEUE_CACHE_LINE 64
+
+namespace asteriskcpp {
+
+    /**
+     * Bounded lock free queue, any number of producers and consumers.<p>
+     * Every cell carries a sequence number telling whether it is free for
+     * the producer or filled for the consumer of a given turn, so a push or a
+     * pop is one compare and swap on its own index and no lock.
+     * <p/>
+     * A value being pushed is not seen by consumers until the push is over,
+     * tryPop may then return false while the queue is not quite empty.
+     */
+    template<typename T> class RingQueue {
+    public:
+
+        /**
+         * capacity is rounded up to a power of 2.
+         */
+        RingQueue(size_t capacity) {
+            size_t size = 2;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            mask = size - 1;
+            cells = new Cell[size];
+            for (size_t i = 0; i < size; i++) {
+                cells[i].sequence.store(i, boost::memory_order_relaxed);
+            }
+            enqueuePos.store(0, boost::memory_order_relaxed);
+            dequeuePos.store(0, boost::memory_order_relaxed);
+        }
+
+        ~RingQueue() {
+            delete[] cells;
+        }
+
+        size_t capacity() const {
+            return (mask + 1);
+        }
+
+        /**
+         * Returns false if the queue is full.
+         */
+        bool tryPush(const T& value) {
+            Cell* cell;
+            size_t pos = enqueuePos.load(boost::memory_order_relaxed);
+            for (;;) {
+                cell = &cells[pos & mask];
+                size_t sequence = cell->sequence.load(boost::memory_order_acquire);
+                intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+                if (diff == 0) {
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, boost::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return (false);
+                } else {
+                    pos = enqueuePos.load(boost::memory_order_relaxed);
+                }
+            }
+            cell->value = value;
+            cell->sequence.store(pos + 1, boost::memory_order_release);
+            return (true);
+        }
+
+        /**
+         * Returns false if the queue is empty.
+         */
+        bool tryPop(T& value) {
+            Cell* cell;
+            size_t pos = dequeuePos.load(boost::memory_order_relaxed);
+            for (;;) {
+                cell = &cells[pos & mask];
+                size_t sequence = cell->sequence.load(boost::memory_order_acquire);
+                intptr_t diff = (intptr_t) sequence - (intptr_t) (pos + 1);
+                if (diff == 0) {
+                    if (dequeuePos.compare_exchange_weak(pos, pos + 1, boost::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return (false);
+                } else {
+                    pos = dequeuePos.load(boost::memory_order_relaxed);
+                }
+            }
+            value = cell->value;
+            // the cell must not keep what the value refers to alive
+            cell->value = T();
+            cell->sequence.store(pos + mask + 1, boost::memory_order_release);
+            return (true);
+        }
+
+    private:
+
+        struct Cell {
+            boost::atomic<size_t> sequence;
+            T value;
+        };
+
+        Cell* cells;
+        size_t mask;
+        // producers and consumers each write their own cache line
+        char pad0[RING_QUEUE_CACHE_LINE];
+        boost::atomic<size_t> enqueuePos;
+        char pad1[RING_QUEUE_CACHE_LINE];
+        boost::atomic<size_t> dequeuePos;
+        char pad2[RING_QUEUE_CACHE_LINE];
+
+        RingQueue(const RingQueue&);
+        RingQueue& operator=(const RingQueue&);
+    };
+
+}
+
+#endif /* RINGQUEUE_H_ */
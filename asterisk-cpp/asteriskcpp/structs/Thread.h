@@ -22,6 +22,11 @@ namespace asteriskcpp {
         virtual void run();
         virtual void operator ()();
 
+        /**
+         * Returns true if called from the thread running this object.
+         */
+        bool isCurrent() const;
+
     protected:
         void setMustStop(volatile bool stop);
         bool isStoped();
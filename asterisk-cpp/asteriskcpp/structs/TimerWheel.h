@@ -0,0 +1,99 @@
+/*
+ * TimerWheel.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef TIMERWHEEL_H_
+#define TIMERWHEEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace asteriskcpp {
+
+    /**
+     * Hashed timer wheel on the monotonic clock.<p>
+     * Timers are kept in intrusive lists, one per slot of tick milliseconds:
+     * scheduling and cancelling are O(1) whatever the number of timers and
+     * a timer expires at most one tick late, once. A deadline further than
+     * one turn of the wheel waits in its slot for the right turn.
+     * <p/>
+     * Not thread safe, the owner serializes the calls.
+     */
+    class TimerWheel {
+    public:
+
+        /**
+         * Entry of the wheel, inherited by the objects that need a deadline.
+         */
+        class Timer {
+        public:
+            Timer();
+            virtual ~Timer();
+
+            bool isScheduled() const;
+
+        private:
+            friend class TimerWheel;
+            Timer* prev;
+            Timer* next;
+            uint64_t deadline;
+        };
+
+        TimerWheel(unsigned int tick = 10, size_t slots = 512);
+        virtual ~TimerWheel();
+
+        /**
+         * Schedules timer to expire in timeout milliseconds, from now when
+         * not given.
+         */
+        void schedule(Timer* timer, unsigned int timeout);
+        void schedule(Timer* timer, unsigned int timeout, uint64_t now);
+
+        /**
+         * Unschedules timer, does nothing if it is not scheduled.
+         */
+        void cancel(Timer* timer);
+
+        /**
+         * Unschedules every timer.
+         */
+        void clear();
+
+        /**
+         * Moves the timers expired at now to expired, they are unscheduled.
+         */
+        void advance(uint64_t now, std::vector<Timer*>& expired);
+
+        /**
+         * Returns when advance should be called next: the tick of the
+         * earliest deadline, UINT64_MAX if no timer is scheduled. It visits
+         * every slot at worst.
+         */
+        uint64_t getNextTick() const;
+
+        size_t size() const;
+
+        /**
+         * Returns the monotonic clock in milliseconds.
+         */
+        static uint64_t now();
+
+    private:
+        std::vector<Timer> slots;
+        unsigned int tick;
+        // first tick not processed yet
+        uint64_t current;
+        size_t count;
+
+        Timer& slotOf(uint64_t tickNumber);
+
+        TimerWheel(const TimerWheel&);
+        TimerWheel& operator=(const TimerWheel&);
+    };
+
+}
+
+#endif /* TIMERWHEEL_H_ */
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <iostream>
 #include <log4cplus/logger.h>
+#include <boost/atomic.hpp>
 
 #include "asteriskcpp/structs/Singleton.h"
 
@@ -21,19 +22,19 @@ enum LogLevel {
 
 #if !defined(DISABLE_LOG_HANDLER) && !defined(DISABLE_LOG_TOTAL)
 
-#define LOG_TRACE_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_TRACE_STR(sstream.str());}
-#define LOG_DEBUG_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_DEBUG_STR(sstream.str());}
-#define LOG_INFO_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_INFO_STR(sstream.str());}
-#define LOG_WARN_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_WARN_STR(sstream.str());}
-#define LOG_ERROR_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_ERROR_STR(sstream.str());}
-#define LOG_FATA_DATA(stream) {std::stringstream sstream; sstream << stream; LOG_FATAL_STR(sstream.str());}
+#define LOG_TRACE_DATA(stream) {if (LogHandler::isEnabled(LL_TRACE)) {std::stringstream sstream; sstream << stream; LOG_TRACE_STR(sstream.str());}}
+#define LOG_DEBUG_DATA(stream) {if (LogHandler::isEnabled(LL_DEBUG)) {std::stringstream sstream; sstream << stream; LOG_DEBUG_STR(sstream.str());}}
+#define LOG_INFO_DATA(stream) {if (LogHandler::isEnabled(LL_INFO)) {std::stringstream sstream; sstream << stream; LOG_INFO_STR(sstream.str());}}
+#define LOG_WARN_DATA(stream) {if (LogHandler::isEnabled(LL_WARN)) {std::stringstream sstream; sstream << stream; LOG_WARN_STR(sstream.str());}}
+#define LOG_ERROR_DATA(stream) {if (LogHandler::isEnabled(LL_ERROR)) {std::stringstream sstream; sstream << stream; LOG_ERROR_STR(sstream.str());}}
+#define LOG_FATA_DATA(stream) {if (LogHandler::isEnabled(LL_FATAL)) {std::stringstream sstream; sstream << stream; LOG_FATAL_STR(sstream.str());}}
 
-#define LOG_TRACE_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_TRACE);}
-#define LOG_DEBUG_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_DEBUG);}
-#define LOG_INFO_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_INFO);}
-#define LOG_WARN_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_WARN);}
-#define LOG_ERROR_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_ERROR);}
-#define LOG_FATAL_STR(line) {LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_FATAL);}
+#define LOG_TRACE_STR(line) {if (LogHandler::isEnabled(LL_TRACE)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_TRACE);}
+#define LOG_DEBUG_STR(line) {if (LogHandler::isEnabled(LL_DEBUG)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_DEBUG);}
+#define LOG_INFO_STR(line) {if (LogHandler::isEnabled(LL_INFO)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_INFO);}
+#define LOG_WARN_STR(line) {if (LogHandler::isEnabled(LL_WARN)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_WARN);}
+#define LOG_ERROR_STR(line) {if (LogHandler::isEnabled(LL_ERROR)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_ERROR);}
+#define LOG_FATAL_STR(line) {if (LogHandler::isEnabled(LL_FATAL)) LogHandler::getInstance()->log(std::string(__PRETTY_FUNCTION__)+std::string(": ")+line,LL_FATAL);}
 
 #elif defined(DISABLE_LOG_HANDLER) &&  !defined(DISABLE_LOG_TOTAL)
 
@@ -86,7 +87,17 @@ namespace asteriskcpp {
 
         void reopenFile();
 
+        /**
+         * Tells whether lines of level are logged, the LOG_ macros build
+         * their line only then.
+         */
+        static bool isEnabled(LogLevel level) {
+            return (level >= threshold.load(boost::memory_order_relaxed));
+        }
+
     private:
+        static boost::atomic<int> threshold;
+
         LogHandler();
         LogHandler(const std::string& confFile);
         void setup();
@@ -0,0 +1,84 @@
+/*
+ * ActionBatch.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/ActionBatch.h"
+
+namespace asteriskcpp {
+
+    ActionBatch::ActionBatch(size_t size) :
+    total(size), completed(0), failed(0) {
+    }
+
+    ActionBatch::~ActionBatch() {
+    }
+
+    size_t ActionBatch::size() const {
+        return (total);
+    }
+
+    size_t ActionBatch::getCompleted() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (completed);
+    }
+
+    size_t ActionBatch::getFailed() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (failed);
+    }
+
+    bool ActionBatch::isDone() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (completed == total);
+    }
+
+    void ActionBatch::wait() {
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (completed < total) {
+            this->m_cond.wait(lock);
+        }
+    }
+
+    bool ActionBatch::wait(unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (completed < total) {
+            if (!this->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        return (completed == total);
+    }
+
+    void ActionBatch::complete(bool success) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        completed++;
+        if (!success) {
+            failed++;
+        }
+        if (completed == total) {
+            this->m_cond.notify_all();
+        }
+    }
+
+    BatchResponseCallBack::BatchResponseCallBack(ManagerAction* a, unsigned int tout, const responseCallbackFunction_t& f, const ActionBatchPtr& batch) :
+    ASyncResponseCallBack(a, tout, f), batch(batch), fired(false) {
+    }
+
+    BatchResponseCallBack::~BatchResponseCallBack() {
+        // dropped without a response, i.e. the connection was closed
+        if (!this->fired) {
+            this->batch->complete(false);
+        }
+    }
+
+    void BatchResponseCallBack::fireCallBack(ManagerResponse* mr) {
+        bool success = !this->isTimeout && mr->isTypeSuccess();
+        this->fired = true;
+        ASyncResponseCallBack::fireCallBack(mr);
+        this->batch->complete(success);
+    }
+
+}
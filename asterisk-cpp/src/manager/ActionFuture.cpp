@@ -0,0 +1,158 @@
+/*
+ * ActionFuture.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/ActionFuture.h"
+#include <boost/thread/thread.hpp>
+
+namespace asteriskcpp {
+
+    class ActionFuture::State {
+    public:
+        ActionCompletionPtr completion;
+        ManagerResponse* response;
+        // the response is set, the continuations may still be running
+        bool responded;
+        // the continuations ran, the waiting threads may go on
+        bool ready;
+        // the thread running the continuations, they may wait for the response
+        boost::thread::id completer;
+        std::vector<responseCallbackFunction_t> continuations;
+
+        State(const ActionCompletionPtr& completion) :
+        completion(completion), response(NULL), responded(false), ready(false) {
+        }
+
+        ~State() {
+            delete response;
+        }
+
+        bool available() const {
+            return (ready || (responded && completer == boost::this_thread::get_id()));
+        }
+    };
+
+    ActionFuture::ActionFuture() {
+    }
+
+    ActionFuture::ActionFuture(const ActionCompletionPtr& completion) :
+    state(new State(completion)) {
+    }
+
+    bool ActionFuture::isValid() const {
+        return (state.get() != NULL);
+    }
+
+    bool ActionFuture::isReady() const {
+        if (!isValid()) {
+            return (false);
+        }
+        boost::lock_guard<boost::mutex> lock(state->completion->m_mutex);
+        return (state->ready);
+    }
+
+    void ActionFuture::wait() const {
+        if (!isValid()) {
+            return;
+        }
+        boost::unique_lock<boost::mutex> lock(state->completion->m_mutex);
+        // woken by any action of the connection, the shared condition tells nothing
+        while (!state->available()) {
+            state->completion->m_cond.wait(lock);
+        }
+    }
+
+    bool ActionFuture::wait(unsigned int timeout) const {
+        if (!isValid()) {
+            return (false);
+        }
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(state->completion->m_mutex);
+        while (!state->available()) {
+            if (!state->completion->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        return (state->available());
+    }
+
+    ManagerResponse* ActionFuture::get() const {
+        wait();
+        return (isValid() ? state->response : NULL);
+    }
+
+    const ActionFuture& ActionFuture::then(const responseCallbackFunction_t& continuation) const {
+        if (!isValid() || !continuation) {
+            return (*this);
+        }
+        {
+            boost::lock_guard<boost::mutex> lock(state->completion->m_mutex);
+            if (!state->ready) {
+                state->continuations.push_back(continuation);
+                return (*this);
+            }
+        }
+        continuation(state->response);
+        return (*this);
+    }
+
+    void ActionFuture::complete(ManagerResponse* mr) const {
+        {
+            boost::lock_guard<boost::mutex> lock(state->completion->m_mutex);
+            state->response = mr;
+            // set first, a continuation may read the response of this future
+            state->responded = true;
+            state->completer = boost::this_thread::get_id();
+        }
+
+        for (;;) {
+            std::vector<responseCallbackFunction_t> continuations;
+            {
+                boost::lock_guard<boost::mutex> lock(state->completion->m_mutex);
+                if (state->continuations.empty()) {
+                    // the waiting threads are woken up once the continuations ran
+                    state->ready = true;
+                    state->completer = boost::thread::id();
+                    state->completion->m_cond.notify_all();
+                    return;
+                }
+                // those added meanwhile run next, in order
+                continuations.swap(state->continuations);
+            }
+            for (std::vector<responseCallbackFunction_t>::iterator it = continuations.begin(); it != continuations.end(); ++it) {
+                (*it)(mr);
+            }
+        }
+    }
+
+    ManagerResponse* ActionFuture::release() const {
+        wait();
+        boost::lock_guard<boost::mutex> lock(state->completion->m_mutex);
+        ManagerResponse* mr = state->response;
+        state->response = NULL;
+        return (mr);
+    }
+
+    FutureResponseCallBack::FutureResponseCallBack(ManagerAction* a, unsigned int tout, const ActionFuture& future, bool ownsAction) :
+    ResponseCallBack(a, tout), future(future), ownsAction(ownsAction), fired(false) {
+    }
+
+    FutureResponseCallBack::~FutureResponseCallBack() {
+        // dropped without a response, the waiting threads get NULL
+        if (!this->fired) {
+            this->future.complete(NULL);
+        }
+        if (this->ownsAction) {
+            delete this->action;
+        }
+    }
+
+    void FutureResponseCallBack::fireCallBack(ManagerResponse* mr) {
+        LOG_TRACE_STR("FutureResponseCallBack :" + mr->toLog());
+        this->fired = true;
+        this->future.complete(mr);
+    }
+
+}
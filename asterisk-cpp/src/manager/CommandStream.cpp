@@ -0,0 +1,188 @@
+/*
+ * CommandStream.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/CommandStream.h"
+#include <string.h>
+
+#define OVERFLOW_MESSAGE "Overflow"
+
+namespace asteriskcpp {
+
+    CommandStream::CommandStream() :
+    received(0), capacity(0), headers(true), complete(false), canceled(false) {
+    }
+
+    CommandStream::~CommandStream() {
+    }
+
+    bool CommandStream::nextLine(std::string& line) {
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (lines.empty() && !complete) {
+            this->m_cond.wait(lock);
+        }
+        if (lines.empty()) {
+            return (false);
+        }
+        line.swap(lines.front());
+        lines.pop_front();
+        this->m_cond.notify_all();
+        return (true);
+    }
+
+    bool CommandStream::nextLine(std::string& line, unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (lines.empty() && !complete) {
+            if (!this->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        if (lines.empty()) {
+            return (false);
+        }
+        line.swap(lines.front());
+        lines.pop_front();
+        this->m_cond.notify_all();
+        return (true);
+    }
+
+    bool CommandStream::wait(unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (!complete) {
+            if (!this->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        return (complete);
+    }
+
+    void CommandStream::cancel() {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        canceled = true;
+        lines.clear();
+        this->m_cond.notify_all();
+    }
+
+    bool CommandStream::isComplete() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (complete);
+    }
+
+    bool CommandStream::isSuccess() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (complete && message.empty());
+    }
+
+    std::string CommandStream::getMessage() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (message);
+    }
+
+    size_t CommandStream::getReceived() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (received);
+    }
+
+    size_t CommandStream::getCapacity() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (capacity);
+    }
+
+    void CommandStream::setCapacity(size_t capacity) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        this->capacity = capacity;
+        this->m_cond.notify_all();
+    }
+
+    void CommandStream::append(const char* data, size_t length) {
+        // parts end with a whole line, the last one has no "\n"
+        size_t pos = 0;
+        while (pos < length) {
+            const char* lineEnd = (const char*) memchr(data + pos, '\n', length - pos);
+            size_t lineLength = (lineEnd != NULL ? lineEnd - data : length) - pos;
+            const char* line = data + pos;
+            pos += lineLength + 1;
+
+            // headers end with "\r\n", the output lines with "\n"
+            if (headers && lineLength > 0 && line[lineLength - 1] == '\r' && memchr(line, ':', lineLength) != NULL) {
+                continue;
+            }
+            headers = false;
+            addLine(line, lineLength);
+        }
+    }
+
+    void CommandStream::addLine(const char* data, size_t length) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        received++;
+        if (canceled || complete) {
+            return;
+        }
+        if (capacity > 0 && lines.size() >= capacity) {
+            // called from the dispatch of the responses, which must not wait
+            this->message = OVERFLOW_MESSAGE;
+            complete = true;
+            this->m_cond.notify_all();
+            return;
+        }
+        lines.push_back(std::string(data, length));
+        this->m_cond.notify_all();
+    }
+
+    void CommandStream::finish() {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        complete = true;
+        this->m_cond.notify_all();
+    }
+
+    void CommandStream::fail(const std::string& message) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (complete) {
+            return;
+        }
+        this->message = message.empty() ? "Failed" : message;
+        complete = true;
+        this->m_cond.notify_all();
+    }
+
+    CommandStreamCallBack::CommandStreamCallBack(ManagerAction* a, unsigned int tout, const CommandStreamPtr& stream) :
+    ResponseCallBack(a, tout), stream(stream), fired(false) {
+    }
+
+    CommandStreamCallBack::~CommandStreamCallBack() {
+        // dropped before the end of the output, i.e. on disconnect
+        if (!this->fired) {
+            this->stream->fail("Disconnected");
+        }
+        delete this->action;
+    }
+
+    void CommandStreamCallBack::fireCallBack(ManagerResponse* mr) {
+        this->fired = true;
+        if (mr->isTypeSuccess()) {
+            // servers without Follows responses give one "Output:" line per line
+            std::vector<std::string> output = mr->getProperties("Output");
+            for (std::vector<std::string>::const_iterator it = output.begin(); it != output.end(); ++it) {
+                this->stream->addLine(it->data(), it->length());
+            }
+            this->stream->finish();
+        } else {
+            this->stream->fail(mr->getGetterValue(keys::Message));
+        }
+        delete mr;
+    }
+
+    void CommandStreamCallBack::append(const SlabView& part) {
+        this->stream->append(part.data(), part.length());
+    }
+
+    void CommandStreamCallBack::complete() {
+        this->fired = true;
+        this->stream->finish();
+    }
+
+}
@@ -1,41 +1,63 @@
 
 #include "asteriskcpp/manager/Dispatcher.h"
 #include "asteriskcpp/utils/LogHandler.h"
+#include <boost/bind.hpp>
+
+#define BATCH_SIZE 256
 
 namespace asteriskcpp {
 
-    MessageTable::~MessageTable() {
-        boost::mutex::scoped_lock lock(this->mutex);
-        this->condition.notify_all();
+    MessageTable::MessageTable(size_t capacity) :
+    BlockingRingQueue<DispatchMessage>(capacity) {
     }
 
-    void MessageTable::put(std::string message) {
-        boost::mutex::scoped_lock lock(this->mutex);
-        try {
-            this->messageQueue.push(message);
-        } catch (std::bad_alloc& e) {
-            LOG_ERROR_STR("catch bad_alloc.");
-        }
-        this->condition.notify_all();
+    MessageTable::~MessageTable() {
     }
 
-    std::string MessageTable::take() {
-        boost::mutex::scoped_lock lock(this->mutex);
 
-        while (this->messageQueue.size() <= 0) {
-            this->condition.wait(lock);
-        }
+    /**
+     * Marker queued by DispatchGroup::detach, both threads reach it once
+     * what was queued before is done.
+     */
+    struct DispatchBarrier {
+        boost::mutex mutex;
+        boost::condition_variable cond;
+        int pending;
+        // set when nobody waits, the last thread to arrive attaches the
+        // dispatcher back and deletes the barrier
+        DispatchGroup* group;
+        Dispatcher* dispatcher;
 
-        std::string message = this->messageQueue.front();
-        this->messageQueue.pop();
-        this->condition.notify_all();
+        DispatchBarrier(int pending, DispatchGroup* group = NULL, Dispatcher* dispatcher = NULL) :
+        pending(pending), group(group), dispatcher(dispatcher) {
+        }
 
-        return message;
-    }
+        void arrive() {
+            {
+                boost::mutex::scoped_lock lock(mutex);
+                pending--;
+                if (group == NULL) {
+                    cond.notify_all();
+                    return;
+                }
+                if (pending > 0) {
+                    return;
+                }
+            }
+            group->attach(dispatcher);
+            delete this;
+        }
 
+        void wait() {
+            boost::mutex::scoped_lock lock(mutex);
+            while (pending > 0) {
+                cond.wait(lock);
+            }
+        }
+    };
 
-    DispatchThread::DispatchThread(MessageTable* mt, Dispatcher* d)
-        : messageTable(mt), dispatcher(d)
+    DispatchThread::DispatchThread(MessageTable* mt, const DispatchGroup* g)
+        : messageTable(mt), group(g)
     {
     }
 
@@ -49,15 +71,107 @@ namespace asteriskcpp {
     }
 
     void DispatchThread::run() {
-        static int LOOP_INTERVAL = 10;
-        boost::posix_time::milliseconds duration(LOOP_INTERVAL);
-        boost::this_thread::sleep<boost::posix_time::milliseconds>(duration);
-        {
-            //boost::this_thread::disable_interruption di;
-            {
-                std::string message = this->messageTable->take();
-                this->fireDispatch(message);
+        // everything available is dispatched before parking again
+        this->messageTable->take(batch, BATCH_SIZE);
+        for (std::vector<DispatchMessage>::iterator it = batch.begin(); it != batch.end(); ++it) {
+            if (it->barrier != NULL) {
+                it->barrier->arrive();
+            } else {
+                dispatch(*it);
             }
         }
+        batch.clear();
+    }
+
+    void DispatchThread::dispatch(const DispatchMessage& message) {
+        if (!group->isDetached(message.dispatcher)) {
+            this->fireDispatch(message);
+        }
+    }
+
+    DispatchGroup::DispatchGroup(size_t capacity) :
+    responseMessages(capacity), eventMessages(capacity), responseThread(NULL), eventThread(NULL), detachedCount(0) {
+        responseThread = new ResponseDispatchThread(&responseMessages, this);
+        responseThread->start();
+        eventThread = new EventDispatchThread(&eventMessages, this);
+        eventThread->start();
+    }
+
+    DispatchGroup::~DispatchGroup() {
+        responseThread->stop();
+        eventThread->stop();
+        delete (responseThread);
+        delete (eventThread);
+    }
+
+    void DispatchGroup::put(MessageTable& messages, DispatchThread* thread, const DispatchMessage& message) {
+        if (!thread->isCurrent()) {
+            messages.put(message);
+        } else if (!messages.tryPut(message)) {
+            // the thread would wait for itself
+            thread->dispatch(message);
+        }
+    }
+
+    void DispatchGroup::putResponse(Dispatcher* d, const SlabView& frame, bool partial) {
+        put(responseMessages, responseThread, DispatchMessage(d, frame, partial));
+    }
+
+    void DispatchGroup::putEvent(Dispatcher* d, const SlabView& frame) {
+        put(eventMessages, eventThread, DispatchMessage(d, frame));
+    }
+
+    bool DispatchGroup::tryPutResponse(const DispatchMessage& message, const MessageTable::SpaceCallback& onSpace) {
+        return (responseMessages.tryPut(message, onSpace));
+    }
+
+    bool DispatchGroup::tryPutEvent(const DispatchMessage& message, const MessageTable::SpaceCallback& onSpace) {
+        return (eventMessages.tryPut(message, onSpace));
+    }
+
+    void DispatchGroup::detach(Dispatcher* d) {
+        {
+            boost::mutex::scoped_lock lock(detachedMutex);
+            detached.insert(d);
+            detachedCount++;
+        }
+
+        if (responseThread->isCurrent() || eventThread->isCurrent()) {
+            // the barrier would wait for this very thread
+            DispatchBarrier* barrier = new DispatchBarrier(2, this, d);
+            putBarrier(&responseMessages, barrier);
+            putBarrier(&eventMessages, barrier);
+            return;
+        }
+
+        // the queues are in order, what was queued for d is skipped before
+        DispatchBarrier barrier(2);
+        DispatchMessage marker;
+        marker.barrier = &barrier;
+        responseMessages.put(marker);
+        eventMessages.put(marker);
+        barrier.wait();
+        attach(d);
+    }
+
+    void DispatchGroup::putBarrier(MessageTable* messages, DispatchBarrier* barrier) {
+        DispatchMessage marker;
+        marker.barrier = barrier;
+        // a full queue is retried from its thread once it made room
+        messages->tryPut(marker, boost::bind(&DispatchGroup::putBarrier, this, messages, barrier));
+    }
+
+    void DispatchGroup::attach(Dispatcher* d) {
+        boost::mutex::scoped_lock lock(detachedMutex);
+        detached.erase(detached.find(d));
+        detachedCount--;
+    }
+
+    bool DispatchGroup::isDetached(Dispatcher* d) const {
+        if (detachedCount.load() == 0) {
+            return (false);
+        }
+        boost::mutex::scoped_lock lock(detachedMutex);
+        return (detached.count(d) > 0);
     }
 }
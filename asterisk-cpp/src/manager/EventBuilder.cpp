@@ -6,180 +6,75 @@
  */
 
 #include "asteriskcpp/manager/EventBuilder.h"
-#include <stdlib.h>
-#include <map>
-#include "asteriskcpp/utils/StringUtils.h"
+#include "asteriskcpp/manager/EventRegistry.h"
 
-#include "asteriskcpp/manager/Events.hpp"
+#define DEFAULT_POOL_SIZE 32
 
 namespace asteriskcpp {
 
-    EventBuilder::EventBuilder() {
-        RegisterClass<AgentCallbackLoginEvent>();
-        RegisterClass<AgentCallbackLogoffEvent>();
-        RegisterClass<AgentCalledEvent>();
-        RegisterClass<AgentCompleteEvent>();
-        RegisterClass<AgentConnectEvent>();
-        RegisterClass<AgentDumpEvent>();
-        RegisterClass<AgentLoginEvent>();
-        RegisterClass<AgentLogoffEvent>();
-        RegisterClass<AgentRingNoAnswer>();
-        RegisterClass<AgentsCompleteEvent>();
-        RegisterClass<AgentsEvent>();
-        RegisterClass<AgiExecEvent>();
-        RegisterClass<AlarmClearEvent>();
-        RegisterClass<AlarmEvent>();
-        RegisterClass<AsyncAgiEvent>();
-        RegisterClass<BridgeEvent>();
-        RegisterClass<BridgeExecEvent>();
-        RegisterClass<CdrEvent>();
-        RegisterClass<ChannelReloadEvent>();
-        RegisterClass<ChannelUpdateEvent>();
-        RegisterClass<ConfbridgeEndEvent>();
-        RegisterClass<ConfbridgeJoinEvent>();
-        RegisterClass<ConfbridgeLeaveEvent>();
-        RegisterClass<ConfbridgeListCompleteEvent>();
-        RegisterClass<ConfbridgeListEvent>();
-        RegisterClass<ConfbridgeListRoomsCompleteEvent>();
-        RegisterClass<ConfbridgeListRoomsEvent>();
-        RegisterClass<ConfbridgeStartEvent>();
-        RegisterClass<ConfbridgeTalkingEvent>();
-        RegisterClass<ConnectEvent>();
-        RegisterClass<CoreShowChannelEvent>();
-        RegisterClass<CoreShowChannelsCompleteEvent>();
-        RegisterClass<DahdiShowChannelsCompleteEvent>();
-        RegisterClass<DahdiShowChannelsEvent>();
-        RegisterClass<DbGetResponseEvent>();
-        RegisterClass<DialEvent>();
-        RegisterClass<DisconnectEvent>();
-        RegisterClass<DndStateEvent>();
-        RegisterClass<DtmfEvent>();
-        RegisterClass<ExtensionStatusEvent>();
-        RegisterClass<FaxDocumentStatusEvent>();
-        RegisterClass<FaxReceivedEvent>();
-        RegisterClass<FaxStatusEvent>();
-        RegisterClass<FullyBootedEvent>();
-        RegisterClass<HangupEvent>();
-        RegisterClass<HoldEvent>();
-        RegisterClass<HoldedCallEvent>();
-        RegisterClass<JabberEventEvent>();
-        RegisterClass<JitterBufStatsEvent>();
-        RegisterClass<JoinEvent>();
-        RegisterClass<LeaveEvent>();
-        RegisterClass<LinkEvent>();
-        RegisterClass<ListDialplanEvent>();
-        RegisterClass<LogChannelEvent>();
-        RegisterClass<MasqueradeEvent>();
-        RegisterClass<MeetMeEndEvent>();
-        RegisterClass<MeetMeJoinEvent>();
-        RegisterClass<MeetMeLeaveEvent>();
-        RegisterClass<MeetMeMuteEvent>();
-        RegisterClass<MeetMeTalkingEvent>();
-        RegisterClass<MeetMeStopTalkingEvent>();
-        RegisterClass<MeetMeTalkingRequestEvent>();
-        RegisterClass<MessageWaitingEvent>();
-        RegisterClass<ModuleLoadReportEvent>();
-        RegisterClass<MonitorStartEvent>();
-        RegisterClass<MonitorStopEvent>();
-        RegisterClass<MusicOnHoldEvent>();
-        RegisterClass<NewAccountCodeEvent>();
-        RegisterClass<NewCallerIdEvent>();
-        RegisterClass<NewChannelEvent>();
-        RegisterClass<NewExtenEvent>();
-        RegisterClass<NewStateEvent>();
-        RegisterClass<OriginateFailureEvent>();
-        RegisterClass<OriginateResponseEvent>();
-        RegisterClass<OriginateSuccessEvent>();
-        RegisterClass<ParkedCallEvent>();
-        RegisterClass<ParkedCallGiveUpEvent>();
-        RegisterClass<ParkedCallTimeOutEvent>();
-        RegisterClass<ParkedCallsCompleteEvent>();
-        RegisterClass<PeerEntryEvent>();
-        RegisterClass<PeerStatusEvent>();
-        RegisterClass<PeerlistCompleteEvent>();
-        RegisterClass<PriEventEvent>();
-        RegisterClass<ProtocolIdentifierReceivedEvent>();
-        RegisterClass<QueueCallerAbandonEvent>();
-        RegisterClass<QueueEntryEvent>();
-        RegisterClass<QueueEvent>();
-        RegisterClass<QueueMemberAddedEvent>();
-        RegisterClass<QueueMemberEvent>();
-        RegisterClass<QueueMemberPausedEvent>();
-        RegisterClass<QueueMemberPenaltyEvent>();
-        RegisterClass<QueueMemberRemovedEvent>();
-        RegisterClass<QueueMemberStatusEvent>();
-        RegisterClass<QueueParamsEvent>();
-        RegisterClass<QueueStatusCompleteEvent>();
-        RegisterClass<QueueSummaryCompleteEvent>();
-        RegisterClass<QueueSummaryEvent>();
-        RegisterClass<ReceiveFaxEvent>();
-        RegisterClass<RegistrationsCompleteEvent>();
-        RegisterClass<RegistryEntryEvent>();
-        RegisterClass<RegistryEvent>();
-        RegisterClass<ReloadEvent>();
-        RegisterClass<RenameEvent>();
-        //RegisterClass<ResponseEvent>();
-        RegisterClass<RtcpReceivedEvent>();
-        RegisterClass<RtcpSentEvent>();
-        RegisterClass<RtpReceiverStatEvent>();
-        RegisterClass<RtpSenderStatEvent>();
-        RegisterClass<SendFaxEvent>();
-        RegisterClass<SendFaxStatusEvent>();
-        RegisterClass<ShowDialplanCompleteEvent>();
-        RegisterClass<ShutdownEvent>();
-        RegisterClass<SkypeAccountStatusEvent>();
-        RegisterClass<SkypeBuddyEntryEvent>();
-        RegisterClass<SkypeBuddyListCompleteEvent>();
-        RegisterClass<SkypeBuddyStatusEvent>();
-        RegisterClass<SkypeChatMessageEvent>();
-        RegisterClass<SkypeLicenseEvent>();
-        RegisterClass<SkypeLicenseListCompleteEvent>();
-        RegisterClass<StatusCompleteEvent>();
-        RegisterClass<StatusEvent>();
-        RegisterClass<T38FaxStatusEvent>();
-        RegisterClass<TransferEvent>();
-        RegisterClass<UnholdEvent>();
-        RegisterClass<UnlinkEvent>();
-        RegisterClass<UnparkedCallEvent>();
-        //RegisterClass<UserEvent>();
-        RegisterClass<VarSetEvent>();
-        RegisterClass<VoicemailUserEntryCompleteEvent>();
-        RegisterClass<VoicemailUserEntryEvent>();
-        RegisterClass<ZapShowChannelsCompleteEvent>();
-        RegisterClass<ZapShowChannelsEvent>();
-
+    EventBuilder::EventBuilder() :
+    lazy(false), preloadUniqueId(false), eventPool(DEFAULT_POOL_SIZE) {
     }
 
     EventBuilder::~EventBuilder() {
 
     }
 
-    static std::string extractEventName(const std::string& eventStr) {
-        size_t endl = eventStr.find("\r\n");
-        if (endl != eventStr.npos) {
-            size_t sep = eventStr.find("Event: ");
-            if (sep != eventStr.npos) {
-                return (eventStr.substr(sep + 7, endl - (sep + 7)));
+    ManagerEvent* EventBuilder::buildEvent(const SlabView& frame) {
+
+        size_t endl = frame.find("\r\n");
+        if (endl == std::string::npos) {
+            endl = frame.length();
+        }
+        size_t sep = frame.find("Event: ");
+        if (sep != std::string::npos && sep + 7 < endl) {
+            const EventDescriptor* descriptor = EventRegistry::find(frame.data() + sep + 7, endl - (sep + 7));
+            //if (descriptor == NULL) LOG_WARN_STR("EVENT:INVALID OR NOT IMPLEMENTED \n" + str2Log(frame.str()));
+            ManagerEvent* event = eventPool.acquire(descriptor);
+            event->server = server.empty() ? NULL : &server;
+            // the fields are not copied, they point into the frame
+            if (lazy) {
+                event->attachFrame(frame);
+                event->preloadProperty(keys::Event);
+                if (preloadUniqueId) {
+                    event->preloadProperty(keys::UniqueId);
+                }
+            } else {
+                event->convertFrame(frame);
             }
+            return (event);
         }
-        return ("");
+
+        return (NULL);
     }
 
-    ManagerEvent* EventBuilder::buildEvent(const std::string& eventStr) {
+    void EventBuilder::releaseEvent(ManagerEvent* event) {
+        eventPool.release(event);
+    }
 
-        std::string eventName = extractEventName(eventStr);
-        if (!eventName.empty()) {
+    void EventBuilder::setLazy(bool lazy, bool preloadUniqueId) {
+        this->lazy = lazy;
+        this->preloadUniqueId = preloadUniqueId;
+    }
 
-            EnventFactoryMapType::const_iterator it = eventFactoryMap.find(eventName);
-            if (it != eventFactoryMap.end()) {
-                return ((it->second)->create(eventStr));
-            } else {
-                //LOG_WARN_STR("EVENT:INVALID OR NOT IMPLEMENTED \n" + str2Log(eventStr));
-                return (new ManagerEvent(eventStr));
-            }
-        }
+    bool EventBuilder::isLazy() const {
+        return (lazy);
+    }
 
-        return (NULL);
+    void EventBuilder::setServer(const std::string& server) {
+        this->server = server;
+    }
+
+    const std::string& EventBuilder::getServer() const {
+        return (server);
+    }
+
+    EventPool& EventBuilder::getEventPool() {
+        return (eventPool);
+    }
+
+    const EventPool& EventBuilder::getEventPool() const {
+        return (eventPool);
     }
 
 } /* namespace asterisk_cpp */
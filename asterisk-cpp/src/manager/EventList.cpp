@@ -0,0 +1,162 @@
+/*
+ * EventList.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/EventList.h"
+
+#define OVERFLOW_MESSAGE "Overflow"
+
+namespace asteriskcpp {
+
+    EventList::EventList() :
+    completeEvent(NULL), received(0), capacity(0), complete(false), canceled(false) {
+    }
+
+    EventList::~EventList() {
+        for (std::deque<ManagerEvent*>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            delete (*it);
+        }
+        delete completeEvent;
+    }
+
+    ManagerEvent* EventList::next() {
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (entries.empty() && !complete) {
+            this->m_cond.wait(lock);
+        }
+        if (entries.empty()) {
+            return (NULL);
+        }
+        ManagerEvent* event = entries.front();
+        entries.pop_front();
+        this->m_cond.notify_all();
+        return (event);
+    }
+
+    ManagerEvent* EventList::next(unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (entries.empty() && !complete) {
+            if (!this->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        if (entries.empty()) {
+            return (NULL);
+        }
+        ManagerEvent* event = entries.front();
+        entries.pop_front();
+        this->m_cond.notify_all();
+        return (event);
+    }
+
+    std::vector<ManagerEvent*> EventList::getAll() {
+        // taken as they arrive, a list with a capacity would overflow
+        std::vector<ManagerEvent*> result;
+        ManagerEvent* event;
+        while ((event = next()) != NULL) {
+            result.push_back(event);
+        }
+        return (result);
+    }
+
+    bool EventList::wait(unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (!complete) {
+            if (!this->m_cond.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        return (complete);
+    }
+
+    void EventList::cancel() {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        canceled = true;
+        for (std::deque<ManagerEvent*>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            delete (*it);
+        }
+        entries.clear();
+        this->m_cond.notify_all();
+    }
+
+    bool EventList::isComplete() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (complete);
+    }
+
+    bool EventList::isSuccess() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (complete && message.empty());
+    }
+
+    std::string EventList::getMessage() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (message);
+    }
+
+    const ManagerEvent* EventList::getCompleteEvent() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (completeEvent);
+    }
+
+    size_t EventList::getReceived() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (received);
+    }
+
+    size_t EventList::getCapacity() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (capacity);
+    }
+
+    void EventList::setCapacity(size_t capacity) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        this->capacity = capacity;
+        this->m_cond.notify_all();
+    }
+
+    void EventList::add(ManagerEvent* event) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        received++;
+        if (canceled || complete) {
+            delete event;
+            return;
+        }
+        if (capacity > 0 && entries.size() >= capacity) {
+            // called from the dispatch of the events, which must not wait
+            delete event;
+            this->message = OVERFLOW_MESSAGE;
+            complete = true;
+            this->m_cond.notify_all();
+            return;
+        }
+        entries.push_back(event);
+        this->m_cond.notify_all();
+    }
+
+    void EventList::finish(ManagerEvent* event) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (complete) {
+            delete event;
+            return;
+        }
+        completeEvent = event;
+        complete = true;
+        this->m_cond.notify_all();
+    }
+
+    void EventList::fail(const std::string& message) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (complete) {
+            return;
+        }
+        this->message = message.empty() ? "Failed" : message;
+        complete = true;
+        this->m_cond.notify_all();
+    }
+
+}
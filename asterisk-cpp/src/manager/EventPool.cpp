@@ -0,0 +1,78 @@
+/*
+ * EventPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/EventPool.h"
+#include "asteriskcpp/manager/EventRegistry.h"
+
+namespace asteriskcpp {
+
+    EventPool::EventPool(size_t maxPerType) :
+    maxPerType(maxPerType) {
+    }
+
+    EventPool::~EventPool() {
+        setMaxPerType(0);
+    }
+
+    ManagerEvent* EventPool::acquire(const EventDescriptor* descriptor) {
+        EventType type = (descriptor != NULL ? descriptor->type : EVENT_UNKNOWN);
+        ManagerEvent* event = NULL;
+        {
+            boost::mutex::scoped_lock lock(poolMutex);
+            std::vector<ManagerEvent*>& freeList = freeLists[type];
+            if (!freeList.empty()) {
+                event = freeList.back();
+                freeList.pop_back();
+            }
+        }
+
+        if (event != NULL) {
+            event->stamp();
+        } else if (descriptor != NULL) {
+            event = descriptor->create();
+        } else {
+            event = new ManagerEvent("");
+        }
+        event->eventType = type;
+        return (event);
+    }
+
+    void EventPool::release(ManagerEvent* event) {
+        // the slab of the frame is released now, not when the event is reused
+        event->reset();
+        {
+            boost::mutex::scoped_lock lock(poolMutex);
+            std::vector<ManagerEvent*>& freeList = freeLists[event->eventType];
+            if (freeList.size() < maxPerType) {
+                freeList.push_back(event);
+                return;
+            }
+        }
+        delete (event);
+    }
+
+    size_t EventPool::getMaxPerType() const {
+        return (maxPerType);
+    }
+
+    void EventPool::setMaxPerType(size_t maxPerType) {
+        std::vector<ManagerEvent*> trimmed;
+        {
+            boost::mutex::scoped_lock lock(poolMutex);
+            this->maxPerType = maxPerType;
+            for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+                while (freeLists[type].size() > maxPerType) {
+                    trimmed.push_back(freeLists[type].back());
+                    freeLists[type].pop_back();
+                }
+            }
+        }
+        for (std::vector<ManagerEvent*>::iterator it = trimmed.begin(); it != trimmed.end(); ++it) {
+            delete (*it);
+        }
+    }
+
+}
@@ -0,0 +1,141 @@
+/*
+ * EventRegistry.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/EventRegistry.h"
+#include <strings.h>
+#include <algorithm>
+#include "asteriskcpp/manager/Events.hpp"
+#include "asteriskcpp/exceptions/RuntimeException.h"
+
+#define MAX_DISPLACEMENT 1000000
+
+namespace asteriskcpp {
+
+    template<class C>
+    static ManagerEvent* createEvent() {
+        return (new C(""));
+    }
+
+    static uint32_t nextPowerOf2(uint32_t n) {
+        uint32_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return (p);
+    }
+
+    static bool biggerBucket(const std::vector<int>& a, const std::vector<int>& b) {
+        return (a.size() > b.size());
+    }
+
+    const EventDescriptor* EventRegistry::descriptors() {
+        // indexed by EventType
+        static const EventDescriptor table[] = {
+            { EVENT_UNKNOWN, "", CATEGORY_NONE, NULL },
+#define EVENT_TYPE_DESCRIPTOR(id, cls, name, category) { EVENT_##id, name, category, &createEvent<cls> },
+            ASTERISKCPP_EVENT_TYPES(EVENT_TYPE_DESCRIPTOR)
+#undef EVENT_TYPE_DESCRIPTOR
+        };
+        return (table);
+    }
+
+    uint32_t EventRegistry::slotOf(uint32_t hash, uint32_t displacement) {
+        uint32_t x = hash ^ (displacement * 0x9E3779B9u);
+        x ^= x >> 16;
+        x *= 0x85EBCA6Bu;
+        x ^= x >> 13;
+        x *= 0xC2B2AE35u;
+        x ^= x >> 16;
+        return (x);
+    }
+
+    EventRegistry::EventRegistry() {
+        const EventDescriptor* table = descriptors();
+        uint32_t count = EVENT_TYPE_COUNT - 1;
+        uint32_t bucketCount = nextPowerOf2(std::max(count / 2, 1u));
+        uint32_t slotCount = nextPowerOf2(count * 2);
+        bucketMask = bucketCount - 1;
+        slotMask = slotCount - 1;
+
+        names.reserve(EVENT_TYPE_COUNT);
+        for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+            names.push_back(std::string(table[type].name.name, table[type].name.length));
+        }
+
+        std::vector<std::vector<int> > buckets(bucketCount);
+        for (int type = 1; type < EVENT_TYPE_COUNT; type++) {
+            buckets[table[type].name.hash & bucketMask].push_back(type);
+        }
+        // the fullest buckets are placed first, while most slots are free
+        std::stable_sort(buckets.begin(), buckets.end(), biggerBucket);
+
+        displacements.assign(bucketCount, 0);
+        slots.assign(slotCount, EVENT_UNKNOWN);
+        for (uint32_t b = 0; b < bucketCount && !buckets[b].empty(); b++) {
+            const std::vector<int>& bucket = buckets[b];
+            uint32_t bucketId = table[bucket[0]].name.hash & bucketMask;
+
+            for (uint32_t d = 1;; d++) {
+                if (d > MAX_DISPLACEMENT) {
+                    Throw(RuntimeException("Event names can not be hashed, duplicated name?"));
+                }
+
+                std::vector<uint32_t> placed;
+                for (size_t i = 0; i < bucket.size(); i++) {
+                    uint32_t slot = slotOf(table[bucket[i]].name.hash, d) & slotMask;
+                    if (slots[slot] != EVENT_UNKNOWN || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+
+                if (placed.size() == bucket.size()) {
+                    for (size_t i = 0; i < bucket.size(); i++) {
+                        slots[placed[i]] = bucket[i];
+                    }
+                    displacements[bucketId] = d;
+                    break;
+                }
+            }
+        }
+    }
+
+    const EventRegistry& EventRegistry::instance() {
+        static const EventRegistry registry;
+        return (registry);
+    }
+
+    const EventDescriptor* EventRegistry::find(const char* name, size_t length) {
+        const EventRegistry& registry = instance();
+        uint32_t hash = PropertyMap::hashKey(name, length);
+        uint32_t displacement = registry.displacements[hash & registry.bucketMask];
+        if (displacement == 0) {
+            return (NULL);
+        }
+
+        const EventDescriptor& descriptor = descriptors()[registry.slots[slotOf(hash, displacement) & registry.slotMask]];
+        if (descriptor.type == EVENT_UNKNOWN || descriptor.name.hash != hash || descriptor.name.length != length
+                || strncasecmp(descriptor.name.name, name, length) != 0) {
+            return (NULL);
+        }
+        return (&descriptor);
+    }
+
+    const EventDescriptor& EventRegistry::get(EventType type) {
+        if (type < 0 || type >= EVENT_TYPE_COUNT) {
+            type = EVENT_UNKNOWN;
+        }
+        return (descriptors()[type]);
+    }
+
+    const std::string& EventRegistry::getName(EventType type) {
+        if (type < 0 || type >= EVENT_TYPE_COUNT) {
+            type = EVENT_UNKNOWN;
+        }
+        return (instance().names[type]);
+    }
+
+}
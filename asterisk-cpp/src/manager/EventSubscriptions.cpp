@@ -0,0 +1,166 @@
+/*
+ * EventSubscriptions.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/EventSubscriptions.h"
+#include <set>
+#include <ctype.h>
+#include "asteriskcpp/manager/EventRegistry.h"
+#include "asteriskcpp/exceptions/RuntimeException.h"
+
+#define MASK_ON "on"
+#define MASK_OFF "off"
+
+static const char* categoryNames[] = {"system", "call", "log", "verbose", "command", "agent", "user", "config",
+    "dtmf", "reporting", "cdr", "dialplan", "originate", "agi"};
+
+namespace asteriskcpp {
+
+    EventSubscriptions::EventSubscriptions() :
+    subscriptions(new subscriptionsMap_t()) {
+    }
+
+    EventSubscriptions::~EventSubscriptions() {
+    }
+
+    boost::shared_ptr<EventSubscriptions::subscriptionsMap_t> EventSubscriptions::copy() const {
+        return (boost::shared_ptr<subscriptionsMap_t>(new subscriptionsMap_t(*subscriptions)));
+    }
+
+    void EventSubscriptions::subscribeAll(const ManagerEventListener* listener) {
+        boost::mutex::scoped_lock lock(subscriptionsMutex);
+        boost::shared_ptr<subscriptionsMap_t> updated(copy());
+        (*updated)[listener].clear();
+        boost::atomic_store(&subscriptions, Snapshot(updated));
+    }
+
+    void EventSubscriptions::subscribe(const ManagerEventListener* listener, EventType type, const std::string& key, const std::string& pattern) {
+        Subscription subscription;
+        subscription.type = type;
+        subscription.key = key;
+        subscription.pattern = pattern;
+        if (!key.empty()) {
+            try {
+                subscription.expression = boost::regex("^(" + pattern + ")", boost::regex::extended);
+            } catch (boost::regex_error& e) {
+                Throw(IllegalArgumentException("Invalid pattern " + pattern + " - " + e.what()));
+            }
+        }
+
+        boost::mutex::scoped_lock lock(subscriptionsMutex);
+        boost::shared_ptr<subscriptionsMap_t> updated(copy());
+        (*updated)[listener].push_back(subscription);
+        boost::atomic_store(&subscriptions, Snapshot(updated));
+    }
+
+    void EventSubscriptions::unsubscribe(const ManagerEventListener* listener) {
+        boost::mutex::scoped_lock lock(subscriptionsMutex);
+        boost::shared_ptr<subscriptionsMap_t> updated(copy());
+        updated->erase(listener);
+        boost::atomic_store(&subscriptions, Snapshot(updated));
+    }
+
+    EventSubscriptions::Snapshot EventSubscriptions::getSnapshot() const {
+        return (boost::atomic_load(&subscriptions));
+    }
+
+    bool EventSubscriptions::accepts(const ManagerEventListener* listener, const ManagerEvent& event) const {
+        return (accepts(getSnapshot(), listener, event));
+    }
+
+    bool EventSubscriptions::accepts(const Snapshot& snapshot, const ManagerEventListener* listener, const ManagerEvent& event) {
+        subscriptionsMap_t::const_iterator it = snapshot->find(listener);
+        if (it == snapshot->end() || it->second.empty()) {
+            return (true);
+        }
+
+        EventType type = event.getEventType();
+        for (std::vector<Subscription>::const_iterator s = it->second.begin(); s != it->second.end(); ++s) {
+            if (s->type != type) {
+                continue;
+            }
+            if (s->key.empty()) {
+                return (true);
+            }
+            boost::string_ref value = event.getPropertyView(s->key);
+            if (boost::regex_search(value.begin(), value.end(), s->expression)) {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+    std::string EventSubscriptions::getEventMask() const {
+        Snapshot snapshot(getSnapshot());
+        int categories = CATEGORY_NONE;
+        for (subscriptionsMap_t::const_iterator it = snapshot->begin(); it != snapshot->end(); ++it) {
+            if (it->second.empty()) {
+                return (MASK_ON);
+            }
+            for (std::vector<Subscription>::const_iterator s = it->second.begin(); s != it->second.end(); ++s) {
+                categories |= EventRegistry::get(s->type).category;
+            }
+        }
+
+        if (categories == CATEGORY_NONE) {
+            return (MASK_OFF);
+        }
+        return (getCategoryNames(categories));
+    }
+
+    std::vector<std::string> EventSubscriptions::getFilters() const {
+        Snapshot snapshot(getSnapshot());
+        std::set<std::string> filters;
+        for (subscriptionsMap_t::const_iterator it = snapshot->begin(); it != snapshot->end(); ++it) {
+            if (it->second.empty()) {
+                return (std::vector<std::string>());
+            }
+            for (std::vector<Subscription>::const_iterator s = it->second.begin(); s != it->second.end(); ++s) {
+                const EventDescriptor& descriptor = EventRegistry::get(s->type);
+                if (descriptor.category == CATEGORY_NONE) {
+                    // action results are not filtered by Asterisk
+                    continue;
+                }
+
+                // Asterisk matches the whole event text, '.' matching line ends too
+                std::string filter("^" + caseless("Event") + ": " + caseless(EventRegistry::getName(s->type)) + "[[:space:]]");
+                if (!s->key.empty()) {
+                    filter.append(".*[[:space:]]" + caseless(s->key) + ": (" + s->pattern + ")");
+                }
+                filters.insert(filter);
+            }
+        }
+        return (std::vector<std::string>(filters.begin(), filters.end()));
+    }
+
+    std::string EventSubscriptions::getCategoryNames(int categories) {
+        std::string names;
+        for (size_t i = 0; i < sizeof (categoryNames) / sizeof (categoryNames[0]); i++) {
+            if (categories & (1 << i)) {
+                if (!names.empty()) {
+                    names.append(",");
+                }
+                names.append(categoryNames[i]);
+            }
+        }
+        return (names);
+    }
+
+    std::string EventSubscriptions::caseless(const std::string& text) {
+        std::string expression;
+        for (std::string::const_iterator c = text.begin(); c != text.end(); ++c) {
+            if (isalpha((unsigned char) *c)) {
+                expression.append("[");
+                expression.push_back((char) toupper((unsigned char) *c));
+                expression.push_back((char) tolower((unsigned char) *c));
+                expression.append("]");
+            } else {
+                expression.push_back(*c);
+            }
+        }
+        return (expression);
+    }
+
+}
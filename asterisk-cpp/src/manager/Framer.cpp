@@ -0,0 +1,222 @@
+/*
+ * Framer.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/Framer.h"
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include <iterator>
+
+static const char SEP[] = "\r\n\r\n";
+static const char SEPLN[] = "\r\n";
+static const char END_COMMAND[] = "\n--END COMMAND--\r\n\r\n";
+
+namespace asteriskcpp {
+
+    Framer::Framer(size_t slabSize, size_t ringSize) :
+    slabSize(slabSize), ring(ringSize), ringPos(0), begin(0), end(0), scan(0), type(FRAME_UNKNOWN), delimiter(NULL), delimiterLength(0) {
+    }
+
+    Framer::~Framer() {
+    }
+
+    size_t Framer::getMinRead() const {
+        return (slabSize / 16);
+    }
+
+    char* Framer::writePtr() {
+        prepareWrite();
+        return (slab->data() + end);
+    }
+
+    size_t Framer::writeCapacity() const {
+        if (!slab) {
+            return (0);
+        }
+        return (slab->capacity() - end);
+    }
+
+    void Framer::commit(size_t length) {
+        end += length;
+    }
+
+    void Framer::reset() {
+        slab.reset();
+        begin = end = scan = 0;
+        delimiter = NULL;
+        delimiterLength = 0;
+        type = FRAME_UNKNOWN;
+    }
+
+    void Framer::prepareWrite() {
+        if (slab && begin == end && slab.unique()) {
+            // nothing pending and no frame still in use, start over
+            begin = end = scan = 0;
+        }
+
+        if (slab && slab->capacity() - end >= getMinRead()) {
+            return;
+        }
+
+        size_t pending = (slab ? end - begin : 0);
+        BufferSlabPtr next = acquireSlab(pending + getMinRead());
+        if (pending > 0) {
+            memcpy(next->data(), slab->data() + begin, pending);
+        }
+        scan = (slab ? scan - begin : 0);
+        begin = 0;
+        end = pending;
+
+        // the old slab goes back to the ring, it will be reused once all its frames are released
+        if (slab && slab->capacity() == slabSize) {
+            for (size_t i = 0; i < ring.size(); i++) {
+                if (!ring[i]) {
+                    ring[i].swap(slab);
+                    break;
+                }
+            }
+        }
+        slab.swap(next);
+    }
+
+    BufferSlabPtr Framer::acquireSlab(size_t minSize) {
+        BufferSlabPtr next;
+        if (minSize > slabSize) {
+            // frame bigger than a slab, doubling keeps the copies linear
+            size_t capacity = slabSize;
+            while (capacity < minSize) {
+                capacity *= 2;
+            }
+            next.reset(new BufferSlab(capacity));
+            return (next);
+        }
+
+        for (size_t i = 0; i < ring.size(); i++) {
+            size_t idx = (ringPos + i) % ring.size();
+            if (!ring[idx]) {
+                ring[idx].reset(new BufferSlab(slabSize));
+            }
+            if (ring[idx].unique()) {
+                next.swap(ring[idx]);
+                ringPos = (idx + 1) % ring.size();
+                return (next);
+            }
+        }
+
+        // every slab still has frames in use
+        next.reset(new BufferSlab(slabSize));
+        return (next);
+    }
+
+    size_t Framer::search(const char* str, size_t length) {
+        const char* data = slab->data();
+        if (end - scan >= length) {
+            const char* it = std::search(data + scan, data + end, str, str + length);
+            if (it != data + end) {
+                return (it - data);
+            }
+        }
+        // a delimiter may start in the last length - 1 bytes
+        scan = std::max(scan, end - std::min(end - begin, length - 1));
+        return (std::string::npos);
+    }
+
+    bool Framer::detectType() {
+        const char* data = slab->data() + begin;
+        size_t length = end - begin;
+
+#define FRAME_STARTS_WITH(prefix) (length >= sizeof (prefix) - 1 && strncasecmp(data, prefix, sizeof (prefix) - 1) == 0)
+        if (FRAME_STARTS_WITH("Asterisk")) {
+            type = FRAME_PROTOCOL;
+            delimiter = SEPLN;
+        } else if (FRAME_STARTS_WITH("Response: Follows")) {
+            type = FRAME_FOLLOWS;
+            delimiter = END_COMMAND;
+        } else if (FRAME_STARTS_WITH("Response:")) {
+            type = FRAME_RESPONSE;
+            delimiter = SEP;
+        } else if (FRAME_STARTS_WITH("Event:")) {
+            type = FRAME_EVENT;
+            delimiter = SEP;
+        } else {
+            type = FRAME_UNKNOWN;
+            delimiter = SEP;
+        }
+#undef FRAME_STARTS_WITH
+
+        delimiterLength = strlen(delimiter);
+        scan = begin;
+        return (type != FRAME_UNKNOWN);
+    }
+
+    SlabView Framer::header(const SlabView& frame, const char* name) {
+        const char* data = frame.data();
+        size_t length = frame.length();
+        size_t nameLength = strlen(name);
+
+        for (size_t pos = 0; pos < length;) {
+            const char* lineEnd = std::search(data + pos, data + length, SEPLN, SEPLN + 2);
+            size_t lineLength = (lineEnd - data) - pos;
+            if (lineLength > nameLength && data[pos + nameLength] == ':'
+                    && strncasecmp(data + pos, name, nameLength) == 0) {
+                size_t value = pos + nameLength + 1;
+                while (value < pos + lineLength && data[value] == ' ') {
+                    value++;
+                }
+                return (frame.sub(value, pos + lineLength - value));
+            }
+            pos += lineLength + 2;
+        }
+        return (SlabView());
+    }
+
+    bool Framer::next(SlabView& frame, FrameType& frameType) {
+        if (!slab) {
+            return (false);
+        }
+
+        if (delimiter == NULL) {
+            // skip the empty lines between frames
+            const char* data = slab->data();
+            while (end - begin >= 2 && data[begin] == '\r' && data[begin + 1] == '\n') {
+                begin += 2;
+            }
+            scan = std::max(scan, begin);
+
+            // the first line tells the frame type
+            if (search(SEPLN, 2) == std::string::npos) {
+                return (false);
+            }
+            detectType();
+        }
+
+        size_t at = search(delimiter, delimiterLength);
+        if (at == std::string::npos) {
+            // no delimiter starts before scan, what precedes is whole lines of output
+            if (type == FRAME_FOLLOWS && scan - begin >= slabSize / 2) {
+                const char* data = slab->data();
+                const char* line = std::find(std::reverse_iterator<const char*>(data + scan), std::reverse_iterator<const char*>(data + begin), '\n').base();
+                if (line != data + begin) {
+                    frame = SlabView(slab, begin, (line - data) - begin);
+                    frameType = FRAME_FOLLOWS_PART;
+                    begin = line - data;
+                    return (true);
+                }
+            }
+            return (false);
+        }
+
+        frame = SlabView(slab, begin, at - begin);
+        frameType = type;
+
+        begin = at + delimiterLength;
+        scan = begin;
+        delimiter = NULL;
+        delimiterLength = 0;
+        return (true);
+    }
+
+}
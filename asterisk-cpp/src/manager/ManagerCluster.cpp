@@ -0,0 +1,233 @@
+/*
+ * ManagerCluster.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "asteriskcpp/manager/ManagerCluster.h"
+#include "asteriskcpp/exceptions/RuntimeException.h"
+#include "asteriskcpp/utils/LogHandler.h"
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+namespace asteriskcpp {
+
+    ManagerCluster::ChannelTracker::ChannelTracker(ManagerCluster* cluster) :
+    cluster(cluster) {
+    }
+
+    void ManagerCluster::ChannelTracker::onManagerEvent(const ManagerEvent& me) {
+        switch (me.getEventType()) {
+            case EVENT_NEWCHANNEL:
+                cluster->setChannelServer(me.getGetterValue(keys::Channel), me.getServer());
+                break;
+            case EVENT_RENAME:
+                cluster->removeChannel(me.getGetterValue(keys::Channel));
+                cluster->setChannelServer(me.getGetterValue(keys::Newname), me.getServer());
+                break;
+            case EVENT_HANGUP:
+                cluster->removeChannel(me.getGetterValue(keys::Channel));
+                break;
+            default:
+                break;
+        }
+    }
+
+    ManagerCluster::ManagerCluster() :
+    dispatchGroup(new DispatchGroup()), tracker(this) {
+    }
+
+    ManagerCluster::~ManagerCluster() {
+        disconnect();
+        // each one detaches from the dispatch threads, stopped afterwards
+        for (connections_t::iterator it = connections.begin(); it != connections.end(); ++it) {
+            delete (it->second);
+        }
+        connections.clear();
+    }
+
+    ManagerConnection& ManagerCluster::addServer(const std::string& key, const std::string& hostname, unsigned int port,
+            const std::string& username, const std::string& password) {
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        if (connections.find(key) != connections.end()) {
+            Throw(IllegalArgumentException("Server " + key + " already in the cluster"));
+        }
+
+        ManagerConnection* connection = new ManagerConnection();
+        connection->setHostname(hostname);
+        connection->setPort(port);
+        connection->setUsername(username);
+        connection->setPassword(password);
+        connection->setServerName(key);
+        connection->setDispatchGroup(dispatchGroup);
+        connection->addEventListener(tracker, EVENT_NEWCHANNEL);
+        connection->addEventListener(tracker, EVENT_RENAME);
+        connection->addEventListener(tracker, EVENT_HANGUP);
+        for (std::vector<Subscription>::const_iterator it = subscriptions.begin(); it != subscriptions.end(); ++it) {
+            subscribe(*connection, *it);
+        }
+        connections[key] = connection;
+        return (*connection);
+    }
+
+    ManagerConnection* ManagerCluster::getConnection(const std::string& key) const {
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        connections_t::const_iterator it = connections.find(key);
+        return (it != connections.end() ? it->second : NULL);
+    }
+
+    std::vector<std::string> ManagerCluster::getServers() const {
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        std::vector<std::string> keys;
+        for (connections_t::const_iterator it = connections.begin(); it != connections.end(); ++it) {
+            keys.push_back(it->first);
+        }
+        return (keys);
+    }
+
+    std::vector<ManagerConnection*> ManagerCluster::getConnections() const {
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        std::vector<ManagerConnection*> result;
+        for (connections_t::const_iterator it = connections.begin(); it != connections.end(); ++it) {
+            result.push_back(it->second);
+        }
+        return (result);
+    }
+
+    void ManagerCluster::connectServer(ManagerConnection* connection, const std::string& eventMask) {
+        if (!connection->isConnected() && !connection->isAuthenticated()) {
+            connection->connect();
+        }
+        if (connection->isConnected()) {
+            connection->login(eventMask);
+        }
+    }
+
+    size_t ManagerCluster::connect(const std::string& eventMask) {
+        std::vector<ManagerConnection*> all = getConnections();
+
+        // in parallel, dead servers cost one connect timeout all together
+        boost::thread_group threads;
+        for (std::vector<ManagerConnection*>::iterator it = all.begin(); it != all.end(); ++it) {
+            if (!(*it)->isAuthenticated()) {
+                threads.create_thread(boost::bind(&ManagerCluster::connectServer, *it, eventMask));
+            }
+        }
+        threads.join_all();
+
+        size_t authenticated = 0;
+        for (std::vector<ManagerConnection*>::iterator it = all.begin(); it != all.end(); ++it) {
+            ManagerConnection* connection = *it;
+            if (connection->isAuthenticated()) {
+                authenticated++;
+            } else {
+                LOG_WARN_STR("Server " + connection->getServerName() + " not available");
+            }
+        }
+        return (authenticated);
+    }
+
+    void ManagerCluster::logoff() {
+        std::vector<ManagerConnection*> all = getConnections();
+        for (std::vector<ManagerConnection*>::iterator it = all.begin(); it != all.end(); ++it) {
+            (*it)->logoff();
+        }
+    }
+
+    void ManagerCluster::disconnect() {
+        std::vector<ManagerConnection*> all = getConnections();
+        for (std::vector<ManagerConnection*>::iterator it = all.begin(); it != all.end(); ++it) {
+            (*it)->disconnect();
+        }
+        boost::mutex::scoped_lock lock(channelsMutex);
+        channels.clear();
+    }
+
+    ActionFuture ManagerCluster::sendAction(const std::string& key, ManagerAction* action, const responseCallbackFunction_t& rcbf) {
+        ManagerConnection* connection = getConnection(key);
+        if (connection == NULL) {
+            delete (action);
+            Throw(IllegalArgumentException("No server " + key + " in the cluster"));
+        }
+        return (connection->sendAction(action, rcbf));
+    }
+
+    ActionFuture ManagerCluster::sendActionToChannel(const std::string& channel, ManagerAction* action, const responseCallbackFunction_t& rcbf) {
+        std::string key = getChannelServer(channel);
+        if (key.empty()) {
+            delete (action);
+            Throw(IllegalArgumentException("Channel " + channel + " is on no known server"));
+        }
+        return (sendAction(key, action, rcbf));
+    }
+
+    std::string ManagerCluster::getChannelServer(const std::string& channel) const {
+        boost::mutex::scoped_lock lock(channelsMutex);
+        channels_t::const_iterator it = channels.find(channel);
+        return (it != channels.end() ? it->second : std::string());
+    }
+
+    void ManagerCluster::setChannelServer(const std::string& channel, const std::string& key) {
+        if (channel.empty()) {
+            return;
+        }
+        boost::mutex::scoped_lock lock(channelsMutex);
+        channels[channel] = key;
+    }
+
+    void ManagerCluster::removeChannel(const std::string& channel) {
+        boost::mutex::scoped_lock lock(channelsMutex);
+        channels.erase(channel);
+    }
+
+    void ManagerCluster::addEventListener(const ManagerEventListener& mel) {
+        Subscription subscription;
+        subscription.listener = &mel;
+        subscription.all = true;
+        subscription.type = EVENT_UNKNOWN;
+
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        subscriptions.push_back(subscription);
+        for (connections_t::iterator it = connections.begin(); it != connections.end(); ++it) {
+            subscribe(*it->second, subscription);
+        }
+    }
+
+    void ManagerCluster::addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key, const std::string& pattern) {
+        Subscription subscription;
+        subscription.listener = &mel;
+        subscription.all = false;
+        subscription.type = type;
+        subscription.key = key;
+        subscription.pattern = pattern;
+
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        subscriptions.push_back(subscription);
+        for (connections_t::iterator it = connections.begin(); it != connections.end(); ++it) {
+            subscribe(*it->second, subscription);
+        }
+    }
+
+    void ManagerCluster::removeEventListener(const ManagerEventListener& mel) {
+        boost::mutex::scoped_lock lock(connectionsMutex);
+        for (std::vector<Subscription>::iterator it = subscriptions.begin(); it != subscriptions.end();) {
+            if (it->listener == &mel) {
+                it = subscriptions.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (connections_t::iterator it = connections.begin(); it != connections.end(); ++it) {
+            it->second->removeEventListener(mel);
+        }
+    }
+
+    void ManagerCluster::subscribe(ManagerConnection& connection, const Subscription& subscription) {
+        if (subscription.all) {
+            connection.addEventListener(*subscription.listener);
+        } else {
+            connection.addEventListener(*subscription.listener, subscription.type, subscription.key, subscription.pattern);
+        }
+    }
+
+}
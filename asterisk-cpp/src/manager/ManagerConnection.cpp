@@ -8,33 +8,50 @@
 #include "asteriskcpp/manager/ManagerConnection.h"
 #include <exception>
 #include <memory>
+#include <unistd.h>
+#include <strings.h>
+#include <boost/bind.hpp>
 #include <boost/format.hpp>
-#include <boost/regex.hpp>
 #include "asteriskcpp/exceptions/Exception.h"
 #include "asteriskcpp/utils/LogHandler.h"
 #include "asteriskcpp/utils/StringUtils.h"
 #include "asteriskcpp/utils/MD5.h"
+#include "asteriskcpp/manager/Framer.h"
 #include "asteriskcpp/manager/actions/ChallengeAction.h"
+#include "asteriskcpp/manager/actions/EventsAction.h"
+#include "asteriskcpp/manager/actions/FilterAction.h"
 #include "asteriskcpp/manager/actions/LoginAction.h"
 #include "asteriskcpp/manager/actions/LogoffAction.h"
 #include "asteriskcpp/manager/responses/ChallengeResponse.h"
 
 #define DEFAULT_TIMEOUT  2000
+#define DEFAULT_CONNECT_TIMEOUT 5000
 #define DEFAULT_HOSTNAME "localhost"
 #define DEFAULT_PORT  5038
+#define FILTER_ALL "Event: "
+#define REFUSED_MESSAGE "Write queue full"
+#define DISCONNECTED_MESSAGE "Disconnected"
+#define LIST_COMPLETE "Complete"
 
 static const char* status[] = {"Disconnected", "Connected", "Authenticated"};
+static boost::atomic<unsigned int> connectionCount(0);
 
 namespace asteriskcpp {
 
     ManagerConnection::ManagerConnection() :
-    state(DISCONNECTED), hostname(DEFAULT_HOSTNAME), port(DEFAULT_PORT), ssl(false), defaultResponseTimeout(DEFAULT_TIMEOUT), socket(NULL) {
+    state(DISCONNECTED), hostname(DEFAULT_HOSTNAME), port(DEFAULT_PORT), ssl(false), defaultResponseTimeout(DEFAULT_TIMEOUT), connectTimeout(DEFAULT_CONNECT_TIMEOUT), autoEventMask(false), lastActionId(0), completion(new ActionCompletion()), pendingEventLists(0), followsStarted(false), followsId(0), followsStream(NULL), reconnector(this), autoReconnect(false), wantConnected(false), restoring(false), socket(NULL) {
+        // process and connection, ids stay unique behind a shared proxy
+        actionIdPrefix = convertToString(getpid()) + "." + convertToString(++connectionCount) + "-";
         ManagerResponsesHandler::start();
     }
 
     ManagerConnection::~ManagerConnection() {
+        reconnector.stop();
         ManagerResponsesHandler::stop();
         disconnect();
+        // nothing may fire an event once the members are being destroyed
+        reader.stopDispatching();
+        ManagerEventsHandler::setDispatchLanes(0);
     }
 
     bool ManagerConnection::connect(const std::string& server, unsigned int port) {
@@ -48,19 +65,42 @@ namespace asteriskcpp {
     bool ManagerConnection::connect() {
         try {
             LOG_INFO_STR((boost::format("Connecting to %1%:%2% ") % this->getHostname() % this->getPort()).str());
-            IPAddress ip(this->getHostname(), this->getPort());
-            this->socket = new TCPSocket(ip);
-            LOG_INFO_STR("Success");
+            std::vector<IPAddress> addresses(IPAddress::resolve(this->getHostname(), this->getPort()));
+            if (this->isSsl()) {
+                if (!this->sslContext) {
+                    this->sslContext.reset(new SSLContext());
+                }
+                this->socket = new SSLSocket(this->sslContext.get(), addresses, this->getHostname(), this->getConnectTimeout());
+            } else {
+                this->socket = new TCPSocket(addresses, this->getConnectTimeout());
+            }
+            LOG_INFO_STR("Success " + this->socket->getPeerAddress().getHost());
             this->setState(CONNECTED);
             return (true);
+        } catch (Exception& e) {
+            LOG_ERROR_STR(e.getMessage());
         } catch (...) {
         }
-        disconnect();
+        close();
         return (false);
     }
 
     void ManagerConnection::disconnect() {
+        wantConnected = false;
+        reconnector.cancel();
+        if (state != DISCONNECTED) {
+            close();
+        } else {
+            // held back for a reconnection that will not come
+            failPending(false);
+        }
+    }
+
+    void ManagerConnection::close() {
+        boost::recursive_mutex::scoped_lock lock(connectionMutex);
         if (state != DISCONNECTED) {
+            // what was sent before disconnecting still goes out
+            this->writer.flush(defaultResponseTimeout);
             this->setState(DISCONNECTED);
             if (this->socket != NULL) {
                 delete (socket);
@@ -69,33 +109,184 @@ namespace asteriskcpp {
         }
     }
 
-    void ManagerConnection::send(const std::string& data) {
+    bool ManagerConnection::send(const std::string& data) {
         LOG_DEBUG_STR(str2Log(data));
 
         if (this->state == DISCONNECTED) {
             LOG_TRACE_STR("OUT :state is DISCONNECTED");
-            return;
+            return (true);
         }
 
-        try {
-            this->socket->writeData(data);
-        } catch (Exception& E) {
-            LOG_ERROR_STR(E.getMessage());
-            this->reader.stop();
-            this->notifyDisconnect();
+        // write errors are seen by the reader as a disconnection
+        return (this->writer.write(data));
+    }
+
+    bool ManagerConnection::send(const std::vector<std::string>& data) {
+        LOG_DEBUG_STR("OUT " + convertToString(data.size()) + " actions");
+
+        if (this->state == DISCONNECTED) {
+            LOG_TRACE_STR("OUT :state is DISCONNECTED");
+            return (true);
         }
 
-        LOG_TRACE_STR("OUT");
+        return (this->writer.write(data));
     }
 
-    void ManagerConnection::sendAction(ManagerAction* action) {
-        sendAction(action, NULL);
+    bool ManagerConnection::send(const ManagerAction& action) {
+        if (deferAction(action)) {
+            return (true);
+        }
+        if (this->state == DISCONNECTED) {
+            LOG_TRACE_STR("OUT :state is DISCONNECTED");
+            return (false);
+        }
+
+        std::string data;
+        this->writer.acquireBuffer(data);
+        action.serialize(data);
+        LOG_DEBUG_STR(str2Log(data));
+        return (this->writer.writeBuffer(data));
     }
 
-    void ManagerConnection::sendAction(ManagerAction* action, responseCallbackFunction_t rcbf) {
-        ASyncResponseCallBack *asrcb = new ASyncResponseCallBack(action, defaultResponseTimeout, rcbf);
-        addResponsetListener(action->generateID(), asrcb);
-        send(action->toString());
+    bool ManagerConnection::send(const std::vector<ManagerAction*>& actions) {
+        LOG_DEBUG_STR("OUT " + convertToString(actions.size()) + " actions");
+
+        if (this->state == DISCONNECTED) {
+            LOG_TRACE_STR("OUT :state is DISCONNECTED");
+            return (false);
+        }
+
+        std::vector<std::string> data(actions.size());
+        this->writer.acquireBuffers(data);
+        for (size_t i = 0; i < actions.size(); i++) {
+            actions[i]->serialize(data[i]);
+        }
+        return (this->writer.writeBuffers(data));
+    }
+
+    void ManagerConnection::refuseAction(ManagerAction& action) {
+        std::string message(this->state == DISCONNECTED ? DISCONNECTED_MESSAGE : REFUSED_MESSAGE);
+        LOG_WARN_STR("Action " + action.getActionId() + " refused: " + message);
+        // answered as a timeout is, through the response dispatch thread
+        this->notifyResponseMessage("Response: Error\r\nActionID: " + action.getActionId() + "\r\nMessage: " + message + "\r\n\r\n");
+    }
+
+    bool ManagerConnection::deferAction(const ManagerAction& action) {
+        if (action.getReconnectPolicy() != ManagerAction::REPLAY_ON_RECONNECT) {
+            return (false);
+        }
+
+        boost::mutex::scoped_lock lock(restoreMutex);
+        if (restoring) {
+            // sent once reconnected
+            return (true);
+        }
+        if (replayedIds.empty()) {
+            return (false);
+        }
+        const std::string& id = action.getActionId();
+        return (replayedIds.erase(parseActionID(id.data(), id.length())) > 0);
+    }
+
+    ActionFuture ManagerConnection::sendAction(ManagerAction* action) {
+        return (sendAction(action, responseCallbackFunction_t()));
+    }
+
+    ActionFuture ManagerConnection::sendAction(ManagerAction* action, const responseCallbackFunction_t& rcbf) {
+        ActionFuture future(completion);
+        future.then(rcbf);
+        addResponsetListener(generateID(*action), new FutureResponseCallBack(action, defaultResponseTimeout, future, true));
+        if (!send(*action)) {
+            refuseAction(*action);
+        }
+        return (future);
+    }
+
+    ActionBatchPtr ManagerConnection::sendActions(const std::vector<ManagerAction*>& actions, const responseCallbackFunction_t& rcbf) {
+        ActionBatchPtr batch(new ActionBatch(actions.size()));
+        std::vector<std::pair<uint64_t, ResponseCallBack*> > callbacks;
+        callbacks.reserve(actions.size());
+        for (std::vector<ManagerAction*>::const_iterator it = actions.begin(); it != actions.end(); ++it) {
+            uint64_t id = generateID(**it);
+            callbacks.push_back(std::make_pair(id, new BatchResponseCallBack(*it, defaultResponseTimeout, rcbf, batch)));
+        }
+
+        // registered before sending, a response can not arrive first
+        addResponseListeners(callbacks);
+        std::vector<ManagerAction*> ready;
+        ready.reserve(actions.size());
+        for (std::vector<ManagerAction*>::const_iterator it = actions.begin(); it != actions.end(); ++it) {
+            if (!deferAction(**it)) {
+                ready.push_back(*it);
+            }
+        }
+        if (!ready.empty() && !send(ready)) {
+            for (std::vector<ManagerAction*>::const_iterator it = ready.begin(); it != ready.end(); ++it) {
+                refuseAction(**it);
+            }
+        }
+        return (batch);
+    }
+
+    EventListPtr ManagerConnection::sendEventListAction(ManagerAction* action, size_t capacity) {
+        EventListPtr list(new EventList());
+        list->setCapacity(capacity);
+        uint64_t id = generateID(*action);
+        {
+            boost::mutex::scoped_lock lock(eventListsMutex);
+            eventLists[id] = list;
+            pendingEventLists++;
+        }
+
+        ActionFuture future(completion);
+        future.then(boost::bind(&ManagerConnection::eventListResponse, this, id, _1));
+        addResponsetListener(id, new FutureResponseCallBack(action, defaultResponseTimeout, future, true));
+        if (!send(*action)) {
+            refuseAction(*action);
+        }
+        return (list);
+    }
+
+    void ManagerConnection::eventListResponse(uint64_t id, ManagerResponse* mr) {
+        if (mr != NULL && mr->isTypeSuccess()) {
+            // the entries follow
+            return;
+        }
+
+        EventListPtr list;
+        {
+            boost::mutex::scoped_lock lock(eventListsMutex);
+            eventLists_t::iterator it = eventLists.find(id);
+            if (it == eventLists.end()) {
+                return;
+            }
+            list = it->second;
+            eventLists.erase(it);
+            pendingEventLists--;
+        }
+        list->fail(mr != NULL ? mr->getGetterValue(keys::Message) : "Not sent");
+    }
+
+    void ManagerConnection::failEventLists(const std::string& message) {
+        eventLists_t lists;
+        {
+            boost::mutex::scoped_lock lock(eventListsMutex);
+            lists.swap(eventLists);
+            pendingEventLists = 0;
+        }
+        for (eventLists_t::iterator it = lists.begin(); it != lists.end(); ++it) {
+            it->second->fail(message);
+        }
+    }
+
+    CommandStreamPtr ManagerConnection::sendStreamingCommand(CommandAction* action, size_t capacity) {
+        CommandStreamPtr stream(new CommandStream());
+        stream->setCapacity(capacity);
+        addResponsetListener(generateID(*action), new CommandStreamCallBack(action, defaultResponseTimeout, stream));
+        if (!send(*action)) {
+            refuseAction(*action);
+        }
+        return (stream);
     }
 
     ManagerResponse* ManagerConnection::syncSendAction(ManagerAction& action) {
@@ -104,11 +295,13 @@ namespace asteriskcpp {
 
     ManagerResponse* ManagerConnection::syncSendAction(ManagerAction& action, unsigned int timeout) {
         LOG_TRACE_STR("IN");
-        SyncResponseCallBack *srcb = new SyncResponseCallBack(&action, timeout);
-        addResponsetListener(action.generateID(), srcb);
-        send(action.toString());
-        ManagerResponse* mr = srcb->stoll();
-        return mr;
+        ActionFuture future(completion);
+        addResponsetListener(generateID(action), new FutureResponseCallBack(&action, timeout, future, false));
+        if (!send(action)) {
+            refuseAction(action);
+        }
+        // the response is the caller's
+        return (future.release());
     }
 
     void ManagerConnection::addEventCallback(onManagerEventCallback_t callback) {
@@ -116,6 +309,47 @@ namespace asteriskcpp {
         addEventListener(*asecb);
     }
 
+    void ManagerConnection::addEventListener(const ManagerEventListener& mel) {
+        ManagerEventsHandler::addEventListener(mel);
+        applySubscriptions();
+    }
+
+    void ManagerConnection::addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key, const std::string& pattern) {
+        ManagerEventsHandler::addEventListener(mel, type, key, pattern);
+        applySubscriptions();
+    }
+
+    void ManagerConnection::removeEventListener(const ManagerEventListener& mel) {
+        ManagerEventsHandler::removeEventListener(mel);
+        applySubscriptions();
+    }
+
+    void ManagerConnection::applySubscriptions() {
+        if (!autoEventMask || !isAuthenticated()) {
+            return;
+        }
+
+        boost::mutex::scoped_lock lock(subscriptionsMutex);
+        std::string mask(subscriptions.getEventMask());
+        if (mask != appliedMask) {
+            LOG_DEBUG_STR("EVENT MASK " + mask);
+            sendAction(new EventsAction(mask));
+            appliedMask = mask;
+        }
+
+        std::vector<std::string> filters(subscriptions.getFilters());
+        if (filters.empty() && !appliedFilters.empty()) {
+            // filters can not be removed, let every event through instead
+            filters.push_back(FILTER_ALL);
+        }
+        for (std::vector<std::string>::const_iterator it = filters.begin(); it != filters.end(); ++it) {
+            if (appliedFilters.insert(*it).second) {
+                LOG_DEBUG_STR("EVENT FILTER " + *it);
+                sendAction(new FilterAction(*it));
+            }
+        }
+    }
+
     ManagerConnection::State ManagerConnection::getState() const {
         return (state);
     }
@@ -129,6 +363,10 @@ namespace asteriskcpp {
         return (defaultResponseTimeout);
     }
 
+    unsigned int ManagerConnection::getConnectTimeout() const {
+        return (connectTimeout);
+    }
+
     std::string ManagerConnection::getHostname() const {
         return (hostname);
     }
@@ -149,10 +387,46 @@ namespace asteriskcpp {
         return (ssl);
     }
 
+    SSLContextPtr ManagerConnection::getSslContext() const {
+        return (sslContext);
+    }
+
+    bool ManagerConnection::isLazyEvents() const {
+        return (eventBuilder.isLazy());
+    }
+
+    bool ManagerConnection::isAutoEventMask() const {
+        return (autoEventMask);
+    }
+
+    bool ManagerConnection::isAutoReconnect() const {
+        return (autoReconnect);
+    }
+
+    unsigned int ManagerConnection::getReconnectInitialDelay() const {
+        return (reconnector.getInitialDelay());
+    }
+
+    unsigned int ManagerConnection::getReconnectMaxDelay() const {
+        return (reconnector.getMaxDelay());
+    }
+
+    std::string ManagerConnection::getServerName() const {
+        return (eventBuilder.getServer());
+    }
+
+    size_t ManagerConnection::getEventPoolSize() const {
+        return (eventBuilder.getEventPool().getMaxPerType());
+    }
+
     void ManagerConnection::setDefaultResponseTimeout(unsigned int defaultResponseTimeout) {
         this->defaultResponseTimeout = defaultResponseTimeout;
     }
 
+    void ManagerConnection::setConnectTimeout(unsigned int connectTimeout) {
+        this->connectTimeout = connectTimeout;
+    }
+
     void ManagerConnection::setHostname(std::string hostname) {
         this->hostname = hostname;
     }
@@ -169,6 +443,87 @@ namespace asteriskcpp {
         this->ssl = ssl;
     }
 
+    void ManagerConnection::setSslContext(const SSLContextPtr& sslContext) {
+        this->sslContext = sslContext;
+    }
+
+    void ManagerConnection::setDispatchGroup(const DispatchGroupPtr& group) {
+        reader.setDispatchGroup(group);
+    }
+
+    void ManagerConnection::setServerName(const std::string& serverName) {
+        eventBuilder.setServer(serverName);
+    }
+
+    void ManagerConnection::setLazyEvents(bool lazy, bool preloadUniqueId) {
+        eventBuilder.setLazy(lazy, preloadUniqueId);
+    }
+
+    size_t ManagerConnection::getDispatchLanes() const {
+        return (ManagerEventsHandler::getDispatchLanes());
+    }
+
+    size_t ManagerConnection::getWriteQueueCapacity() const {
+        return (writer.getCapacity());
+    }
+
+    Writer::OverflowMode ManagerConnection::getWriteOverflowMode() const {
+        return (writer.getOverflowMode());
+    }
+
+    size_t ManagerConnection::getWriteQueueDepth() const {
+        return (writer.getQueueDepth());
+    }
+
+    size_t ManagerConnection::getWritePendingBytes() const {
+        return (writer.getPendingBytes());
+    }
+
+    void ManagerConnection::setWriteQueueCapacity(size_t capacity) {
+        writer.setCapacity(capacity);
+    }
+
+    void ManagerConnection::setWriteOverflowMode(Writer::OverflowMode overflowMode) {
+        writer.setOverflowMode(overflowMode);
+    }
+
+    void ManagerConnection::setDispatchLanes(size_t lanes) {
+        ManagerEventsHandler::setDispatchLanes(lanes);
+    }
+
+    void ManagerConnection::setEventPoolSize(size_t eventPoolSize) {
+        eventBuilder.getEventPool().setMaxPerType(eventPoolSize);
+    }
+
+    void ManagerConnection::setAutoEventMask(bool autoEventMask) {
+        this->autoEventMask = autoEventMask;
+        applySubscriptions();
+    }
+
+    void ManagerConnection::setAutoReconnect(bool autoReconnect) {
+        if (this->autoReconnect == autoReconnect) {
+            return;
+        }
+
+        this->autoReconnect = autoReconnect;
+        if (autoReconnect) {
+            reconnector.start();
+            if (wantConnected && state == DISCONNECTED) {
+                // dropped before
+                reconnector.schedule();
+            }
+        } else {
+            reconnector.stop();
+            if (state == DISCONNECTED) {
+                failPending(false);
+            }
+        }
+    }
+
+    void ManagerConnection::setReconnectDelay(unsigned int initialDelay, unsigned int maxDelay) {
+        reconnector.setDelays(initialDelay, maxDelay);
+    }
+
     void ManagerConnection::setState(State newState) {
         if (this->state == newState)
             return;
@@ -184,13 +539,18 @@ namespace asteriskcpp {
                 }
                 //transition to connected
                 LOG_INFO_STR("CONNECTED");
+                // the reader may notify a disconnection at once, stopping the writer
+                this->writer.start(socket);
+                this->state = newState;
                 this->reader.start(socket, this);
-                break;
+                return;
             case CONNECTED:
                 if (newState == DISCONNECTED) {
                     //to disconnected
                     LOG_INFO_STR("DISCONNECTED");
-                    this->reader.stop();
+                    if (this->reader.stop()) {
+                        connectionLost();
+                    }
                 } else {
                     //to authenticated
                     LOG_INFO_STR("AUTHENTICATED");
@@ -217,64 +577,250 @@ namespace asteriskcpp {
         this->username = username;
     }
 
-    std::string ManagerConnection::extractActionID(const std::string& response) {
-        //ActionID?:\\ (\\w+)
-        boost::regex expr("actionid:\\s+(\\S+)", boost::regex_constants::icase);
-        boost::smatch matches;
+    uint64_t ManagerConnection::generateID(ManagerAction& action) {
+        uint64_t id = ++lastActionId;
+        action.generateID(actionIdPrefix, id);
+        return (id);
+    }
 
-        try {
-            if (boost::regex_search(response, matches, expr)) {
-                if (matches.size() > 0) {
-                    std::string match(matches[1].first, matches[1].second);
-                    return (match);
-                }
+    uint64_t ManagerConnection::parseActionID(const SlabView& actionId) const {
+        return (parseActionID(actionId.data(), actionId.length()));
+    }
+
+    uint64_t ManagerConnection::parseActionID(const char* data, size_t length) const {
+        size_t prefixLength = actionIdPrefix.length();
+        if (length <= prefixLength || actionIdPrefix.compare(0, prefixLength, data, prefixLength) != 0) {
+            // not sent by this connection
+            return (0);
+        }
+
+        uint64_t id = 0;
+        for (size_t i = prefixLength; i < length; i++) {
+            if (data[i] < '0' || data[i] > '9') {
+                return (0);
             }
-        } catch (boost::regex_error& e) {
-            LOG_WARN_STR(e.what());
+            id = id * 10 + (data[i] - '0');
         }
-        return ("");
+        return (id);
     }
 
-    void ManagerConnection::dispatchResponse(const std::string& response) {
-        LOG_TRACE_STR(str2Log(response));
+    void ManagerConnection::dispatchResponse(const SlabView& frame) {
+        LOG_TRACE_STR(str2Log(frame.str()));
 
-        ManagerAction *action = NULL;
-        std::string actionId = extractActionID(response);
-        if (!actionId.empty()) {
-            ResponseCallBack *cb = this->getListener(actionId);
+        uint64_t id = parseActionID(Framer::header(frame, "ActionID"));
+        if (id != 0) {
+            ResponseCallBack *cb = this->getListener(id);
             if (cb != NULL) {
-                action = cb->getAction();
-                this->fireResponseCallback(this->responseBuilder.buildResponse(action, response));
+                CommandStreamCallBack* stream = dynamic_cast<CommandStreamCallBack*> (cb);
+                if (stream != NULL && frame.istartsWith("Response: Follows")) {
+                    detachResponseListener(id);
+                    stream->append(frame);
+                    stream->complete();
+                    delete stream;
+                    return;
+                }
+                ManagerAction *action = cb->getAction();
+                this->fireResponseCallback(id, this->responseBuilder.buildResponse(action, frame));
+            }
+        }
+    }
+
+    void ManagerConnection::dispatchResponsePart(const SlabView& part, bool last) {
+        if (part.empty()) {
+            // cut short by a disconnection
+            followsStarted = false;
+            std::string().swap(followsBuffer);
+            delete followsStream;
+            followsStream = NULL;
+            return;
+        }
+
+        if (!followsStarted) {
+            followsStarted = true;
+            followsId = parseActionID(Framer::header(part, "ActionID"));
+            ResponseCallBack *cb = (followsId != 0 ? this->getListener(followsId) : NULL);
+            if (cb == NULL) {
+                // nobody waits for it, the parts are dropped
+                followsId = 0;
+            } else if (dynamic_cast<CommandStreamCallBack*> (cb) != NULL) {
+                // streamed as it arrives, the output may take longer than the response timeout
+                followsStream = static_cast<CommandStreamCallBack*> (detachResponseListener(followsId));
             }
         }
+
+        if (followsStream != NULL) {
+            followsStream->append(part);
+        } else if (followsId != 0) {
+            followsBuffer.append(part.data(), part.length());
+        }
+        if (!last) {
+            return;
+        }
+
+        followsStarted = false;
+        if (followsStream != NULL) {
+            followsStream->complete();
+            delete followsStream;
+            followsStream = NULL;
+            return;
+        }
+
+        std::string response;
+        response.swap(followsBuffer);
+        ResponseCallBack *cb = (followsId != 0 ? this->getListener(followsId) : NULL);
+        if (cb != NULL) {
+            this->fireResponseCallback(followsId, this->responseBuilder.buildResponse(cb->getAction(), response));
+        }
     }
 
-    void ManagerConnection::dispatchEvent(const std::string& event) {
-        LOG_TRACE_STR(str2Log(event));
-        ManagerEvent *me = this->eventBuilder.buildEvent(event);
+    bool ManagerConnection::dispatchEventList(const SlabView& frame) {
+        uint64_t id = parseActionID(Framer::header(frame, "ActionID"));
+        if (id == 0) {
+            return (false);
+        }
+
+        // "EventList: Complete" is missing from the Complete events of older servers
+        SlabView eventList = Framer::header(frame, "EventList");
+        SlabView name = Framer::header(frame, "Event");
+        size_t completeLength = sizeof (LIST_COMPLETE) - 1;
+        bool last = (eventList.length() == completeLength && strncasecmp(eventList.data(), LIST_COMPLETE, completeLength) == 0)
+                || (name.length() >= completeLength && strncasecmp(name.data() + name.length() - completeLength, LIST_COMPLETE, completeLength) == 0);
+
+        EventListPtr list;
+        {
+            boost::mutex::scoped_lock lock(eventListsMutex);
+            eventLists_t::iterator it = eventLists.find(id);
+            if (it == eventLists.end()) {
+                return (false);
+            }
+            list = it->second;
+            if (last) {
+                eventLists.erase(it);
+                pendingEventLists--;
+            }
+        }
+
+        ManagerEvent *me = this->eventBuilder.buildEvent(frame);
+        if (last) {
+            list->finish(me);
+        } else if (me != NULL) {
+            list->add(me);
+        }
+        return (true);
+    }
+
+    void ManagerConnection::dispatchEvent(const SlabView& frame) {
+        LOG_TRACE_STR(str2Log(frame.str()));
+        if (pendingEventLists > 0 && dispatchEventList(frame)) {
+            return;
+        }
+        ManagerEvent *me = this->eventBuilder.buildEvent(frame);
         if (me != NULL) {
             this->fireEvent(me);
         }
     }
 
+    void ManagerConnection::releaseEvent(ManagerEvent* me) {
+        this->eventBuilder.releaseEvent(me);
+    }
+
     void ManagerConnection::notifyDisconnect() {
+        boost::recursive_mutex::scoped_lock lock(connectionMutex);
+        // a stale notification if the connection was closed meanwhile
+        if (this->reader.takeHangup()) {
+            connectionLost();
+        }
+    }
+
+    void ManagerConnection::connectionLost() {
         LOG_ERROR_STR("Disconnected");
         this->state = DISCONNECTED;
+        // no write may be in progress once the socket is deleted
+        this->writer.stop();
         if (this->socket != NULL) {
             delete (socket);
             this->socket = NULL;
         }
+        failEventLists(DISCONNECTED_MESSAGE);
+
+        bool restore = autoReconnect && wantConnected;
+        failPending(restore);
+        if (restore) {
+            reconnector.schedule();
+        }
+    }
+
+    void ManagerConnection::failPending(bool restore) {
+        std::vector<std::string> failed;
+        std::map<uint64_t, std::string> replayed;
+        {
+            boost::mutex::scoped_lock lock(restoreMutex);
+            restoring = restore;
+            collectPending(restore, &failed, replayed);
+        }
+        for (std::vector<std::string>::const_iterator it = failed.begin(); it != failed.end(); ++it) {
+            this->notifyResponseMessage("Response: Error\r\nActionID: " + *it + "\r\nMessage: " DISCONNECTED_MESSAGE "\r\n\r\n");
+        }
+    }
+
+    bool ManagerConnection::reconnect() {
+        if (!wantConnected) {
+            return (true);
+        }
+
+        if (this->state == DISCONNECTED && !this->connect()) {
+            return (false);
+        }
+        if (!this->isAuthenticated() && !this->authenticate(loginEventMask)) {
+            close();
+            return (false);
+        }
+
+        // the other pending actions were sent since the login, or already failed
+        std::map<uint64_t, std::string> replayed;
+        {
+            boost::mutex::scoped_lock lock(restoreMutex);
+            restoring = false;
+            collectPending(true, NULL, replayed);
+            replayedIds.clear();
+            for (std::map<uint64_t, std::string>::const_iterator it = replayed.begin(); it != replayed.end(); ++it) {
+                replayedIds.insert(it->first);
+            }
+        }
+
+        if (!replayed.empty()) {
+            LOG_INFO_STR("Replaying " + convertToString(replayed.size()) + " actions");
+            std::vector<std::string> data(replayed.size());
+            size_t i = 0;
+            for (std::map<uint64_t, std::string>::iterator it = replayed.begin(); it != replayed.end(); ++it) {
+                data[i++].swap(it->second);
+            }
+            send(data);
+        }
+        return (true);
     }
 
     void ManagerConnection::notifyResponseMessage(const std::string& responseMessage) {
-        this->reader.delegeteResponseMessage(responseMessage);
+        if (!this->reader.delegeteResponseMessage(responseMessage)) {
+            // never connected, there is no dispatch thread to answer from
+            dispatchResponse(SlabView::fromString(responseMessage));
+        }
     }
 
     bool ManagerConnection::login() {
-        return (this->login(NULL));
+        return (this->login(std::string()));
     }
 
     bool ManagerConnection::login(const std::string& eventMask) {
+        loginEventMask = eventMask;
+        if (!this->authenticate(eventMask)) {
+            return (false);
+        }
+        wantConnected = true;
+        return (true);
+    }
+
+    bool ManagerConnection::authenticate(const std::string& eventMask) {
         if (!this->isConnected()) {
             LOG_ERROR_STR("Must connect before Login!!");
             return (false);
@@ -291,7 +837,8 @@ namespace asteriskcpp {
         LoginAction* la = NULL;
         ChallengeAction challengeAction("MD5");
         ChallengeResponse* carp = (ChallengeResponse*) this->syncSendAction(challengeAction);
-        if (carp->isTypeSuccess()) {
+        // NULL if the connection dropped meanwhile
+        if (carp != NULL && carp->isTypeSuccess()) {
             std::string challenge(carp->getChallenge());
             if (!challenge.empty()) {
                 MD5 md5;
@@ -307,14 +854,20 @@ namespace asteriskcpp {
             la = new LoginAction(this->getUsername(), this->getPassword());
         }
 
-        if (!eventMask.empty()) {
+        if (this->isAutoEventMask()) {
+            boost::mutex::scoped_lock lock(subscriptionsMutex);
+            appliedMask = subscriptions.getEventMask();
+            appliedFilters.clear();
+            la->setEvents(appliedMask);
+        } else if (!eventMask.empty()) {
             la->setEvents(eventMask);
         }
 
         ManagerResponse *mr = this->syncSendAction(*la);
-        bool rt(mr->isTypeSuccess());
+        bool rt(mr != NULL && mr->isTypeSuccess());
         if (rt) {
             this->setState(AUTHENTICATED);
+            this->applySubscriptions();
         }
         delete (la);
         delete (mr);
@@ -329,10 +882,12 @@ namespace asteriskcpp {
     }
 
     void ManagerConnection::logoff() {
+        wantConnected = false;
+        reconnector.cancel();
         if (this->isAuthenticated()) {
             LogoffAction la;
             std::auto_ptr<ManagerResponse> mr(syncSendAction(la));
-            if (mr->getType() == ManagerResponse::Type_SUCCESS) {
+            if (mr.get() != NULL && mr->getType() == ManagerResponse::Type_SUCCESS) {
                 this->setState(CONNECTED);
             }
         }
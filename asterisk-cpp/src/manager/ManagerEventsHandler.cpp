@@ -12,6 +12,9 @@
 #include "asteriskcpp/utils/LogHandler.h"
 #include "asteriskcpp/exceptions/Exception.h"
 
+#define LANE_CAPACITY 4096
+#define LANE_BATCH_SIZE 64
+
 namespace asteriskcpp {
 
     ASyncEventCallBack::ASyncEventCallBack(onManagerEventCallback_t f) {
@@ -30,28 +33,130 @@ namespace asteriskcpp {
         LOG_TRACE_STR("OUT");
     }
 
-    ManagerEventsHandler::~ManagerEventsHandler() {
+    EventLane::EventLane(ManagerEventsHandler* handler, size_t capacity) :
+    handler(handler), queue(capacity), fired(0) {
+    }
+
+    EventLane::~EventLane() {
+        shutdown();
+    }
+
+    void EventLane::post(ManagerEvent* me) {
+        queue.put(me);
+    }
+
+    void EventLane::shutdown() {
+        Thread::stop();
+
+        for (size_t i = fired; i < batch.size(); i++) {
+            handler->releaseEvent(batch[i]);
+        }
+        batch.clear();
+        fired = 0;
+        ManagerEvent* me;
+        while (queue.tryTake(me)) {
+            handler->releaseEvent(me);
+        }
+    }
+
+    void EventLane::run() {
+        queue.take(batch, LANE_BATCH_SIZE);
+        for (fired = 0; fired < batch.size();) {
+            handler->internalFireEvent(batch[fired++]);
+        }
+        batch.clear();
+        fired = 0;
+    }
 
+    ManagerEventsHandler::ManagerEventsHandler() :
+    listeners(new EventListenersList()) {
+    }
+
+    ManagerEventsHandler::~ManagerEventsHandler() {
+        setDispatchLanes(0);
     }
 
     void ManagerEventsHandler::addEventListener(const ManagerEventListener& mel) {
-        listeners.insert(&mel);
+        subscriptions.subscribeAll(&mel);
+        insertListener(&mel);
+    }
+
+    void ManagerEventsHandler::addEventListener(const ManagerEventListener& mel, EventType type, const std::string& key, const std::string& pattern) {
+        subscriptions.subscribe(&mel, type, key, pattern);
+        insertListener(&mel);
     }
 
     void ManagerEventsHandler::removeEventListener(const ManagerEventListener& mel) {
-        listeners.erase(&mel);
+        {
+            boost::mutex::scoped_lock lock(listenersMutex);
+            boost::shared_ptr<EventListenersList> updated(new EventListenersList(*listeners));
+            updated->erase(&mel);
+            boost::atomic_store(&listeners, EventListenersPtr(updated));
+        }
+        subscriptions.unsubscribe(&mel);
+    }
+
+    void ManagerEventsHandler::insertListener(const ManagerEventListener* mel) {
+        boost::mutex::scoped_lock lock(listenersMutex);
+        if (listeners->count(mel) == 0) {
+            boost::shared_ptr<EventListenersList> updated(new EventListenersList(*listeners));
+            updated->insert(mel);
+            boost::atomic_store(&listeners, EventListenersPtr(updated));
+        }
+    }
+
+    void ManagerEventsHandler::setDispatchLanes(size_t count) {
+        for (std::vector<EventLane*>::iterator it = lanes.begin(); it != lanes.end(); ++it) {
+            (*it)->shutdown();
+            delete (*it);
+        }
+        lanes.clear();
+
+        if (count > 0) {
+            // lanes[0] is the lane of the events without call
+            for (size_t i = 0; i <= count; i++) {
+                lanes.push_back(new EventLane(this, LANE_CAPACITY));
+                lanes.back()->start();
+            }
+        }
+    }
+
+    size_t ManagerEventsHandler::getDispatchLanes() const {
+        return (lanes.empty() ? 0 : lanes.size() - 1);
+    }
+
+    size_t ManagerEventsHandler::laneOf(const ManagerEvent& me) const {
+        // per channel, see setDispatchLanes
+        static const PropertyKey* callKeys[] = {&keys::UniqueId, &keys::UniqueId1, &keys::Channel, &keys::Channel1};
+
+        for (size_t i = 0; i < sizeof (callKeys) / sizeof (callKeys[0]); i++) {
+            boost::string_ref key = me.getPropertyView(*callKeys[i]);
+            if (!key.empty()) {
+                return (1 + PropertyMap::hashKey(key.data(), key.length()) % (lanes.size() - 1));
+            }
+        }
+        return (0);
     }
 
     void ManagerEventsHandler::fireEvent(ManagerEvent* me) {
-		//The outbreak order of event cannot work when I make thread here
-        //boost::thread t(boost::bind(&ManagerEventsHandler::internalFireEvent, this, me));
-        this->internalFireEvent(me);
+        // the events of one call stay on one lane, so in order
+        if (lanes.empty()) {
+            this->internalFireEvent(me);
+        } else {
+            lanes[laneOf(*me)]->post(me);
+        }
     }
 
     void ManagerEventsHandler::internalFireEvent(ManagerEvent* me) {
         LOG_DEBUG_STR("FIRE EVENT " + me->getEventName() + ":: " + me->toLog());
 
-        for (EventListenersList::const_iterator iter = listeners.begin(); iter != listeners.end(); ++iter) {
+        // a listener removed meanwhile may still get this event
+        EventListenersPtr current(boost::atomic_load(&listeners));
+        EventSubscriptions::Snapshot accepted(subscriptions.getSnapshot());
+        for (EventListenersList::const_iterator iter = current->begin(); iter != current->end(); ++iter) {
+            if (!EventSubscriptions::accepts(accepted, *iter, *me)) {
+                continue;
+            }
             try {
                 (const_cast<ManagerEventListener *> (*iter))->onManagerEvent(*me);
             } catch (Exception& E) {
@@ -59,8 +164,12 @@ namespace asteriskcpp {
             }
         }
 
-        delete me;
+        releaseEvent(me);
         LOG_DEBUG_STR("OUT");
     }
 
+    void ManagerEventsHandler::releaseEvent(ManagerEvent* me) {
+        delete me;
+    }
+
 }
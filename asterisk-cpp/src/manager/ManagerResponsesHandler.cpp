@@ -9,21 +9,21 @@
 #include "asteriskcpp/utils/LogHandler.h"
 #include "asteriskcpp/utils/StringUtils.h"
 
-#define LOOP_INTERVAL 500
+#define TIMEOUT_TICK 10
+#define TIMEOUT_SLOTS 1024
 
 namespace asteriskcpp {
 
     ResponseCallBack::ResponseCallBack(ManagerAction* a, unsigned int tout)
-        : isTimeout(false) {
+        : timeout(tout), isTimeout(false) {
         setAction(a);
-        this->timeout = boost::get_system_time() + boost::posix_time::milliseconds(tout);
     }
 
     ResponseCallBack::~ResponseCallBack() {
         LOG_TRACE_STR("OUT");
     }
 
-    ASyncResponseCallBack::ASyncResponseCallBack(ManagerAction* a, unsigned int tout, responseCallbackFunction_t f) :
+    ASyncResponseCallBack::ASyncResponseCallBack(ManagerAction* a, unsigned int tout, const responseCallbackFunction_t& f) :
     ResponseCallBack(a, tout) {
         this->function = f;
     }
@@ -36,47 +36,13 @@ namespace asteriskcpp {
 
     void ASyncResponseCallBack::fireCallBack(ManagerResponse* mr) {
         LOG_TRACE_STR("ASyncResponseCallBack :" + mr->toLog());
-        if (this->function != NULL) {
+        if (this->function) {
             (this->function)(mr);
         }
         delete mr;
         LOG_TRACE_STR("OUT");
     }
 
-    SyncResponseCallBack::SyncResponseCallBack(ManagerAction* a, unsigned int timeOut) :
-    ResponseCallBack(a, timeOut), response(NULL), isReady(false), isStollEnd(false) {
-    }
-
-    SyncResponseCallBack::~SyncResponseCallBack() {
-        boost::unique_lock<boost::mutex> lock(this->m_mutex);
-        this->m_cond.notify_all();
-        if (this->isStollEnd == false) {
-            this->m_cond.wait(lock);
-        }
-        LOG_TRACE_STR("OUT");
-    }
-
-    ManagerResponse* SyncResponseCallBack::stoll() {
-        boost::unique_lock<boost::mutex> lock(this->m_mutex);
-        LOG_TRACE_STR("");
-        if (this->isReady == false) {
-            this->m_cond.wait(lock);
-        }
-        ManagerResponse* mr = this->response;
-        this->isStollEnd = true;
-        this->m_cond.notify_all();
-        LOG_TRACE_STR("OUT");
-        return response;
-    }
-
-    void SyncResponseCallBack::fireCallBack(ManagerResponse* mr) {
-        boost::lock_guard<boost::mutex> lock(this->m_mutex);
-        this->response = mr;
-        LOG_TRACE_STR("SyncResponseCallBack : " + (*mr).toLog());
-        this->isReady = true;
-        this->m_cond.notify_all();
-    }
-
     ManagerAction *ResponseCallBack::getAction() const {
         return (this->action);
     }
@@ -85,34 +51,63 @@ namespace asteriskcpp {
         this->action = action;
     }
 
-    void ResponseCallBack::fireTimeout() {
-        std::string msg = "Response: Error\r\nActionID: " + this->action->getActionId() + "\r\nMessage: Time Out\r\n\r\n";
-        ManagerResponse* rto = new ManagerResponse(msg);
-        fireCallBack(rto);
-        LOG_TRACE_STR("OUT");
+    ManagerResponsesHandler::ManagerResponsesHandler() :
+    timeouts(TIMEOUT_TICK, TIMEOUT_SLOTS) {
     }
 
     ManagerResponsesHandler::~ManagerResponsesHandler() {
     }
 
-    void ManagerResponsesHandler::addResponsetListener(const std::string& key, ResponseCallBack* bcb) {
+    void ManagerResponsesHandler::addResponsetListener(uint64_t id, ResponseCallBack* bcb) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        LOG_TRACE_STR("ADD RESPONSE Listener " + convertToString(id) + "::" + typeid (*bcb).name() + "::" + convertToString(bcb->timeout) + "ms");
+        this->listeners.insert(id, bcb);
+        this->timeouts.schedule(bcb, bcb->timeout);
+        this->m_cond.notify_all();
+    }
+
+    void ManagerResponsesHandler::addResponseListeners(const std::vector<std::pair<uint64_t, ResponseCallBack*> >& callbacks) {
         boost::lock_guard<boost::mutex> lock(this->m_mutex);
-        LOG_TRACE_STR("ADD RESPONSE Listener " + key + "::" + typeid (*bcb).name() + "::" + convertToString(bcb->timeout));
-        const std::pair<std::string, ResponseCallBack*> p = std::make_pair(key, bcb);
-        this->listeners.insert(p);
+        LOG_TRACE_STR("ADD RESPONSE Listeners " + convertToString(callbacks.size()));
+        for (std::vector<std::pair<uint64_t, ResponseCallBack*> >::const_iterator it = callbacks.begin(); it != callbacks.end(); ++it) {
+            this->listeners.insert(it->first, it->second);
+            this->timeouts.schedule(it->second, it->second->timeout);
+        }
         this->m_cond.notify_all();
     }
 
-    void ManagerResponsesHandler::removeResponseListener(const std::string& key) {
+    void ManagerResponsesHandler::removeResponseListener(uint64_t id) {
+        LOG_TRACE_STR("REMOVE RESPONSE Listener " + convertToString(id));
+        // deleted unlocked, a dropped future runs its continuations
+        delete (this->detachResponseListener(id));
+        LOG_TRACE_STR("OUT");
+    }
+
+    ResponseCallBack* ManagerResponsesHandler::detachResponseListener(uint64_t id) {
         boost::lock_guard<boost::mutex> lock(this->m_mutex);
-        std::string keytmp = key;
-        LOG_TRACE_STR("REMOVE RESPONSE Listener " + key);
-        ResponseCallBack* m = getListener(key);
-        this->listeners.erase(key);
+        ResponseCallBack* m = this->listeners.erase(id);
         if (m) {
-            delete (m);
+            this->timeouts.cancel(m);
+        }
+        return (m);
+    }
+
+    void ManagerResponsesHandler::collectPending(bool replay, std::vector<std::string>* failed, std::map<uint64_t, std::string>& replayed) {
+        std::vector<std::pair<uint64_t, ResponseCallBack*> > pending;
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        // the actions can not be deleted by their response meanwhile
+        this->listeners.items(pending);
+        for (std::vector<std::pair<uint64_t, ResponseCallBack*> >::const_iterator it = pending.begin(); it != pending.end(); ++it) {
+            const ManagerAction* action = it->second->getAction();
+            if (action == NULL || it->second->isTimeout) {
+                continue;
+            }
+            if (replay && action->getReconnectPolicy() == ManagerAction::REPLAY_ON_RECONNECT) {
+                action->serialize(replayed[it->first]);
+            } else if (failed != NULL) {
+                failed->push_back(action->getActionId());
+            }
         }
-        LOG_TRACE_STR("OUT" + keytmp);
     }
 
     bool ManagerResponsesHandler::isEmpty() {
@@ -132,53 +127,68 @@ namespace asteriskcpp {
     }
 
     void ManagerResponsesHandler::run() {
-        boost::posix_time::milliseconds duration(LOOP_INTERVAL);
-        boost::this_thread::sleep<boost::posix_time::milliseconds>(duration);
+        std::vector<std::string> timedOut;
         {
-            //boost::this_thread::disable_interruption di;
-            {
-                boost::lock_guard<boost::mutex> lock(this->m_mutex);
-                if (!this->listeners.empty()) {
-                    for (listenersList_t::const_iterator it = this->listeners.begin(); it != this->listeners.end(); ) {
-                        ResponseCallBack* m = (*it).second;
-                        if ((boost::get_system_time() >= m->timeout) && (m->isTimeout == false)) {
-                            m->isTimeout = true;
-                            std::string msg = "Response: Error\r\nActionID: " + m->getAction()->getActionId() + "\r\nMessage: Time Out\r\n\r\n";
-                            this->notifyResponseMessage(msg);
-                        } else {
-                            ++it;
-                        }
-                    }
+            boost::unique_lock<boost::mutex> lock(this->m_mutex);
+            uint64_t next = this->timeouts.getNextTick();
+            uint64_t now = TimerWheel::now();
+            if (next > now) {
+                // woken up as well when a listener is added
+                if (next == UINT64_MAX) {
+                    this->m_cond.wait(lock);
+                } else {
+                    this->m_cond.timed_wait(lock, boost::posix_time::milliseconds(next - now));
                 }
+                now = TimerWheel::now();
             }
+
+            // only the expired callbacks are visited, each one once
+            this->timeouts.advance(now, this->expired);
+            for (std::vector<TimerWheel::Timer*>::iterator it = this->expired.begin(); it != this->expired.end(); ++it) {
+                ResponseCallBack* m = static_cast<ResponseCallBack*> (*it);
+                m->isTimeout = true;
+                timedOut.push_back(m->getAction()->getActionId());
+            }
+            this->expired.clear();
+        }
+
+        for (std::vector<std::string>::iterator it = timedOut.begin(); it != timedOut.end(); ++it) {
+            this->notifyResponseMessage("Response: Error\r\nActionID: " + *it + "\r\nMessage: Time Out\r\n\r\n");
         }
     }
 
     void ManagerResponsesHandler::clear() {
-        boost::lock_guard<boost::mutex> lock(this->m_mutex);
-        for (listenersList_t::const_iterator it = this->listeners.begin(); it != this->listeners.end(); ) {
-            removeResponseListener((*it++).first);
+        std::vector<ResponseCallBack*> callbacks;
+        {
+            boost::lock_guard<boost::mutex> lock(this->m_mutex);
+            this->timeouts.clear();
+            this->listeners.values(callbacks);
+            this->listeners.clear();
+            this->m_cond.notify_all();
+        }
+
+        // the continuations of the futures dropped may send actions, which
+        // adds listeners
+        for (std::vector<ResponseCallBack*>::const_iterator it = callbacks.begin(); it != callbacks.end(); ++it) {
+            delete (*it);
         }
-        this->m_cond.notify_all();
         LOG_TRACE_STR("OUT");
     }
 
-    ResponseCallBack* ManagerResponsesHandler::getListener(const std::string& key) {
-        if (this->listeners.find(key) != this->listeners.end())
-            return (this->listeners[key]);
-
-        return (NULL);
+    ResponseCallBack* ManagerResponsesHandler::getListener(uint64_t id) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (this->listeners.find(id));
     }
 
-    void ManagerResponsesHandler::fireResponseCallback(ManagerResponse *mr) {
+    void ManagerResponsesHandler::fireResponseCallback(uint64_t id, ManagerResponse *mr) {
         LOG_DEBUG_STR("FIRE RESPONSE " + "::" + mr->toLog());
-        std::string key = mr->getActionId();
 
-        ResponseCallBack* listner = this->getListener(key);
+        // out of the table first, a synchronous caller deletes the action once fired
+        ResponseCallBack* listner = this->detachResponseListener(id);
         if (listner) {
             listner->fireCallBack(mr);
+            delete (listner);
         }
-        removeResponseListener(key);
 
     }
 
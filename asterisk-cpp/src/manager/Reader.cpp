@@ -7,7 +7,7 @@
 
 #include "asteriskcpp/manager/Reader.h"
 #include <stdlib.h>
-#include <boost/algorithm/string/predicate.hpp>
+#include <boost/bind.hpp>
 #include "asteriskcpp/exceptions/Exception.h"
 #include "asteriskcpp/exceptions/IOException.h"
 #include "asteriskcpp/utils/LogHandler.h"
@@ -16,167 +16,234 @@
 #include "asteriskcpp/manager/responses/ManagerResponse.h"
 #include "asteriskcpp/manager/events/ManagerEvent.h"
 
-#define SOCKET_WAIT 0
-
-const std::string SEP("\r\n\r\n");
-const std::string SEPLN("\r\n");
-const unsigned int RCVBUFSIZE = 65536;
-
 namespace asteriskcpp {
 
    Reader::Reader()
-      : connectionSocket(NULL)
+      : reactor(IOReactor::getInstance())
+        , connectionSocket(NULL)
         , dispatcher(NULL)
-        , responseMessageTable(NULL)
-        , eventMessageTable(NULL)
-        , responseThread(NULL)
-        , eventThread(NULL)
+        , followsPending(false)
+        , lost(false)
+        , pendingEvent(false)
+        , blocked(false)
+        , resumeCallback(boost::bind(&IOReactor::resume, reactor, (IOHandler*) this))
+        , target(NULL)
    {
    }
 
     void Reader::start(TCPSocket* s, Dispatcher* d) {
-        connectionSocket = s;
-        dispatcher = d;
-
-        if (this->responseMessageTable == NULL) {
-            this->responseMessageTable = new MessageTable();
-        }
-        if (this->responseThread == NULL) {
-            this->responseThread = new ResponseDispatchThread(this->responseMessageTable, d);
-            this->responseThread->start();
+        {
+            boost::mutex::scoped_lock lock(stateMutex);
+            connectionSocket = s;
+            dispatcher = d;
+            framer.reset();
+            followsPending = false;
+            lost = false;
+            pending = DispatchMessage();
+            blocked = false;
+            target = d;
+            if (!dispatchGroup) {
+                dispatchGroup.reset(new DispatchGroup());
+            }
         }
-        if (this->eventMessageTable == NULL) {
-            this->eventMessageTable = new MessageTable();
+
+        reactor->add(s->getSocketFD(), this);
+    }
+
+    Reader::~Reader() {
+        reactor->remove(this);
+        stopDispatching();
+    }
+
+    void Reader::setDispatchGroup(const DispatchGroupPtr& group) {
+        boost::mutex::scoped_lock lock(stateMutex);
+        dispatchGroup = group;
+    }
+
+    void Reader::stopDispatching() {
+        DispatchGroupPtr group;
+        Dispatcher* d;
+        {
+            boost::mutex::scoped_lock lock(stateMutex);
+            group.swap(dispatchGroup);
+            d = target;
         }
-        if (this->eventThread == NULL) {
-            this->eventThread = new EventDispatchThread(this->eventMessageTable, d);
-            this->eventThread->start();
+        if (group && d != NULL) {
+            group->detach(d);
         }
+        // the threads stop with the last reference to the group
+    }
 
-        Thread::start();
+    bool Reader::stop() {
+        // after this no notification is running nor will be
+        reactor->remove(this);
+        return (release(false) != NULL);
     }
 
-    Reader::~Reader() {
-        this->responseThread->stop();
-        this->eventThread->stop();
-        delete this->responseThread;
-        delete this->eventThread;
-        delete this->responseMessageTable;
-        delete this->eventMessageTable;
+    bool Reader::takeHangup() {
+        return (release(true) != NULL);
     }
 
-    void Reader::stop() {
-        Thread::stop();
-        dispatcher->notifyDisconnect();
+    Dispatcher* Reader::release(bool lostOnly) {
+        boost::mutex::scoped_lock lock(stateMutex);
+        if (dispatcher == NULL || (lostOnly && !lost)) {
+            return (NULL);
+        }
+
+        Dispatcher* d = dispatcher;
         dispatcher = NULL;
         connectionSocket = NULL;
+        lost = false;
+        if (followsPending) {
+            // the response will not end
+            this->dispatchGroup->putResponse(target, SlabView(), true);
+            followsPending = false;
+        }
+        return (d);
+    }
+
+    void Reader::hangup() {
+        {
+            boost::mutex::scoped_lock lock(stateMutex);
+            if (dispatcher == NULL) {
+                return;
+            }
+            connectionSocket = NULL;
+            lost = true;
+        }
+        if (!blocked) {
+            postHangup();
+        }
     }
 
-    void Reader::run() {
+    void Reader::postHangup() {
+        // the connection is torn down from the dispatch thread, after what was read
+        DispatchMessage message(target, SlabView());
+        message.hangup = true;
+        post(message, false);
+    }
+
+    bool Reader::post(const DispatchMessage& message, bool event) {
+        bool queued = event
+                ? this->dispatchGroup->tryPutEvent(message, resumeCallback)
+                : this->dispatchGroup->tryPutResponse(message, resumeCallback);
+        if (!queued) {
+            // taken when the dispatch thread made room, see onReadable
+            pending = message;
+            pendingEvent = event;
+            blocked = true;
+            reactor->pause(this);
+        } else if (message.hangup) {
+            reactor->remove(this);
+        }
+        return (queued);
+    }
+
+    void Reader::onReadable() {
         try {
-            char buffer[(RCVBUFSIZE + 1)] = "\0";
-
-            if (connectionSocket != NULL && connectionSocket->check4readData(SOCKET_WAIT)) {
-                int bytesRead = connectionSocket->readData(buffer, RCVBUFSIZE);
-                if (bytesRead > 0) {
-                    std::string rsv(buffer, bytesRead);
-                    processIncomming(rsv);
-                    rsv.clear();
+            if (blocked) {
+                blocked = false;
+                if (!post(pending, pendingEvent) || pending.hangup) {
+                    return;
+                }
+                pending = DispatchMessage();
+            }
+            if (connectionSocket == NULL) {
+                // lost while the queue was full
+                postHangup();
+                return;
+            }
+
+            // the frames read before the queue was full
+            processIncomming();
+
+            // drain what the kernel has, the reactor is level triggered
+            unsigned int capacity;
+            int bytesRead;
+            while (!blocked) {
+                char* buffer = framer.writePtr();
+                capacity = (unsigned int) framer.writeCapacity();
+                bytesRead = connectionSocket->receive(buffer, capacity);
+                if (bytesRead <= 0) {
+                    break;
+                }
+                framer.commit(bytesRead);
+                processIncomming();
+                if ((unsigned int) bytesRead < capacity) {
+                    break;
                 }
-            } else {
-                usleep(5000);
             }
         } catch (SocketException& e) {
-            stop();
-            std::cout << "___CATCH SocketException" << std::endl;
             LOG_ERROR_STR(e.getMessage());
+            hangup();
         } catch (Exception& e) {
-            stop();
-            std::cout << "___CATCH Exception" << std::endl;
             LOG_ERROR_STR(e.getMessage());
+            hangup();
         }
     }
 
-    void Reader::delegeteResponseMessage(const std::string& responseMessage) {
-        this->responseMessageTable->put(responseMessage);
+    bool Reader::delegeteResponseMessage(const std::string& responseMessage) {
+        if (!this->dispatchGroup) {
+            return (false);
+        }
+        this->dispatchGroup->putResponse(target, SlabView::fromString(responseMessage));
+        return (true);
     }
 
-    void Reader::delegeteEventMessage(const std::string& eventMessage) {
-        this->eventMessageTable->put(eventMessage);
+    bool Reader::delegeteEventMessage(const std::string& eventMessage) {
+        if (!this->dispatchGroup) {
+            return (false);
+        }
+        this->dispatchGroup->putEvent(target, SlabView::fromString(eventMessage));
+        return (true);
     }
 
-    void Reader::processIncomming(const std::string& newStr) {
-        size_t cutAt, endAt;
-
-        //LOG_TRACE_STR(str2Log(newStr));
-
-        std::string str;
-        str.append(unprocessedStr);
-        str.append(newStr);
-        unprocessedStr.clear();
-
-        while ((cutAt = str.find(SEPLN)) != str.npos) {
-            if (cutAt > 0) {
-                int type(0);
-                std::string endDelim;
-
-                if (boost::istarts_with(str, "Asterisk")) {
-                    type = 1;
-                    endDelim = SEPLN;
-                } else if (boost::istarts_with(str, "Response:")) {
-                    if (boost::istarts_with(str, "Response: Follows")) {
-                        type = 2;
-                        endDelim = "\n--END COMMAND--\r\n\r\n";
-                    } else {
-                        type = 3;
-                        endDelim = SEP;
-                    }
-                } else if (boost::istarts_with(str, "Event:")) {
-                    type = 4;
-                    endDelim = SEP;
-                }
+    void Reader::processIncomming() {
+        SlabView frame;
+        Framer::FrameType type;
+
+        while (!blocked && framer.next(frame, type)) {
+            LOG_TRACE_DATA("[DISPATCH: " << type << "::::" << frame.length() << " bytes:DISPATCH]");
 
-                if ((endAt = str.find(endDelim)) == str.npos) {
+            switch (type) {
+                case Framer::FRAME_PROTOCOL:
+                {
+                    AsteriskVersion ver;
+                    ver.setManagerValues(frame.str());
+                    dispatcher->dispatchAsteriskVersion(&ver);
+                }
                     break;
+                case Framer::FRAME_FOLLOWS_PART:
+                {
+                    followsPending = true;
+                    post(DispatchMessage(target, frame, true), false);
                 }
-
-                std::string nstr = str.substr(0, endAt);
-
-                LOG_TRACE_DATA("[DISPATCH: " << type << "::::" << str2Log(nstr) << ":DISPATCH]");
-
-                switch (type) {
-                    case 1:
-                    {
-                        AsteriskVersion ver;
-                        ver.setManagerValues(nstr);
-                        dispatcher->dispatchAsteriskVersion(&ver);
-                    }
-                        break;
-                    case 2:
-                    case 3:
-                    {
-                        this->responseMessageTable->put(nstr);
-                    }
-                        break;
-                    case 4:
-                    {
-                        this->eventMessageTable->put(nstr);
-                    }
+                    break;
+                case Framer::FRAME_FOLLOWS:
+                    if (followsPending) {
+                        // the end of the parts
+                        followsPending = false;
+                        post(DispatchMessage(target, frame, true, true), false);
                         break;
-                    default:
-                    {
-                        LOG_WARN_STR("INVALID Type Received" + nstr);
                     }
-                        break;
+                    // falls through - a Follows response held in full
+                case Framer::FRAME_RESPONSE:
+                {
+                    followsPending = false;
+                    post(DispatchMessage(target, frame), false);
                 }
-
-                str = str.substr(endAt + endDelim.length());
-            } else
-                str = str.substr(SEPLN.length());
-        }
-        if (str.length() > 0) {
-            unprocessedStr.append(str); // saves data not processed
+                    break;
+                case Framer::FRAME_EVENT:
+                {
+                    post(DispatchMessage(target, frame), true);
+                }
+                    break;
+                default:
+                {
+                    LOG_WARN_STR("INVALID Type Received" + frame.str());
+                }
+                    break;
+            }
         }
     }
 }
-
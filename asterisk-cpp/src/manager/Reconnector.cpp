@@ -0,0 +1,121 @@
+/*
+ * Reconnector.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "asteriskcpp/manager/Reconnector.h"
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include "asteriskcpp/utils/LogHandler.h"
+#include "asteriskcpp/utils/StringUtils.h"
+#include <ctime>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#define DEFAULT_INITIAL_DELAY 500
+#define DEFAULT_MAX_DELAY 30000
+// doublings before the delay stops growing, whatever the maximum
+#define MAX_DOUBLINGS 20
+
+namespace asteriskcpp {
+
+    Reconnector::Reconnector(ManagerConnection* connection) :
+    connection(connection), scheduled(false), rescheduled(false), attempts(0), initialDelay(DEFAULT_INITIAL_DELAY), maxDelay(DEFAULT_MAX_DELAY),
+    random((uint32_t) std::time(0) ^ (uint32_t) (size_t) this) {
+    }
+
+    Reconnector::~Reconnector() {
+        stop();
+    }
+
+    void Reconnector::schedule() {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (!scheduled) {
+            attempts = 0;
+        }
+        scheduled = true;
+        rescheduled = true;
+        this->m_cond.notify_all();
+    }
+
+    void Reconnector::cancel() {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        scheduled = false;
+        rescheduled = false;
+        this->m_cond.notify_all();
+    }
+
+    bool Reconnector::isScheduled() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (scheduled);
+    }
+
+    size_t Reconnector::getAttempts() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (attempts);
+    }
+
+    unsigned int Reconnector::getInitialDelay() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (initialDelay);
+    }
+
+    unsigned int Reconnector::getMaxDelay() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (maxDelay);
+    }
+
+    void Reconnector::setDelays(unsigned int initialDelay, unsigned int maxDelay) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        this->initialDelay = initialDelay > 0 ? initialDelay : 1;
+        this->maxDelay = maxDelay > this->initialDelay ? maxDelay : this->initialDelay;
+    }
+
+    void Reconnector::stop() {
+        cancel();
+        Thread::stop();
+    }
+
+    unsigned int Reconnector::nextDelay() {
+        uint64_t delay = (uint64_t) initialDelay << (attempts < MAX_DOUBLINGS ? attempts : MAX_DOUBLINGS);
+        if (delay > maxDelay) {
+            delay = maxDelay;
+        }
+        boost::random::uniform_int_distribution<uint64_t> jitter(delay / 2, delay);
+        return ((unsigned int) jitter(random));
+    }
+
+    void Reconnector::run() {
+        {
+            boost::unique_lock<boost::mutex> lock(this->m_mutex);
+            while (!scheduled) {
+                this->m_cond.wait(lock);
+            }
+
+            unsigned int delay = nextDelay();
+            LOG_INFO_STR("Reconnecting in " + convertToString(delay) + " ms");
+            boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(delay);
+            while (scheduled && this->m_cond.timed_wait(lock, deadline)) {
+            }
+            if (!scheduled) {
+                return;
+            }
+            rescheduled = false;
+        }
+
+        bool done;
+        {
+            // stop waits for the attempt, login blocks on its own responses
+            boost::this_thread::disable_interruption noInterruption;
+            done = connection->reconnect();
+        }
+
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (done && !rescheduled) {
+            LOG_INFO_STR("Reconnected after " + convertToString(attempts) + " failed attempts");
+            scheduled = false;
+        } else if (!done) {
+            attempts++;
+        }
+    }
+
+}
@@ -31,4 +31,17 @@ namespace asteriskcpp {
         return (new ManagerResponse(responseStr));
     }
 
+    ManagerResponse* ResponseBuilder::buildResponse(ManagerAction* action, const SlabView& frame) {
+        ManagerResponse* response;
+        if (frame.istartsWith("Response: Error")) {
+            response = new ManagerError(std::string());
+        } else if (action != NULL) {
+            response = action->expectedResponce(std::string());
+        } else {
+            response = new ManagerResponse(std::string());
+        }
+        response->loadFrame(frame);
+        return (response);
+    }
+
 }
@@ -6,29 +6,222 @@
  */
 
 #include "asteriskcpp/manager/Writer.h"
+#include "asteriskcpp/exceptions/Exception.h"
 #include "asteriskcpp/utils/LogHandler.h"
 #include "asteriskcpp/utils/StringUtils.h"
 
-namespace asteriskcpp {
+#define DEFAULT_CAPACITY 4096
+// most entries and bytes coalesced into one write
+#define MAX_COALESCE_ENTRIES 1024
+#define MAX_COALESCE_BYTES 65536
+// written buffers kept for acquireBuffer, bigger ones are released
+#define MAX_POOLED_BUFFERS 1024
+#define MAX_POOLED_BUFFER_SIZE 4096
 
-    Writer::Writer() {
+namespace asteriskcpp {
 
+    Writer::Writer() :
+    m_connectionSocket(NULL), pendingBytes(0), capacity(DEFAULT_CAPACITY), overflowMode(BLOCK), running(false), writing(false) {
     }
 
     Writer::~Writer() {
+        stop();
     }
 
-    void Writer::start(TCPSocket* s, SynchronisedQueue<std::string>* wq) {
-        m_connectionSocket = s;
-        m_WriteQueue = wq;
+    void Writer::start(TCPSocket* s) {
+        {
+            boost::lock_guard<boost::mutex> lock(this->m_mutex);
+            m_connectionSocket = s;
+            running = true;
+        }
         Thread::start();
     }
 
+    void Writer::stop() {
+        {
+            boost::lock_guard<boost::mutex> lock(this->m_mutex);
+            running = false;
+            if (writing && m_connectionSocket != NULL) {
+                // a write blocked by the peer would never return
+                m_connectionSocket->release();
+            }
+            this->notFull.notify_all();
+        }
+        Thread::stop();
+
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        queue.clear();
+        pendingBytes = 0;
+        m_connectionSocket = NULL;
+    }
+
     void Writer::run() {
-        std::string s_data = m_WriteQueue->Dequeue();
-        LOG_DEBUG_DATA("[SND:" << str2Log(s_data) << ":SND]");
-        m_connectionSocket->writeData(s_data.c_str(), (unsigned int) s_data.size());
+        size_t bytes = 0;
+        {
+            boost::unique_lock<boost::mutex> lock(this->m_mutex);
+            while (queue.empty()) {
+                this->notEmpty.wait(lock);
+            }
+
+            while (!queue.empty() && batch.size() < MAX_COALESCE_ENTRIES && (batch.empty() || bytes + queue.front().length() <= MAX_COALESCE_BYTES)) {
+                bytes += queue.front().length();
+                batch.push_back(std::string());
+                batch.back().swap(queue.front());
+                queue.pop_front();
+            }
+            writing = true;
+            // room was made, producers can go on while this is written
+            this->notFull.notify_all();
+        }
+
+        bool failed = false;
+        try {
+            m_connectionSocket->writeData(batch);
+        } catch (Exception& e) {
+            LOG_ERROR_STR(e.getMessage());
+            failed = true;
+        }
+
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        recycle();
+        writing = false;
+        pendingBytes -= bytes;
+        if (failed && running) {
+            running = false;
+            queue.clear();
+            pendingBytes = 0;
+            // the reader notifies the disconnection
+            m_connectionSocket->release();
+        }
+        this->notFull.notify_all();
     }
 
-}
+    bool Writer::write(const std::string& data) {
+        std::string copy(data);
+        return (writeBuffer(copy));
+    }
 
+    bool Writer::write(const std::vector<std::string>& data) {
+        std::vector<std::string> copy(data);
+        return (writeBuffers(copy));
+    }
+
+    bool Writer::writeBuffer(std::string& data) {
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        if (!makeRoom(lock, 1)) {
+            return (false);
+        }
+        push(data);
+        this->notEmpty.notify_one();
+        return (true);
+    }
+
+    bool Writer::writeBuffers(std::vector<std::string>& data) {
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        if (!makeRoom(lock, data.size())) {
+            return (false);
+        }
+        for (std::vector<std::string>::iterator it = data.begin(); it != data.end(); ++it) {
+            push(*it);
+        }
+        this->notEmpty.notify_one();
+        return (true);
+    }
+
+    void Writer::acquireBuffer(std::string& data) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        if (!pool.empty()) {
+            data.swap(pool.back());
+            pool.pop_back();
+        }
+        data.clear();
+    }
+
+    void Writer::acquireBuffers(std::vector<std::string>& data) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        for (std::vector<std::string>::iterator it = data.begin(); it != data.end() && !pool.empty(); ++it) {
+            it->swap(pool.back());
+            pool.pop_back();
+            it->clear();
+        }
+    }
+
+    void Writer::recycle() {
+        for (std::vector<std::string>::iterator it = batch.begin(); it != batch.end() && pool.size() < MAX_POOLED_BUFFERS; ++it) {
+            if (it->capacity() <= MAX_POOLED_BUFFER_SIZE) {
+                it->clear();
+                pool.push_back(std::string());
+                pool.back().swap(*it);
+            }
+        }
+        batch.clear();
+    }
+
+    bool Writer::makeRoom(boost::unique_lock<boost::mutex>& lock, size_t count) {
+        while (running && !queue.empty() && queue.size() + count > capacity) {
+            switch (overflowMode) {
+                case FAIL_FAST:
+                    return (false);
+                case DROP_OLDEST:
+                    LOG_WARN_STR("Write queue full, dropping " + convertToString(queue.front().length()) + " bytes");
+                    pendingBytes -= queue.front().length();
+                    queue.pop_front();
+                    break;
+                default:
+                    this->notFull.wait(lock);
+                    break;
+            }
+        }
+        return (running);
+    }
+
+    void Writer::push(std::string& data) {
+        pendingBytes += data.length();
+        queue.push_back(std::string());
+        queue.back().swap(data);
+    }
+
+    bool Writer::flush(unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        boost::unique_lock<boost::mutex> lock(this->m_mutex);
+        while (running && pendingBytes > 0) {
+            if (!this->notFull.timed_wait(lock, deadline)) {
+                break;
+            }
+        }
+        return (pendingBytes == 0);
+    }
+
+    size_t Writer::getQueueDepth() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (queue.size());
+    }
+
+    size_t Writer::getPendingBytes() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (pendingBytes);
+    }
+
+    size_t Writer::getCapacity() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (capacity);
+    }
+
+    Writer::OverflowMode Writer::getOverflowMode() const {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        return (overflowMode);
+    }
+
+    void Writer::setCapacity(size_t capacity) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        this->capacity = capacity > 0 ? capacity : 1;
+        this->notFull.notify_all();
+    }
+
+    void Writer::setOverflowMode(OverflowMode overflowMode) {
+        boost::lock_guard<boost::mutex> lock(this->m_mutex);
+        this->overflowMode = overflowMode;
+        this->notFull.notify_all();
+    }
+
+}
@@ -21,21 +21,21 @@ namespace asteriskcpp {
      * Returns the name of the channel.
      */
     const std::string& AbsoluteTimeoutAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     /**
      * Sets the name of the channel.
      */
     void AbsoluteTimeoutAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     /**
      * Returns the the maximum duration of the call (in seconds) to set.
      */
     int AbsoluteTimeoutAction::getTimeout() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Timeout));
     }
 
     /**
@@ -43,7 +43,7 @@ namespace asteriskcpp {
      * Setting the timeout to 0 cancels the timeout.
      */
     void AbsoluteTimeoutAction::setTimeout(int timeout) {
-        setSetterValue(__FUNCTION__, timeout);
+        setSetterValue(keys::Timeout, timeout);
     }
 
 } //NS
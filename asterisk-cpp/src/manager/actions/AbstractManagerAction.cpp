@@ -7,12 +7,15 @@
 
 #include "asteriskcpp/manager/actions/AbstractManagerAction.h"
 #include "asteriskcpp/utils/StringUtils.h"
+#include <boost/atomic.hpp>
 
 #define ACTION "Action"
 #define ACTION_ID "ActionID"
+#define SEP ": "
+#define NEWLINE "\r\n"
 
 namespace asteriskcpp {
-    static int lastId;
+    static boost::atomic<uint64_t> lastId(0);
 
     AbstractManagerAction::AbstractManagerAction() {
     }
@@ -34,16 +37,39 @@ namespace asteriskcpp {
         return (this->actionID);
     }
 
-    const std::string AbstractManagerAction::toString() const {
-        std::stringstream stream;
-        stream << makeStdLine(ACTION, this->getAction());
-        stream << makeStdLine(ACTION_ID, this->getActionId());
-        stream << PropertyMap::toString();
+    const std::string& AbstractManagerAction::generateID(const std::string& prefix, uint64_t number) {
+        char digits[20];
+        size_t n = 0;
+        do {
+            digits[n++] = (char) ('0' + number % 10);
+            number /= 10;
+        } while (number > 0);
+
+        this->actionID.reserve(prefix.length() + n);
+        this->actionID.assign(prefix);
+        while (n > 0) {
+            this->actionID.push_back(digits[--n]);
+        }
+        return (this->actionID);
+    }
 
-        std::string to_string = stream.str();
+    const std::string AbstractManagerAction::toString() const {
+        std::string to_string;
+        serialize(to_string);
         return (to_string);
     }
 
+    void AbstractManagerAction::serialize(std::string& out) const {
+        const std::string& name = this->getAction();
+        out.append(ACTION SEP);
+        out.append(name);
+        out.append(NEWLINE ACTION_ID SEP);
+        out.append(this->getActionId());
+        out.append(NEWLINE);
+        appendProperties(out);
+        out.append(NEWLINE);
+    }
+
 }
 
 //NS
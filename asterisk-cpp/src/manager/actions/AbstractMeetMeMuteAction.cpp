@@ -19,19 +19,19 @@ namespace asteriskcpp {
     }
 
     const std::string& AbstractMeetMeMuteAction::getMeetMe() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::MeetMe));
     }
 
     void AbstractMeetMeMuteAction::setMeetMe(const std::string & meetMe) {
-        setSetterValue(__FUNCTION__, meetMe);
+        setSetterValue(keys::MeetMe, meetMe);
     }
 
     int AbstractMeetMeMuteAction::getUserNum() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::UserNum));
     }
 
     void AbstractMeetMeMuteAction::setUserNum(int userNum) {
-        setSetterValue(__FUNCTION__, userNum);
+        setSetterValue(keys::UserNum, userNum);
     }
 
 } /* namespace asterisk_cpp */
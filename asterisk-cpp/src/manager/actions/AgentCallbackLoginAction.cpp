@@ -33,35 +33,35 @@ namespace asteriskcpp {
     }
 
     const std::string& AgentCallbackLoginAction::getExten()const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     void AgentCallbackLoginAction::setExten(const std::string& exten) {
-        setSetterValue(__FUNCTION__, exten);
+        setSetterValue(keys::Exten, exten);
     }
 
     const std::string& AgentCallbackLoginAction::getContext()const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     void AgentCallbackLoginAction::setContext(const std::string& context) {
-        setSetterValue(__FUNCTION__, context);
+        setSetterValue(keys::Context, context);
     }
 
     bool AgentCallbackLoginAction::getAckCall() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::AckCall));
     }
 
     void AgentCallbackLoginAction::setAckCall(bool ackCall) {
-        setSetterValue(__FUNCTION__, ackCall);
+        setSetterValue(keys::AckCall, ackCall);
     }
 
     long AgentCallbackLoginAction::getWrapupTime() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::WrapupTime));
     }
 
     void AgentCallbackLoginAction::setWrapupTime(long wrapupTime) {
-        setSetterValue(__FUNCTION__, wrapupTime);
+        setSetterValue(keys::WrapupTime, wrapupTime);
     }
 
 }
\ No newline at end of file
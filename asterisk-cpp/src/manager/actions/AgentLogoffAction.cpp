@@ -25,19 +25,19 @@ namespace asteriskcpp {
     }
 
     const std::string& AgentLogoffAction::getAgent() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Agent));
     }
 
     void AgentLogoffAction::setAgent(const std::string& agent) {
-        setSetterValue(__FUNCTION__, agent);
+        setSetterValue(keys::Agent, agent);
     }
 
     bool AgentLogoffAction::getSoft() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Soft));
     }
 
     void AgentLogoffAction::setSoft(bool soft) {
-        setSetterValue(__FUNCTION__, soft);
+        setSetterValue(keys::Soft, soft);
     }
 
 }
\ No newline at end of file
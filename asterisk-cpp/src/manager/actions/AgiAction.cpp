@@ -29,27 +29,27 @@ namespace asteriskcpp {
     }
 
     const std::string& AgiAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void AgiAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& AgiAction::getCommand() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Command));
     }
 
     void AgiAction::setCommand(const std::string& command) {
-        setSetterValue(__FUNCTION__, command);
+        setSetterValue(keys::Command, command);
     }
 
     const std::string& AgiAction::getCommandId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CommandId));
     }
 
     void AgiAction::setCommandId(const std::string& commandId) {
-        setSetterValue(__FUNCTION__, commandId);
+        setSetterValue(keys::CommandId, commandId);
     }
 
 
@@ -38,7 +38,7 @@ namespace asteriskcpp {
      * @return the name of the channel to transfer
      */
     const std::string& AtxferAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     /**
@@ -47,7 +47,7 @@ namespace asteriskcpp {
      * @param channel the name of the channel to transfer
      */
     void AtxferAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     /**
@@ -56,7 +56,7 @@ namespace asteriskcpp {
      * @return the destination context
      */
     const std::string& AtxferAction::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     /**
@@ -65,7 +65,7 @@ namespace asteriskcpp {
      * @param context the destination context
      */
     void AtxferAction::setContext(const std::string& context) {
-        setSetterValue(__FUNCTION__, context);
+        setSetterValue(keys::Context, context);
     }
 
     /**
@@ -74,7 +74,7 @@ namespace asteriskcpp {
      * @return the destination extension
      */
     const std::string& AtxferAction::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     /**
@@ -83,7 +83,7 @@ namespace asteriskcpp {
      * @param exten the destination extension
      */
     void AtxferAction::setExten(const std::string& exten) {
-        setSetterValue(__FUNCTION__, exten);
+        setSetterValue(keys::Exten, exten);
     }
 
     /**
@@ -92,11 +92,11 @@ namespace asteriskcpp {
      * @return the destination priority
      */
     int AtxferAction::getPriority() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Priority));
     }
 
     void AtxferAction::setPriority(int priority) {
-        setSetterValue<int>(__FUNCTION__, priority);
+        setSetterValue<int>(keys::Priority, priority);
     }
 } //NAMESPACE
 
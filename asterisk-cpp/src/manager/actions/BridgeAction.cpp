@@ -46,7 +46,7 @@ namespace asteriskcpp {
      * @return the name of the channel to bridge to channel2.
      */
     const std::string& BridgeAction::getChannel1() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel1));
     }
 
     /**
@@ -55,7 +55,7 @@ namespace asteriskcpp {
      * @param channel1 the name of the channel to bridge to channel2.
      */
     void BridgeAction::setChannel1(const std::string& channel1) {
-        setSetterValue(__FUNCTION__, channel1);
+        setSetterValue(keys::Channel1, channel1);
     }
 
     /**
@@ -64,7 +64,7 @@ namespace asteriskcpp {
      * @return the name of the channel to bridge to channel1.
      */
     const std::string& BridgeAction::getChannel2() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel2));
     }
 
     /**
@@ -73,7 +73,7 @@ namespace asteriskcpp {
      * @param channel2 the name of the channel to bridge to channel1.
      */
     void BridgeAction::setChannel2(const std::string& channel2) {
-        setSetterValue(__FUNCTION__, channel2);
+        setSetterValue(keys::Channel2, channel2);
     }
 
     /**
@@ -83,11 +83,11 @@ namespace asteriskcpp {
      *         <code>null</code> (if not set) otherwise.
      */
     bool BridgeAction::getTone() const {
-        return (getGetterValue<bool >(__FUNCTION__));
+        return (getGetterValue<bool >(keys::Tone));
     }
 
     void BridgeAction::setTone(bool tone) {
-        setSetterValue<bool>(__FUNCTION__, tone);
+        setSetterValue<bool>(keys::Tone, tone);
     }
 } //NAMESPACE
 
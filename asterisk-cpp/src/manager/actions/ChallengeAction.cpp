@@ -17,11 +17,11 @@ namespace asteriskcpp {
     }
 
     const std::string& ChallengeAction::getAuthType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AuthType));
     }
 
     void ChallengeAction::setAuthType(const std::string& authType) {
-        setSetterValue(__FUNCTION__, authType);
+        setSetterValue(keys::AuthType, authType);
     }
 
 }/* namespace asterisk_cpp */
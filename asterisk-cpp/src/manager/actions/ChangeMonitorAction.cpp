@@ -35,7 +35,7 @@ namespace asteriskcpp {
      * Returns the name of the monitored channel.
      */
     const std::string& ChangeMonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     /**
@@ -43,18 +43,18 @@ namespace asteriskcpp {
      * This property is mandatory.
      */
     void ChangeMonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     /**
      * Returns the name of the file to which the voice data is written.
      */
     const std::string& ChangeMonitorAction::getFile() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::File));
     }
 
     void ChangeMonitorAction::setFile(const std::string& file) {
-        setSetterValue(__FUNCTION__, file);
+        setSetterValue(keys::File, file);
     }
 } //NAMESPACE
 
@@ -21,11 +21,11 @@ namespace asteriskcpp {
     }
 
     const std::string& CommandAction::getCommand() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Command));
     }
 
     void CommandAction::setCommand(std::string command) {
-        setSetterValue(__FUNCTION__, command);
+        setSetterValue(keys::Command, command);
     }
 
     ManagerResponse *CommandAction::expectedResponce(const std::string & response) {
@@ -32,25 +32,25 @@ namespace asteriskcpp {
      * Sets the id of the conference to kick a channel from.
      */
     void ConfbridgeKickAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     /**
      * Returns the id of the conference to kick a channel from.
      */
     const std::string& ConfbridgeKickAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 
     /**
      * Sets the number of the channel to kick.
      */
     void ConfbridgeKickAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& ConfbridgeKickAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 } //NAMESPACE
 
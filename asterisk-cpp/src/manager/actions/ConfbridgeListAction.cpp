@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     void ConfbridgeListAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     const std::string& ConfbridgeListAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 } //NAMESPACE
 
@@ -29,11 +29,11 @@ namespace asteriskcpp {
      * Sets the id of the conference to lock.
      */
     void ConfbridgeLockAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     const std::string& ConfbridgeLockAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 } //NAMESPACE
 
@@ -32,22 +32,22 @@ namespace asteriskcpp {
      * Sets the id of the conference.
      */
     void ConfbridgeMuteAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     /**
      * Returns the id of the conference.
      */
     const std::string& ConfbridgeMuteAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 
     void ConfbridgeMuteAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& ConfbridgeMuteAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 } //NAMESPACE
 
@@ -22,25 +22,25 @@ namespace asteriskcpp {
      * Sets the id of the conference for which the video source is to be set.
      */
     void ConfbridgeSetSingleVideoSrcAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     /**
      * Returns the id of the conference for which the video source is to be set.
      */
     const std::string& ConfbridgeSetSingleVideoSrcAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 
     /**
      * Sets the channel which will be the single video source of the conference.
      */
     void ConfbridgeSetSingleVideoSrcAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& ConfbridgeSetSingleVideoSrcAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 } //NAMESPACE
 
@@ -29,11 +29,11 @@ namespace asteriskcpp {
      * Sets the id of the conference for which to start an audio recording.
      */
     void ConfbridgeStartRecordAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     const std::string& ConfbridgeStartRecordAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 } //NAMESPACE
 
@@ -29,11 +29,11 @@ namespace asteriskcpp {
      * Sets the id of the conference for which to stop an audio recording.
      */
     void ConfbridgeStopRecordAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     const std::string& ConfbridgeStopRecordAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 } //NAMESPACE
 
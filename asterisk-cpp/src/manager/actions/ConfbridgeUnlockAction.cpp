@@ -29,11 +29,11 @@ namespace asteriskcpp {
      * Sets the id of the conference to unlock.
      */
     void ConfbridgeUnlockAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     const std::string& ConfbridgeUnlockAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 } //NAMESPACE
 
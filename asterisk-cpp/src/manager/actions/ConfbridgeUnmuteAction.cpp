@@ -32,25 +32,25 @@ namespace asteriskcpp {
      * Sets the id of the conference.
      */
     void ConfbridgeUnmuteAction::setConference(const std::string& conference) {
-        setSetterValue(__FUNCTION__, conference);
+        setSetterValue(keys::Conference, conference);
     }
 
     /**
      * Returns the id of the conference.
      */
     const std::string& ConfbridgeUnmuteAction::getConference() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Conference));
     }
 
     /**
      * Sets the number of the channel to unmute.
      */
     void ConfbridgeUnmuteAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& ConfbridgeUnmuteAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 } //NAMESPACE
 
@@ -34,7 +34,7 @@ namespace asteriskcpp {
      * @return the family of the key to delete
      */
     const std::string& DbDelTreeAction::getFamily() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Family));
     }
 
     /**
@@ -43,7 +43,7 @@ namespace asteriskcpp {
      * @param family the family of the key to delete
      */
     void DbDelTreeAction::setFamily(const std::string& family) {
-        setSetterValue(__FUNCTION__, family);
+        setSetterValue(keys::Family, family);
     }
 
     /**
@@ -52,11 +52,11 @@ namespace asteriskcpp {
      * @return the key to delete
      */
     const std::string& DbDelTreeAction::getKey() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Key));
     }
 
     void DbDelTreeAction::setKey(const std::string& key) {
-        setSetterValue(__FUNCTION__, key);
+        setSetterValue(keys::Key, key);
     }
 } //NAMESPACE
 
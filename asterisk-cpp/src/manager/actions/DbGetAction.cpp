@@ -36,7 +36,7 @@ namespace asteriskcpp {
      * @return the family of the key.
      */
     const std::string& DbGetAction::getFamily() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Family));
     }
 
     /**
@@ -45,7 +45,7 @@ namespace asteriskcpp {
      * @param family the family of the key.
      */
     void DbGetAction::setFamily(const std::string& family) {
-        setSetterValue(__FUNCTION__, family);
+        setSetterValue(keys::Family, family);
     }
 
     /**
@@ -54,11 +54,11 @@ namespace asteriskcpp {
      * @return the key of the entry to retrieve.
      */
     const std::string& DbGetAction::getKey() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Key));
     }
 
     void DbGetAction::setKey(const std::string& key) {
-        setSetterValue(__FUNCTION__, key);
+        setSetterValue(keys::Key, key);
     }
 } //NAMESPACE
 
@@ -37,7 +37,7 @@ namespace asteriskcpp {
      * @return the family of the key to set.
      */
     const std::string& DbPutAction::getFamily() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Family));
     }
 
     /**
@@ -46,7 +46,7 @@ namespace asteriskcpp {
      * @param family the family of the key to set.
      */
     void DbPutAction::setFamily(const std::string& family) {
-        setSetterValue(__FUNCTION__, family);
+        setSetterValue(keys::Family, family);
     }
 
     /**
@@ -55,7 +55,7 @@ namespace asteriskcpp {
      * @return the key to set.
      */
     const std::string& DbPutAction::getKey() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Key));
     }
 
     /**
@@ -64,7 +64,7 @@ namespace asteriskcpp {
      * @param key the key to set.
      */
     void DbPutAction::setKey(const std::string& key) {
-        setSetterValue(__FUNCTION__, key);
+        setSetterValue(keys::Key, key);
     }
 
     /**
@@ -73,7 +73,7 @@ namespace asteriskcpp {
      * @return the value to set.
      */
     const std::string& DbPutAction::getVal() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Val));
     }
 
     /**
@@ -82,11 +82,11 @@ namespace asteriskcpp {
      * @param val the value to set.
      */
     void DbPutAction::setVal(const std::string& val) {
-        setSetterValue(__FUNCTION__, val);
+        setSetterValue(keys::Val, val);
     }
 
     const std::string& DbPutAction::getValue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Value));
     }
 } //NAMESPACE
 
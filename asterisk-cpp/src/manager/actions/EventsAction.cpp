@@ -16,11 +16,11 @@ namespace asteriskcpp {
     }
 
     const std::string& EventsAction::getEventMask() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::EventMask));
     }
 
     void EventsAction::setEventMask(const std::string& eventMask) {
-        setSetterValue(__FUNCTION__, eventMask);
+        setSetterValue(keys::EventMask, eventMask);
     }
 
 } //NS
@@ -41,7 +41,7 @@ namespace asteriskcpp {
      * @return the extension to query.
      */
     const std::string& ExtensionStateAction::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     /**
@@ -50,7 +50,7 @@ namespace asteriskcpp {
      * @param exten the extension to query.
      */
     void ExtensionStateAction::setExten(const std::string& exten) {
-        setSetterValue(__FUNCTION__, exten);
+        setSetterValue(keys::Exten, exten);
     }
 
     /**
@@ -59,11 +59,11 @@ namespace asteriskcpp {
      * @return the name of the context that contains the extension to query.
      */
     const std::string& ExtensionStateAction::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     void ExtensionStateAction::setContext(const std::string& context) {
-        setSetterValue(__FUNCTION__, context);
+        setSetterValue(keys::Context, context);
     }
 } //NAMESPACE
 
@@ -0,0 +1,39 @@
+/*
+ * FilterAction.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include "asteriskcpp/manager/actions/FilterAction.h"
+
+namespace asteriskcpp {
+
+    FilterAction::FilterAction(const std::string& filter) {
+        setOperation("Add");
+        setFilter(filter);
+    }
+
+    FilterAction::FilterAction(const std::string& operation, const std::string& filter) {
+        setOperation(operation);
+        setFilter(filter);
+    }
+
+    FilterAction::~FilterAction() {
+    }
+
+    const std::string& FilterAction::getOperation() const {
+        return (getGetterValue(keys::Operation));
+    }
+
+    void FilterAction::setOperation(const std::string& operation) {
+        setSetterValue(keys::Operation, operation);
+    }
+
+    const std::string& FilterAction::getFilter() const {
+        return (getGetterValue(keys::Filter));
+    }
+
+    void FilterAction::setFilter(const std::string& filter) {
+        setSetterValue(keys::Filter, filter);
+    }
+
+} //NS
@@ -36,11 +36,11 @@ namespace asteriskcpp {
      * Returns the filename.
      */
     const std::string& GetConfigAction::getFilename() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Filename));
     }
 
     void GetConfigAction::setFilename(const std::string& filename) {
-        setSetterValue(__FUNCTION__, filename);
+        setSetterValue(keys::Filename, filename);
     }
 } //NAMESPACE
 
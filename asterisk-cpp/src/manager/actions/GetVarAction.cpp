@@ -34,21 +34,21 @@ namespace asteriskcpp {
     }
     
     const std::string& GetVarAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
   
     void GetVarAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
   
     const std::string& GetVarAction::getVariable() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Variable));
     }
 
     void GetVarAction::setVariable(const std::string& variable) {
-        setSetterValue(__FUNCTION__, variable);
+        setSetterValue(keys::Variable, variable);
     }
 } //NAMESPACE
 
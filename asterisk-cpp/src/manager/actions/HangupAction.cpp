@@ -25,19 +25,19 @@ namespace asteriskcpp {
     }
 
     const std::string& HangupAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void HangupAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     int HangupAction::getCause() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Cause));
     }
 
     void HangupAction::setCause(int cause) {
-        setSetterValue<int>(__FUNCTION__, cause);
+        setSetterValue<int>(keys::Cause, cause);
     }
 } //NAMESPACE
 
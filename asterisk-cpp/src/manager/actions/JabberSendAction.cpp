@@ -20,27 +20,27 @@ namespace asteriskcpp {
     }
 
     const std::string& JabberSendAction::getJabber() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Jabber));
     }
 
     void JabberSendAction::setJabber(const std::string& jabber) {
-        setSetterValue(__FUNCTION__, jabber);
+        setSetterValue(keys::Jabber, jabber);
     }
 
     const std::string& JabberSendAction::getScreenName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ScreenName));
     }
 
     void JabberSendAction::setScreenName(const std::string& screenName) {
-        setSetterValue(__FUNCTION__, screenName);
+        setSetterValue(keys::ScreenName, screenName);
     }
 
     const std::string& JabberSendAction::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
     void JabberSendAction::setMessage(const std::string& message) {
-        setSetterValue(__FUNCTION__, message);
+        setSetterValue(keys::Message, message);
     }
 } //NAMESPACE
 
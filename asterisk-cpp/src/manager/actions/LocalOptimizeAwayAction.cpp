@@ -22,11 +22,11 @@ namespace asteriskcpp {
 
   
     const std::string& LocalOptimizeAwayAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void LocalOptimizeAwayAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 } //NAMESPACE
 
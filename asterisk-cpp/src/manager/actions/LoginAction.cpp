@@ -35,43 +35,43 @@ namespace asteriskcpp {
     }
 
     const std::string& LoginAction::getUsername() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Username));
     }
 
     void LoginAction::setUsername(const std::string& username) {
-        setSetterValue(__FUNCTION__, username);
+        setSetterValue(keys::Username, username);
     }
 
     const std::string& LoginAction::getSecret() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Secret));
     }
 
     void LoginAction::setSecret(const std::string& secret) {
-        setSetterValue(__FUNCTION__, secret);
+        setSetterValue(keys::Secret, secret);
     }
 
     const std::string& LoginAction::getAuthType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AuthType));
     }
 
     void LoginAction::setAuthType(const std::string& authType) {
-        setSetterValue(__FUNCTION__, authType);
+        setSetterValue(keys::AuthType, authType);
     }
 
     const std::string& LoginAction::getKey() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Key));
     }
 
     void LoginAction::setKey(const std::string& key) {
-        setSetterValue(__FUNCTION__, key);
+        setSetterValue(keys::Key, key);
     }
 
     const std::string& LoginAction::getEvents() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Events));
     }
 
     void LoginAction::setEvents(const std::string& events) {
-        setSetterValue(__FUNCTION__, events);
+        setSetterValue(keys::Events, events);
     }
 
 }
@@ -25,11 +25,11 @@ namespace asteriskcpp {
     }
 
     const std::string& MailboxCountAction::getMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Mailbox));
     }
 
     void MailboxCountAction::setMailbox(const std::string& mailbox) {
-        setSetterValue(__FUNCTION__, mailbox);
+        setSetterValue(keys::Mailbox, mailbox);
     }
 } //NAMESPACE
 
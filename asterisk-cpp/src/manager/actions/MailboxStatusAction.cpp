@@ -25,11 +25,11 @@ namespace asteriskcpp {
     }
 
     const std::string& MailboxStatusAction::getMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Mailbox));
     }
 
     void MailboxStatusAction::setMailbox(const std::string& mailbox) {
-        setSetterValue(__FUNCTION__, mailbox);
+        setSetterValue(keys::Mailbox, mailbox);
     }
 } //NAMESPACE
 
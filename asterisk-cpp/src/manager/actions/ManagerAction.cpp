@@ -8,21 +8,52 @@
 #include "asteriskcpp/manager/actions/ManagerAction.h"
 #include "asteriskcpp/utils/StringUtils.h"
 #include <stdio.h>
+#include <map>
+#include <typeinfo>
+#include <typeindex>
+#include <boost/thread/mutex.hpp>
 
 #include <cxxabi.h>
 
 namespace asteriskcpp {
 
-    ManagerAction::ManagerAction() {
+    typedef std::map<std::type_index, std::string> actionNames_t;
+
+    ManagerAction::ManagerAction() :
+    reconnectPolicy(FAIL_ON_DISCONNECT) {
+    }
+
+    const std::string& ManagerAction::getAction() const {
+        // the class name is demangled once per class
+        static boost::mutex namesMutex;
+        static actionNames_t names;
+
+        boost::mutex::scoped_lock lock(namesMutex);
+        std::type_index type(typeid (*this));
+        actionNames_t::iterator it = names.find(type);
+        if (it == names.end()) {
+            std::string className(this->getClassName());
+            // the nodes are never removed, the reference stays valid
+            it = names.insert(std::make_pair(type, className.substr(0, className.size() - 6))).first;
+        }
+        return (it->second);
     }
 
-    const std::string ManagerAction::getAction() const {
-        return (this->getClassName().substr(0, this->getClassName().size() - 6));
+    void ManagerAction::serialize(std::string& out) const {
+        out.append(this->toString());
     }
 
     ManagerResponse *ManagerAction::expectedResponce(const std::string & response) {
         return (new ManagerResponse(response));
     }
 
+    ManagerAction::ReconnectPolicy ManagerAction::getReconnectPolicy() const {
+        return (reconnectPolicy);
+    }
+
+    void ManagerAction::setReconnectPolicy(ReconnectPolicy reconnectPolicy) {
+        this->reconnectPolicy = reconnectPolicy;
+    }
+
 }
 
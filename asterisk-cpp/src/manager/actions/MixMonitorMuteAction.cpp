@@ -36,27 +36,27 @@ namespace asteriskcpp {
     }
 
     const std::string& MixMonitorMuteAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void MixMonitorMuteAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& MixMonitorMuteAction::getDirection() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Direction));
     }
 
     void MixMonitorMuteAction::setDirection(const std::string& direction) {
-        setSetterValue(__FUNCTION__, direction);
+        setSetterValue(keys::Direction, direction);
     }
 
     int MixMonitorMuteAction::getState() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::State));
     }
 
     void MixMonitorMuteAction::setState(int state) {
-        setSetterValue<int>(__FUNCTION__, state);
+        setSetterValue<int>(keys::State, state);
     }
 } //NAMESPACE
 
@@ -38,11 +38,11 @@ namespace asteriskcpp {
      * @return the name of the module to check.
      */
     const std::string& ModuleCheckAction::getModule() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Module));
     }
 
     void ModuleCheckAction::setModule(const std::string& module) {
-        setSetterValue(__FUNCTION__, module);
+        setSetterValue(keys::Module, module);
     }
 } //NAMESPACE
 
@@ -20,19 +20,19 @@ namespace asteriskcpp {
     }
 
     const std::string& ModuleLoadAction::getModule() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Module));
     }
 
     void ModuleLoadAction::setModule(const std::string& module) {
-        setSetterValue(__FUNCTION__, module);
+        setSetterValue(keys::Module, module);
     }
 
     const std::string& ModuleLoadAction::getLoadType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::LoadType));
     }
 
     void ModuleLoadAction::setLoadType(const std::string& loadType) {
-        setSetterValue(__FUNCTION__, loadType);
+        setSetterValue(keys::LoadType, loadType);
     }
 } //NAMESPACE
 
@@ -32,35 +32,35 @@ namespace asteriskcpp {
     }
 
     const std::string& MonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void MonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& MonitorAction::getFile() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::File));
     }
 
     void MonitorAction::setFile(const std::string& file) {
-        setSetterValue(__FUNCTION__, file);
+        setSetterValue(keys::File, file);
     }
 
     const std::string& MonitorAction::getFormat() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Format));
     }
 
     void MonitorAction::setFormat(const std::string& format) {
-        setSetterValue(__FUNCTION__, format);
+        setSetterValue(keys::Format, format);
     }
 
     bool MonitorAction::getMix() const {
-        return (getGetterValue<bool >(__FUNCTION__));
+        return (getGetterValue<bool >(keys::Mix));
     }
 
     void MonitorAction::setMix(bool mix) {
-        setSetterValue<bool>(__FUNCTION__, mix);
+        setSetterValue<bool>(keys::Mix, mix);
     }
 } //NAMESPACE
 
@@ -25,27 +25,27 @@ namespace asteriskcpp {
     }
 
     const std::string& ParkAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void ParkAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& ParkAction::getChannel2() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel2));
     }
 
     void ParkAction::setChannel2(const std::string& channel2) {
-        setSetterValue(__FUNCTION__, channel2);
+        setSetterValue(keys::Channel2, channel2);
     }
 
     int ParkAction::getTimeout() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Timeout));
     }
 
     void ParkAction::setTimeout(int timeout) {
-        setSetterValue<int>(__FUNCTION__, timeout);
+        setSetterValue<int>(keys::Timeout, timeout);
     }
 } //NAMESPACE
 
@@ -21,27 +21,27 @@ namespace asteriskcpp {
     }
 
     const std::string& PauseMixMonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void PauseMixMonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     int PauseMixMonitorAction::getState() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::State));
     }
 
     void PauseMixMonitorAction::setState(int state) {
-        setSetterValue<int>(__FUNCTION__, state);
+        setSetterValue<int>(keys::State, state);
     }
 
     const std::string& PauseMixMonitorAction::getDirection() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Direction));
     }
 
     void PauseMixMonitorAction::setDirection(const std::string& direction) {
-        setSetterValue(__FUNCTION__, direction);
+        setSetterValue(keys::Direction, direction);
     }
 } //NAMESPACE
 
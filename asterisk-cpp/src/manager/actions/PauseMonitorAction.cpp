@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     const std::string& PauseMonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void PauseMonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 } //NAMESPACE
 
@@ -20,19 +20,19 @@ namespace asteriskcpp {
     }
 
     const std::string& PlayDtmfAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void PlayDtmfAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& PlayDtmfAction::getDigit() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Digit));
     }
 
     void PlayDtmfAction::setDigit(const std::string& digit) {
-        setSetterValue(__FUNCTION__, digit);
+        setSetterValue(keys::Digit, digit);
     }
 } //NAMESPACE
 
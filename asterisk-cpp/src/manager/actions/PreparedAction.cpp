@@ -0,0 +1,195 @@
+/*
+ * PreparedAction.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/manager/actions/PreparedAction.h"
+#include "asteriskcpp/exceptions/RuntimeException.h"
+#include <strings.h>
+
+#define ACTION_ID "ActionID"
+#define SEP ": "
+#define NEWLINE "\r\n"
+
+namespace asteriskcpp {
+
+    struct TemplateLine {
+        size_t begin;
+        size_t end;
+        // end of the key, npos for a line with no key
+        size_t keyEnd;
+    };
+
+    static bool keyEquals(const std::string& str, const TemplateLine& line, const std::string& key) {
+        return (line.keyEnd != std::string::npos && line.keyEnd - line.begin == key.length()
+                && strncasecmp(str.data() + line.begin, key.data(), key.length()) == 0);
+    }
+
+    ActionTemplate::ActionTemplate(ManagerAction* prototype, const std::vector<std::string>& parameters) :
+    prototype(prototype), parameters(parameters), defaults(parameters.size()) {
+        std::string proto;
+        prototype->serialize(proto);
+
+        std::vector<TemplateLine> lines;
+        size_t pos = 0;
+        size_t end;
+        while ((end = proto.find(NEWLINE, pos)) != std::string::npos && end > pos) {
+            TemplateLine line;
+            line.begin = pos;
+            line.end = end;
+            line.keyEnd = proto.find(SEP, pos);
+            if (line.keyEnd >= end) {
+                line.keyEnd = std::string::npos;
+            }
+            lines.push_back(line);
+            pos = end + 2;
+        }
+
+        // as getProperty, the last line of a repeated key is the one used
+        std::vector<size_t> lineOf(parameters.size(), lines.size());
+        for (size_t l = 0; l < lines.size(); l++) {
+            for (size_t p = 0; p < parameters.size(); p++) {
+                if (keyEquals(proto, lines[l], parameters[p])) {
+                    lineOf[p] = l;
+                }
+            }
+        }
+
+        text.reserve(proto.length() + parameters.size() * 16);
+        for (size_t l = 0; l < lines.size(); l++) {
+            const TemplateLine& line = lines[l];
+            Slot slot;
+            slot.parameter = parameters.size() + 1;
+            slot.optionalLine = std::string::npos;
+            if (keyEquals(proto, line, ACTION_ID)) {
+                slot.parameter = parameters.size();
+            }
+            for (size_t p = 0; p < parameters.size(); p++) {
+                if (lineOf[p] == l) {
+                    slot.parameter = p;
+                    defaults[p].assign(proto, line.keyEnd + 2, line.end - line.keyEnd - 2);
+                }
+            }
+
+            if (slot.parameter > parameters.size()) {
+                text.append(proto, line.begin, line.end - line.begin);
+            } else {
+                text.append(proto, line.begin, line.keyEnd + 2 - line.begin);
+                slot.offset = text.length();
+                slots.push_back(slot);
+            }
+            text.append(NEWLINE);
+        }
+
+        for (size_t p = 0; p < parameters.size(); p++) {
+            if (lineOf[p] == lines.size()) {
+                Slot slot;
+                slot.optionalLine = text.length();
+                text.append(parameters[p]);
+                text.append(SEP);
+                slot.offset = text.length();
+                slot.parameter = p;
+                slots.push_back(slot);
+                text.append(NEWLINE);
+            }
+        }
+        text.append(NEWLINE);
+    }
+
+    ActionTemplate::~ActionTemplate() {
+        delete (prototype);
+    }
+
+    const std::string& ActionTemplate::getAction() const {
+        return (prototype->getAction());
+    }
+
+    size_t ActionTemplate::getParameterCount() const {
+        return (parameters.size());
+    }
+
+    const std::string& ActionTemplate::getParameterName(size_t index) const {
+        checkParameter(index);
+        return (parameters[index]);
+    }
+
+    void ActionTemplate::checkParameter(size_t index) const {
+        if (index >= parameters.size()) {
+            Throw(IndexOutOfBoundsException("No parameter " + convertToString(index) + " in " + getAction()));
+        }
+    }
+
+    size_t ActionTemplate::getParameterIndex(const std::string& key) const {
+        for (size_t p = 0; p < parameters.size(); p++) {
+            if (parameters[p].length() == key.length() && strcasecmp(parameters[p].c_str(), key.c_str()) == 0) {
+                return (p);
+            }
+        }
+        return (parameters.size());
+    }
+
+    void ActionTemplate::serialize(std::string& out, const std::string& actionId, const std::vector<std::string>& values) const {
+        size_t length = text.length();
+        for (std::vector<Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it) {
+            length += it->parameter < values.size() ? values[it->parameter].length() : actionId.length();
+        }
+        out.reserve(out.length() + length);
+
+        size_t from = 0;
+        for (std::vector<Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it) {
+            const std::string& value = it->parameter < values.size() ? values[it->parameter] : actionId;
+            if (value.empty() && it->optionalLine != std::string::npos) {
+                out.append(text, from, it->optionalLine - from);
+                from = it->offset + 2;
+            } else {
+                out.append(text, from, it->offset - from);
+                out.append(value);
+                from = it->offset;
+            }
+        }
+        out.append(text, from, std::string::npos);
+    }
+
+    PreparedAction::PreparedAction(const ActionTemplatePtr& actionTemplate) :
+    actionTemplate(actionTemplate), values(actionTemplate->defaults) {
+    }
+
+    PreparedAction::~PreparedAction() {
+    }
+
+    const std::string& PreparedAction::getAction() const {
+        return (actionTemplate->getAction());
+    }
+
+    void PreparedAction::serialize(std::string& out) const {
+        actionTemplate->serialize(out, getActionId(), values);
+    }
+
+    ManagerResponse* PreparedAction::expectedResponce(const std::string& response) {
+        return (actionTemplate->prototype->expectedResponce(response));
+    }
+
+    const ActionTemplatePtr& PreparedAction::getTemplate() const {
+        return (actionTemplate);
+    }
+
+    const std::string& PreparedAction::getParameter(size_t index) const {
+        actionTemplate->checkParameter(index);
+        return (values[index]);
+    }
+
+    const std::string& PreparedAction::getParameter(const std::string& key) const {
+        return (getParameter(actionTemplate->getParameterIndex(key)));
+    }
+
+    void PreparedAction::setParameter(size_t index, const std::string& value) {
+        actionTemplate->checkParameter(index);
+        values[index].assign(value);
+    }
+
+    void PreparedAction::setParameter(const std::string& key, const std::string& value) {
+        setParameter(actionTemplate->getParameterIndex(key), value);
+    }
+
+}
@@ -25,51 +25,51 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueAddAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueueAddAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 
     const std::string& QueueAddAction::getInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Interface));
     }
 
     void QueueAddAction::setInterface(const std::string& iface) {
-        setSetterValue(__FUNCTION__, iface);
+        setSetterValue(keys::Interface, iface);
     }
 
     int QueueAddAction::getPenalty() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Penalty));
     }
 
     void QueueAddAction::setPenalty(int penalty) {
-        setSetterValue<int>(__FUNCTION__, penalty);
+        setSetterValue<int>(keys::Penalty, penalty);
     }
 
     bool QueueAddAction::getPaused() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Paused));
     }
 
     void QueueAddAction::setPaused(bool paused) {
-        setSetterValue<bool>(__FUNCTION__, paused);
+        setSetterValue<bool>(keys::Paused, paused);
     }
 
     const std::string& QueueAddAction::getMemberName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::MemberName));
     }
 
     void QueueAddAction::setMemberName(const std::string& memberName) {
-        setSetterValue(__FUNCTION__, memberName);
+        setSetterValue(keys::MemberName, memberName);
     }
 
     const std::string& QueueAddAction::getStateInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::StateInterface));
     }
 
     void QueueAddAction::setStateInterface(const std::string& stateInterface) {
-        setSetterValue(__FUNCTION__, stateInterface);
+        setSetterValue(keys::StateInterface, stateInterface);
     }
 } //NAMESPACE
 
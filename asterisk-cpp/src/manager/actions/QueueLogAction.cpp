@@ -30,43 +30,43 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueLogAction::getInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Interface));
     }
 
     void QueueLogAction::setInterface(const std::string& iface) {
-        setSetterValue(__FUNCTION__, iface);
+        setSetterValue(keys::Interface, iface);
     }
 
     const std::string& QueueLogAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueueLogAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 
     const std::string& QueueLogAction::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     void QueueLogAction::setUniqueId(const std::string& uniqueId) {
-        setSetterValue(__FUNCTION__, uniqueId);
+        setSetterValue(keys::UniqueId, uniqueId);
     }
 
     const std::string& QueueLogAction::getEvent() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Event));
     }
 
     void QueueLogAction::setEvent(const std::string& event) {
-        setSetterValue(__FUNCTION__, event);
+        setSetterValue(keys::Event, event);
     }
 
     const std::string& QueueLogAction::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
     void QueueLogAction::setMessage(const std::string& message) {
-        setSetterValue(__FUNCTION__, message);
+        setSetterValue(keys::Message, message);
     }
 } //NAMESPACE
 
@@ -36,35 +36,35 @@ namespace asteriskcpp {
     }
 
     const std::string& QueuePauseAction::getInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Interface));
     }
 
     void QueuePauseAction::setInterface(const std::string& iface) {
-        setSetterValue(__FUNCTION__, iface);
+        setSetterValue(keys::Interface, iface);
     }
 
     const std::string& QueuePauseAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueuePauseAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 
     bool QueuePauseAction::getPaused() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Paused));
     }
 
     void QueuePauseAction::setPaused(bool paused) {
-        setSetterValue<bool>(__FUNCTION__, paused);
+        setSetterValue<bool>(keys::Paused, paused);
     }
 
     const std::string& QueuePauseAction::getReason() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Reason));
     }
 
     void QueuePauseAction::setReason(const std::string& reason) {
-        setSetterValue(__FUNCTION__, reason);
+        setSetterValue(keys::Reason, reason);
     }
 } //NAMESPACE
 
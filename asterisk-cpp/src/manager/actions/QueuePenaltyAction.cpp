@@ -27,27 +27,27 @@ namespace asteriskcpp {
     }
 
     const std::string& QueuePenaltyAction::getInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Interface));
     }
 
     void QueuePenaltyAction::setInterface(const std::string& iface) {
-        setSetterValue(__FUNCTION__, iface);
+        setSetterValue(keys::Interface, iface);
     }
 
     int QueuePenaltyAction::getPenalty() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Penalty));
     }
 
     void QueuePenaltyAction::setPenalty(int penalty) {
-        setSetterValue<int>(__FUNCTION__, penalty);
+        setSetterValue<int>(keys::Penalty, penalty);
     }
 
     const std::string& QueuePenaltyAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueuePenaltyAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 } //NAMESPACE
 
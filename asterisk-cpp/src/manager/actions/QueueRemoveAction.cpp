@@ -21,19 +21,19 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueRemoveAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueueRemoveAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 
     const std::string& QueueRemoveAction::getInterface() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Interface));
     }
 
     void QueueRemoveAction::setInterface(const std::string& iface) {
-        setSetterValue(__FUNCTION__, iface);
+        setSetterValue(keys::Interface, iface);
     }
 } //NAMESPACE
 
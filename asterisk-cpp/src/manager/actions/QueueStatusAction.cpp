@@ -16,19 +16,19 @@ namespace asteriskcpp {
     }    
 
     const std::string& QueueStatusAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueueStatusAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 
     const std::string& QueueStatusAction::getMember() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Member));
     }
 
     void QueueStatusAction::setMember(const std::string& member) {
-        setSetterValue(__FUNCTION__, member);
+        setSetterValue(keys::Member, member);
     }
 } //NAMESPACE
 
@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueSummaryAction::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     void QueueSummaryAction::setQueue(const std::string& queue) {
-        setSetterValue(__FUNCTION__, queue);
+        setSetterValue(keys::Queue, queue);
     }
 } //NAMESPACE
 
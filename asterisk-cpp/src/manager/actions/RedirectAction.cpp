@@ -42,67 +42,67 @@ namespace asteriskcpp {
     }
 
     const std::string& RedirectAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void RedirectAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& RedirectAction::getExtraChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ExtraChannel));
     }
 
     void RedirectAction::setExtraChannel(const std::string& extraChannel) {
-        setSetterValue(__FUNCTION__, extraChannel);
+        setSetterValue(keys::ExtraChannel, extraChannel);
     }
 
     const std::string& RedirectAction::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     void RedirectAction::setContext(const std::string& context) {
-        setSetterValue(__FUNCTION__, context);
+        setSetterValue(keys::Context, context);
     }
 
     const std::string& RedirectAction::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     void RedirectAction::setExten(const std::string& exten) {
-        setSetterValue(__FUNCTION__, exten);
+        setSetterValue(keys::Exten, exten);
     }
 
     int RedirectAction::getPriority() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Priority));
     }
 
     void RedirectAction::setPriority(int priority) {
-        setSetterValue<int>(__FUNCTION__, priority);
+        setSetterValue<int>(keys::Priority, priority);
     }
 
     const std::string& RedirectAction::getExtraContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ExtraContext));
     }
 
     void RedirectAction::setExtraContext(const std::string& extraContext) {
-        setSetterValue(__FUNCTION__, extraContext);
+        setSetterValue(keys::ExtraContext, extraContext);
     }
 
     const std::string& RedirectAction::getExtraExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ExtraExten));
     }
 
     void RedirectAction::setExtraExten(const std::string& extraExten) {
-        setSetterValue(__FUNCTION__, extraExten);
+        setSetterValue(keys::ExtraExten, extraExten);
     }
 
     int RedirectAction::getExtraPriority() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ExtraPriority));
     }
 
     void RedirectAction::setExtraPriority(int extraPriority) {
-        setSetterValue<int>(__FUNCTION__, extraPriority);
+        setSetterValue<int>(keys::ExtraPriority, extraPriority);
     }
 } //NAMESPACE
 
@@ -21,19 +21,19 @@ namespace asteriskcpp {
     }
 
     const std::string& SendTextAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void SendTextAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& SendTextAction::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
     void SendTextAction::setMessage(const std::string& message) {
-        setSetterValue(__FUNCTION__, message);
+        setSetterValue(keys::Message, message);
     }
 } //NAMESPACE
 
@@ -27,27 +27,27 @@ namespace asteriskcpp {
     }
 
     const std::string& SetCdrUserFieldAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void SetCdrUserFieldAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& SetCdrUserFieldAction::getUserField() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UserField));
     }
 
     void SetCdrUserFieldAction::setUserField(const std::string& userField) {
-        setSetterValue(__FUNCTION__, userField);
+        setSetterValue(keys::UserField, userField);
     }
 
     bool SetCdrUserFieldAction::getAppend() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Append));
     }
 
     void SetCdrUserFieldAction::setAppend(bool append) {
-        setSetterValue<bool>(__FUNCTION__, append);
+        setSetterValue<bool>(keys::Append, append);
     }
 } //NAMESPACE
 
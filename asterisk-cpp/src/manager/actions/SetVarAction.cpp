@@ -27,27 +27,27 @@ namespace asteriskcpp {
     }
 
     const std::string& SetVarAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void SetVarAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& SetVarAction::getVariable() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Variable));
     }
 
     void SetVarAction::setVariable(const std::string& variable) {
-        setSetterValue(__FUNCTION__, variable);
+        setSetterValue(keys::Variable, variable);
     }
 
     const std::string& SetVarAction::getValue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Value));
     }
 
     void SetVarAction::setValue(const std::string& value) {
-        setSetterValue(__FUNCTION__, value);
+        setSetterValue(keys::Value, value);
     }
 } //NAMESPACE
 
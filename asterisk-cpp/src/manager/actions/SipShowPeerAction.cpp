@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     const std::string& SipShowPeerAction::getPeer() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Peer));
     }
 
     void SipShowPeerAction::setPeer(const std::string& peer) {
-        setSetterValue(__FUNCTION__, peer);
+        setSetterValue(keys::Peer, peer);
     }
 } //NAMESPACE
 
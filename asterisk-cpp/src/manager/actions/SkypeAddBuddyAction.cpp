@@ -27,27 +27,27 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeAddBuddyAction::getUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::User));
     }
 
     void SkypeAddBuddyAction::setUser(const std::string& user) {
-        setSetterValue(__FUNCTION__, user);
+        setSetterValue(keys::User, user);
     }
 
     const std::string& SkypeAddBuddyAction::getBuddy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Buddy));
     }
 
     void SkypeAddBuddyAction::setBuddy(const std::string& buddy) {
-        setSetterValue(__FUNCTION__, buddy);
+        setSetterValue(keys::Buddy, buddy);
     }
 
     const std::string& SkypeAddBuddyAction::getAuthMsg() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AuthMsg));
     }
 
     void SkypeAddBuddyAction::setAuthMsg(const std::string& authMsg) {
-        setSetterValue(__FUNCTION__, authMsg);
+        setSetterValue(keys::AuthMsg, authMsg);
     }
 } //NAMESPACE
 
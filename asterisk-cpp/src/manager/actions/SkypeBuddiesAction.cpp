@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddiesAction::getUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::User));
     }
 
     void SkypeBuddiesAction::setUser(const std::string& user) {
-        setSetterValue(__FUNCTION__, user);
+        setSetterValue(keys::User, user);
     }
 } //NAMESPACE
 
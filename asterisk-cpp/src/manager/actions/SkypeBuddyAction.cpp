@@ -25,19 +25,19 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddyAction::getUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::User));
     }
 
     void SkypeBuddyAction::setUser(const std::string& user) {
-        setSetterValue(__FUNCTION__, user);
+        setSetterValue(keys::User, user);
     }
 
     const std::string& SkypeBuddyAction::getBuddy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Buddy));
     }
 
     void SkypeBuddyAction::setBuddy(const std::string& buddy) {
-        setSetterValue(__FUNCTION__, buddy);
+        setSetterValue(keys::Buddy, buddy);
     }
 } //NAMESPACE
 
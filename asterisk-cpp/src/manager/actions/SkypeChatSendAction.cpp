@@ -23,32 +23,32 @@ namespace asteriskcpp {
 
     
     const std::string& SkypeChatSendAction::getSkypename() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Skypename));
     }
 
   
     void SkypeChatSendAction::setSkypename(const std::string& skypename) {
-        setSetterValue(__FUNCTION__, skypename);
+        setSetterValue(keys::Skypename, skypename);
     }
 
  
     const std::string& SkypeChatSendAction::getUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::User));
     }
 
 
     void SkypeChatSendAction::setUser(const std::string& user) {
-        setSetterValue(__FUNCTION__, user);
+        setSetterValue(keys::User, user);
     }
 
 
     const std::string& SkypeChatSendAction::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
 
     void SkypeChatSendAction::setMessage(const std::string& message) {
-        setSetterValue(__FUNCTION__, message);
+        setSetterValue(keys::Message, message);
     }
 } //NAMESPACE
 
@@ -21,19 +21,19 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeRemoveBuddyAction::getUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::User));
     }
 
     void SkypeRemoveBuddyAction::setUser(const std::string& user) {
-        setSetterValue(__FUNCTION__, user);
+        setSetterValue(keys::User, user);
     }
 
     const std::string& SkypeRemoveBuddyAction::getBuddy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Buddy));
     }
 
     void SkypeRemoveBuddyAction::setBuddy(const std::string& buddy) {
-        setSetterValue(__FUNCTION__, buddy);
+        setSetterValue(keys::Buddy, buddy);
     }
 } //NAMESPACE
 
@@ -20,19 +20,19 @@ namespace asteriskcpp {
     }
 
     const std::string& StatusAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void StatusAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 
     const std::string& StatusAction::getVariables() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Variables));
     }
 
     void StatusAction::setVariables(const std::string& variables) {
-        setSetterValue(__FUNCTION__, variables);
+        setSetterValue(keys::Variables, variables);
     }
 
     void StatusAction::setVariables(std::vector<std::string>& variables) {
@@ -44,7 +44,7 @@ namespace asteriskcpp {
         }
 
 
-        setSetterValue(__FUNCTION__, rt);
+        setSetterValue(keys::Variables, rt);
     }
 } //NAMESPACE
 
@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     const std::string& StopMonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void StopMonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 } //NAMESPACE
 
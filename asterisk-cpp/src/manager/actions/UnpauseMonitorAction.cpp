@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }    
 
     const std::string& UnpauseMonitorAction::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     void UnpauseMonitorAction::setChannel(const std::string& channel) {
-        setSetterValue(__FUNCTION__, channel);
+        setSetterValue(keys::Channel, channel);
     }
 } //NAMESPACE
 
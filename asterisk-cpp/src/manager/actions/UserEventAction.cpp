@@ -24,11 +24,11 @@ namespace asteriskcpp {
     /*
      * TODO: Implement
     const UserEvent& UserEventAction::getUserEvent() const {
-        return (getGetterValue(<UserEvent> __FUNCTION__));
+        return (getGetterValue(<UserEvent> keys::UserEvent));
     }
 
     void UserEventAction::setUserEvent(const UserEvent& userEvent) {
-        setSetterValue<UserEvent>(__FUNCTION__, userEvent);
+        setSetterValue<UserEvent>(keys::UserEvent, userEvent);
     }
     */
 } //NAMESPACE
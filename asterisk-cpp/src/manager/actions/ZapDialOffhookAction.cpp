@@ -21,19 +21,19 @@ namespace asteriskcpp {
     }    
 
     int ZapDialOffhookAction::getZapChannel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ZapChannel));
     }
 
     void ZapDialOffhookAction::setZapChannel(int channel) {
-        setSetterValue<int>(__FUNCTION__, channel);
+        setSetterValue<int>(keys::ZapChannel, channel);
     }
 
     const std::string& ZapDialOffhookAction::getNumber() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Number));
     }
 
     void ZapDialOffhookAction::setNumber(const std::string& number) {
-        setSetterValue(__FUNCTION__, number);
+        setSetterValue(keys::Number, number);
     }
 } //NAMESPACE
 
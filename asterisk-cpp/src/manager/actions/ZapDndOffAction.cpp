@@ -20,11 +20,11 @@ namespace asteriskcpp {
     }
 
     int ZapDndOffAction::getZapChannel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ZapChannel));
     }
 
     void ZapDndOffAction::setZapChannel(int channel) {
-        setSetterValue<int>(__FUNCTION__, channel);
+        setSetterValue<int>(keys::ZapChannel, channel);
     }
 } //NAMESPACE
 
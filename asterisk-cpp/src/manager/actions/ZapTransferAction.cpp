@@ -16,11 +16,11 @@ namespace asteriskcpp {
     }    
 
     int ZapTransferAction::getZapChannel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ZapChannel));
     }
 
     void ZapTransferAction::setZapChannel(int channel) {
-        setSetterValue<int>(__FUNCTION__, channel);
+        setSetterValue<int>(keys::ZapChannel, channel);
     }
 } //NAMESPACE
 
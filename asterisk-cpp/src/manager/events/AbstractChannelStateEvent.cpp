@@ -18,23 +18,23 @@ namespace asteriskcpp {
     }
 
     const std::string& AbstractChannelStateEvent::getConnectedlinename() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Connectedlinename));
     }
 
     const std::string& AbstractChannelStateEvent::getConnectedlinenum() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Connectedlinenum));
     }
 
     int AbstractChannelStateEvent::getChannelState() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ChannelState));
     }
 
     const std::string& AbstractChannelStateEvent::getChannelStateDesc() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChannelStateDesc));
     }
 
     const std::string& AbstractChannelStateEvent::getState() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::State));
     }
 
 } /* namespace asteriskcpp */
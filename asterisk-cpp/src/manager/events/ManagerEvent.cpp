@@ -6,6 +6,7 @@
  */
 
 #include "asteriskcpp/manager/events/ManagerEvent.h"
+#include "asteriskcpp/manager/EventRegistry.h"
 #include "asteriskcpp/utils/LogHandler.h"
 #include <stdio.h>
 
@@ -13,17 +14,37 @@ static unsigned long nextSequenceNumber = 0;
 
 namespace asteriskcpp {
 
-    ManagerEvent::ManagerEvent() {
+    ManagerEvent::ManagerEvent() :
+    eventType(EVENT_UNKNOWN), server(NULL) {
     }
 
-    ManagerEvent::ManagerEvent(const std::string& values) {
+    ManagerEvent::ManagerEvent(const std::string& values) :
+    eventType(EVENT_UNKNOWN), server(NULL) {
+        stamp();
+        convertStr(values);
+    }
+
+    void ManagerEvent::stamp() {
         internalNumber = (nextSequenceNumber++);
         received = std::time(0);
-        convertStr(values);
     }
 
-    const std::string ManagerEvent::getEventName() const {
-        return this->getClassName();
+    const std::string& ManagerEvent::getEventName() const {
+        EventType type = getEventType();
+        if (type != EVENT_UNKNOWN) {
+            return (EventRegistry::getName(type));
+        }
+        return (getGetterValue(keys::Event));
+    }
+
+    EventType ManagerEvent::getEventType() const {
+        if (eventType != EVENT_UNKNOWN) {
+            return (eventType);
+        }
+        // not built by EventBuilder
+        const std::string& name = getGetterValue(keys::Event);
+        const EventDescriptor* descriptor = EventRegistry::find(name.data(), name.length());
+        return (descriptor != NULL ? descriptor->type : EVENT_UNKNOWN);
     }
 
     ManagerEvent::~ManagerEvent() {
@@ -35,7 +56,7 @@ namespace asteriskcpp {
 
     const std::string& ManagerEvent::getPrivilege() const {
         //TODO: Verify name
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Privilege));
     }
 
     double ManagerEvent::getTimestamp() const {
@@ -44,7 +65,10 @@ namespace asteriskcpp {
     }
 
     const std::string& ManagerEvent::getServer() const {
-        return (getGetterValue(__FUNCTION__));
+        if (server != NULL) {
+            return (*server);
+        }
+        return (getGetterValue(keys::Server));
     }
 
     const std::string& ManagerEvent::getFile() const {
@@ -74,7 +98,7 @@ namespace asteriskcpp {
     }
 
     const std::string& ManagerEvent::getUniqueID() const {
-        return (getProperty("Uniqueid"));
+        return (getGetterValue(keys::UniqueId));
     }
 
 }
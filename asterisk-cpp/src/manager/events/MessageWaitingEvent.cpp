@@ -17,18 +17,18 @@ namespace asteriskcpp {
     }
 
     const std::string& MessageWaitingEvent::getMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Mailbox));
     }
 
     int MessageWaitingEvent::getWaiting() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Waiting));
     }
 
     int MessageWaitingEvent::getNew() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::New));
     }
 
     int MessageWaitingEvent::getOld() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Old));
     }
 } /* namespace asteriskcpp */
@@ -17,10 +17,10 @@ namespace asteriskcpp {
     }
 
     int PeerlistCompleteEvent::getListItems() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListItems));
     }
 
     const std::string& PeerlistCompleteEvent::getEventList() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::EventList));
     }
 } /* namespace asteriskcpp */
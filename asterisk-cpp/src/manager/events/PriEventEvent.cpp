@@ -17,18 +17,18 @@ namespace asteriskcpp {
     }
 
     const std::string& PriEventEvent::getPriEvent() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PriEvent));
     }
 
     int PriEventEvent::getPriEventCode() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::PriEventCode));
     }
 
     const std::string& PriEventEvent::getDChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::DChannel));
     }
 
     int PriEventEvent::getSpan() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Span));
     }
 } /* namespace asteriskcpp */
@@ -17,6 +17,6 @@ namespace asteriskcpp {
     }
 
     const std::string& ProtocolIdentifierReceivedEvent::getProtocolIdentifier() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ProtocolIdentifier));
     }
 } /* namespace asteriskcpp */
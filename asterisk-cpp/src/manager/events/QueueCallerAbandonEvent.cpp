@@ -17,14 +17,14 @@ namespace asteriskcpp {
     }
 
     int QueueCallerAbandonEvent::getHoldTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::HoldTime));
     }
 
     int QueueCallerAbandonEvent::getOriginalPosition() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::OriginalPosition));
     }
 
     int QueueCallerAbandonEvent::getPosition() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Position));
     }
 } /* namespace asteriskcpp */
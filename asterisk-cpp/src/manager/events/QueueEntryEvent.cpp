@@ -17,34 +17,34 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueEntryEvent::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     int QueueEntryEvent::getPosition() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Position));
     }
 
     const std::string& QueueEntryEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& QueueEntryEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     const std::string& QueueEntryEvent::getCallerId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerId));
     }
 
     const std::string& QueueEntryEvent::getCallerIdName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerIdName));
     }
 
     const std::string& QueueEntryEvent::getCallerIdNum() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerIdNum));
     }
 
     long QueueEntryEvent::getWait() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::Wait));
     }
 } /* namespace asteriskcpp */
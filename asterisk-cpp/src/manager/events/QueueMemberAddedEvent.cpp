@@ -17,26 +17,26 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueMemberAddedEvent::getMembership() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Membership));
     }
 
     int QueueMemberAddedEvent::getPenalty() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Penalty));
     }
 
     int QueueMemberAddedEvent::getCallsTaken() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CallsTaken));
     }
 
     long QueueMemberAddedEvent::getLastCall() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::LastCall));
     }
 
     int QueueMemberAddedEvent::getStatus() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Status));
     }
 
     bool QueueMemberAddedEvent::getPaused() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Paused));
     }
 } /* namespace asteriskcpp */
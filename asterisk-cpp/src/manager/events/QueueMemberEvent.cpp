@@ -21,15 +21,15 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueMemberEvent::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     const std::string& QueueMemberEvent::getLocation() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Location));
     }
 
     const std::string& QueueMemberEvent::getMembership() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Membership));
     }
 
     bool QueueMemberEvent::isStatic() const {
@@ -41,30 +41,30 @@ namespace asteriskcpp {
     }
 
     int QueueMemberEvent::getPenalty() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Penalty));
     }
 
     int QueueMemberEvent::getCallsTaken() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CallsTaken));
     }
 
     long QueueMemberEvent::getLastCall() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::LastCall));
     }
 
     int QueueMemberEvent::getStatus() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Status));
     }
 
     bool QueueMemberEvent::getPaused() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Paused));
     }
 
     const std::string& QueueMemberEvent::getName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Name));
     }
 
     const std::string& QueueMemberEvent::getMemberName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::MemberName));
     }
 } /* namespace asteriskcpp */
@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     bool QueueMemberPausedEvent::getPaused() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Paused));
     }
 
     const std::string& QueueMemberPausedEvent::getReason() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Reason));
     }
 } /* namespace asteriskcpp */
@@ -18,14 +18,14 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueMemberPenaltyEvent::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     const std::string& QueueMemberPenaltyEvent::getLocation() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Location));
     }
 
     int QueueMemberPenaltyEvent::getPenalty() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Penalty));
     }
 } /* namespace asteriskcpp */
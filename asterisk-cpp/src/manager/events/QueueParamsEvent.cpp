@@ -17,46 +17,46 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueParamsEvent::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     int QueueParamsEvent::getMax() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Max));
     }
 
     const std::string& QueueParamsEvent::getStrategy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Strategy));
     }
 
     int QueueParamsEvent::getCalls() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Calls));
     }
 
     int QueueParamsEvent::getHoldTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::HoldTime));
     }
 
     int QueueParamsEvent::getTalkTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::TalkTime));
     }
 
     int QueueParamsEvent::getCompleted() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Completed));
     }
 
     int QueueParamsEvent::getAbandoned() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Abandoned));
     }
 
     int QueueParamsEvent::getServiceLevel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ServiceLevel));
     }
 
     double QueueParamsEvent::getServiceLevelPerf() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::ServiceLevelPerf));
     }
 
     int QueueParamsEvent::getWeight() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Weight));
     }
 } /* namespace asteriskcpp */
@@ -18,30 +18,30 @@ namespace asteriskcpp {
     }
 
     const std::string& QueueSummaryEvent::getQueue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Queue));
     }
 
     int QueueSummaryEvent::getLoggedIn() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::LoggedIn));
     }
 
     int QueueSummaryEvent::getAvailable() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Available));
     }
 
     int QueueSummaryEvent::getCallers() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Callers));
     }
 
     int QueueSummaryEvent::getHoldTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::HoldTime));
     }
 
     int QueueSummaryEvent::getTalkTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::TalkTime));
     }
 
     int QueueSummaryEvent::getLongestHoldTime() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::LongestHoldTime));
     }
 } /* namespace asteriskcpp */
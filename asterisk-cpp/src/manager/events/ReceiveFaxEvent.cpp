@@ -18,42 +18,42 @@ namespace asteriskcpp {
     }
 
     const std::string& ReceiveFaxEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& ReceiveFaxEvent::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const std::string& ReceiveFaxEvent::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     const std::string& ReceiveFaxEvent::getCallerId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerId));
     }
 
     const std::string& ReceiveFaxEvent::getRemoteStationId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::RemoteStationId));
     }
 
     const std::string& ReceiveFaxEvent::getLocalStationId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::LocalStationId));
     }
 
     int ReceiveFaxEvent::getPagesTransferred() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::PagesTransferred));
     }
 
     const std::string& ReceiveFaxEvent::getResolution() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Resolution));
     }
 
     int ReceiveFaxEvent::getTransferRate() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::TransferRate));
     }
 
     const std::string& ReceiveFaxEvent::getFileName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::FileName));
     }
 } /* namespace asteriskcpp */
@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     int RegistrationsCompleteEvent::getListItems() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListItems));
     }
 
     const std::string& RegistrationsCompleteEvent::getEventList() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::EventList));
     }
 } /* namespace asteriskcpp */
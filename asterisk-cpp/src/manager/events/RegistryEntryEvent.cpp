@@ -17,26 +17,26 @@ namespace asteriskcpp {
     }
 
     long RegistryEntryEvent::getRegistrationTime() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::RegistrationTime));
     }
 
     int RegistryEntryEvent::getPort() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Port));
     }
 
     const std::string& RegistryEntryEvent::getUsername() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Username));
     }
 
     const std::string& RegistryEntryEvent::getHost() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Host));
     }
 
     const std::string& RegistryEntryEvent::getState() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::State));
     }
 
     int RegistryEntryEvent::getRefresh() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Refresh));
     }
 } /* namespace asteriskcpp */
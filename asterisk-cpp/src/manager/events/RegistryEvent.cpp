@@ -17,30 +17,30 @@ namespace asteriskcpp {
     }
 
     const std::string& RegistryEvent::getChannelType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChannelType));
     }
 
     const std::string& RegistryEvent::getChannelDriver() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChannelDriver));
     }
 
     const std::string& RegistryEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& RegistryEvent::getDomain() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Domain));
     }
 
     const std::string& RegistryEvent::getUsername() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Username));
     }
 
     const std::string& RegistryEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 
     const std::string& RegistryEvent::getCause() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Cause));
     }
 } /* namespace asteriskcpp */
@@ -22,15 +22,15 @@ namespace asteriskcpp {
     }
 
     const std::string& ReloadEvent::getModule() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Module));
     }
 
     const std::string& ReloadEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 
     const std::string& ReloadEvent::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
     bool ReloadEvent::isEnabled() const {
@@ -19,11 +19,11 @@ namespace asteriskcpp {
     }
 
     const std::string& RenameEvent::getNewname() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Newname));
     }
 
     const std::string& RenameEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& RenameEvent::getOldname() const {
@@ -31,10 +31,10 @@ namespace asteriskcpp {
     }
 
     const std::string& RenameEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     const std::string& RenameEvent::getNewUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::NewUniqueId));
     }
 } /* namespace asteriskcpp */
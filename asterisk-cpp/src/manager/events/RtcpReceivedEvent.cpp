@@ -19,42 +19,42 @@ namespace asteriskcpp {
     }
 
     const std::string& RtcpReceivedEvent::getFromAddress() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::FromAddress));
     }
 
     int RtcpReceivedEvent::getFromPort() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::FromPort));
     }
 
     long RtcpReceivedEvent::getPt() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::Pt));
     }
 
     long RtcpReceivedEvent::getReceptionReports() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::ReceptionReports));
     }
 
     long RtcpReceivedEvent::getSenderSsrc() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SenderSsrc));
     }
 
     long RtcpReceivedEvent::getPacketsLost() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::PacketsLost));
     }
 
     long RtcpReceivedEvent::getHighestSequence() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::HighestSequence));
     }
 
     long RtcpReceivedEvent::getSequenceNumberCycles() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SequenceNumberCycles));
     }
 
     double RtcpReceivedEvent::getLastSr() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::LastSr));
     }
 
     long RtcpReceivedEvent::getRtt() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::Rtt));
     }
 } /* namespace asteriskcpp */
@@ -18,38 +18,38 @@ namespace asteriskcpp {
     }
 
     const std::string& RtcpSentEvent::getToAddress() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ToAddress));
     }
 
     int RtcpSentEvent::getToPort() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ToPort));
     }
 
     long RtcpSentEvent::getOurSsrc() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::OurSsrc));
     }
 
     double RtcpSentEvent::getSentNtp() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::SentNtp));
     }
 
     long RtcpSentEvent::getSentRtp() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SentRtp));
     }
 
     long RtcpSentEvent::getSentPackets() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SentPackets));
     }
 
     long RtcpSentEvent::getSentOctets() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SentOctets));
     }
 
     long RtcpSentEvent::getCumulativeLoss() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::CumulativeLoss));
     }
 
     long RtcpSentEvent::getTheirLastSr() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::TheirLastSr));
     }
 } /* namespace asteriskcpp */
@@ -18,14 +18,14 @@ namespace asteriskcpp {
     }
 
     long RtpReceiverStatEvent::getReceivedPackets() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::ReceivedPackets));
     }
 
     double RtpReceiverStatEvent::getTransit() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::Transit));
     }
 
     long RtpReceiverStatEvent::getRrCount() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::RrCount));
     }
 } /* namespace asteriskcpp */
@@ -18,14 +18,14 @@ namespace asteriskcpp {
     }
 
     long RtpSenderStatEvent::getSentPackets() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SentPackets));
     }
 
     long RtpSenderStatEvent::getSrCount() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::SrCount));
     }
 
     double RtpSenderStatEvent::getRtt() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::Rtt));
     }
 } /* namespace asteriskcpp */
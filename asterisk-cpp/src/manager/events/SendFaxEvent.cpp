@@ -18,38 +18,38 @@ namespace asteriskcpp {
     }
 
     const std::string& SendFaxEvent::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const std::string& SendFaxEvent::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     const std::string& SendFaxEvent::getCallerId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerId));
     }
 
     const std::string& SendFaxEvent::getLocalStationId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::LocalStationId));
     }
 
     const std::string& SendFaxEvent::getRemoteStationId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::RemoteStationId));
     }
 
     const std::string& SendFaxEvent::getPagesTransferred() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PagesTransferred));
     }
 
     const std::string& SendFaxEvent::getResolution() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Resolution));
     }
 
     const std::string& SendFaxEvent::getTransferRate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferRate));
     }
 
     const std::string& SendFaxEvent::getFileName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::FileName));
     }
 }/* namespace asteriskcpp */
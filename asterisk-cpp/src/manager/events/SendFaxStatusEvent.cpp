@@ -18,26 +18,26 @@ namespace asteriskcpp {
     }
 
     const std::string& SendFaxStatusEvent::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const std::string& SendFaxStatusEvent::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     const std::string& SendFaxStatusEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 
     const std::string& SendFaxStatusEvent::getCallerId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerId));
     }
 
     const std::string& SendFaxStatusEvent::getLocalStationId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::LocalStationId));
     }
 
     const std::string& SendFaxStatusEvent::getFileName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::FileName));
     }
 } /* namespace asteriskcpp */
@@ -18,18 +18,18 @@ namespace asteriskcpp {
     }
 
     int ShowDialplanCompleteEvent::getListItems() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListItems));
     }
 
     int ShowDialplanCompleteEvent::getListExtensions() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListExtensions));
     }
 
     int ShowDialplanCompleteEvent::getListPriorities() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListPriorities));
     }
 
     int ShowDialplanCompleteEvent::getListContexts() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListContexts));
     }
 } /* namespace asteriskcpp */
@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     const std::string& ShutdownEvent::getShutdown() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Shutdown));
     }
 
     bool ShutdownEvent::getRestart() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Restart));
     }
 } /* namespace asteriskcpp */
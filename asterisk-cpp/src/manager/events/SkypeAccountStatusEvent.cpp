@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeAccountStatusEvent::getUsername() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Username));
     }
 
     const std::string& SkypeAccountStatusEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 } /* namespace asteriskcpp */
@@ -18,14 +18,14 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddyEntryEvent::getBuddy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Buddy));
     }
 
     const std::string& SkypeBuddyEntryEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 
     const std::string& SkypeBuddyEntryEvent::getFullname() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Fullname));
     }
 } /* namespace asteriskcpp */
@@ -18,6 +18,6 @@ namespace asteriskcpp {
     }
 
     int SkypeBuddyListCompleteEvent::getListItems() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ListItems));
     }
 } /* namespace asteriskcpp */
@@ -21,7 +21,7 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddyStatusEvent::getBuddy() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Buddy));
     }
 
     std::string SkypeBuddyStatusEvent::getUser() const {
@@ -33,7 +33,7 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddyStatusEvent::getBuddyStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::BuddyStatus));
     }
 
     std::string SkypeBuddyStatusEvent::buddyGroup(const int group) const {
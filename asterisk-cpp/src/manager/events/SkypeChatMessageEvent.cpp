@@ -19,15 +19,15 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeChatMessageEvent::getTo() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::To));
     }
 
     const std::string& SkypeChatMessageEvent::getFrom() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::From));
     }
 
     const std::string& SkypeChatMessageEvent::getMessage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Message));
     }
 
     std::string SkypeChatMessageEvent::getDecodedMessage() {
@@ -17,26 +17,26 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeLicenseEvent::getFile() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::File));
     }
 
     const std::string& SkypeLicenseEvent::getKey() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Key));
     }
 
     const std::string& SkypeLicenseEvent::getExpires() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Expires));
     }
 
     const std::string& SkypeLicenseEvent::getHostId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::HostId));
     }
 
     int SkypeLicenseEvent::getChannels() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Channels));
     }
 
     const std::string& SkypeLicenseEvent::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 }/* namespace asteriskcpp */
@@ -18,6 +18,6 @@ namespace asteriskcpp {
     }
 
     int StatusCompleteEvent::getItems() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Items));
     }
 } /* namespace asteriskcpp */
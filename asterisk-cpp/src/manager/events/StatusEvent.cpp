@@ -17,7 +17,7 @@ namespace asteriskcpp {
     }
 
     const std::string& StatusEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& StatusEvent::getCallerId() const {
@@ -25,15 +25,15 @@ namespace asteriskcpp {
     }
 
     const std::string& StatusEvent::getCallerIdNum() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerIdNum));
     }
 
     const std::string& StatusEvent::getCallerIdName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerIdName));
     }
 
     const std::string& StatusEvent::getAccountCode() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AccountCode));
     }
 
     const std::string& StatusEvent::getAccount() const {
@@ -41,11 +41,11 @@ namespace asteriskcpp {
     }
 
     int StatusEvent::getChannelState() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::ChannelState));
     }
 
     const std::string& StatusEvent::getChannelStateDesc() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChannelStateDesc));
     }
 
     const std::string& StatusEvent::getState() const {
@@ -53,23 +53,23 @@ namespace asteriskcpp {
     }
 
     const std::string& StatusEvent::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const std::string& StatusEvent::getExtension() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Extension));
     }
 
     int StatusEvent::getPriority() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Priority));
     }
 
     int StatusEvent::getSeconds() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Seconds));
     }
 
     const std::string& StatusEvent::getBridgedChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::BridgedChannel));
     }
 
     const std::string& StatusEvent::getLink() const {
@@ -77,11 +77,11 @@ namespace asteriskcpp {
     }
 
     const std::string& StatusEvent::getBridgedUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::BridgedUniqueId));
     }
 
     const std::string& StatusEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     std::map<std::string, std::string> StatusEvent::getVariables() const {
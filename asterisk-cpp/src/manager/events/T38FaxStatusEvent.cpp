@@ -18,83 +18,83 @@ namespace asteriskcpp {
     }
 
     const std::string& T38FaxStatusEvent::getMaxLag() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::MaxLag));
     }
 
     const std::string& T38FaxStatusEvent::getTotalLag() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TotalLag));
     }
 
     const std::string& T38FaxStatusEvent::getAverageLag() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AverageLag));
     }
 
     int T38FaxStatusEvent::getTotalEvents() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::TotalEvents));
     }
 
     const std::string& T38FaxStatusEvent::getT38SessionDuration() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::T38SessionDuration));
     }
 
     int T38FaxStatusEvent::getT38PacketsSent() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::T38PacketsSent));
     }
 
     int T38FaxStatusEvent::getT38OctetsSent() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::T38OctetsSent));
     }
 
     const std::string& T38FaxStatusEvent::getAverageTxDataRate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AverageTxDataRate));
     }
 
     int T38FaxStatusEvent::getT38PacketsReceived() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::T38PacketsReceived));
     }
 
     int T38FaxStatusEvent::getT38OctetsReceived() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::T38OctetsReceived));
     }
 
     const std::string& T38FaxStatusEvent::getAverageRxDataRate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AverageRxDataRate));
     }
 
     int T38FaxStatusEvent::getJitterBufferOverflows() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::JitterBufferOverflows));
     }
 
     int T38FaxStatusEvent::getMinimumJitterSpace() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::MinimumJitterSpace));
     }
 
     int T38FaxStatusEvent::getUnrecoverablePackets() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::UnrecoverablePackets));
     }
 
     int T38FaxStatusEvent::getTotalLagInMilliSeconds() const {
         //todo: stripunit
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::TotalLagInMilliSeconds));
     }
 
     int T38FaxStatusEvent::getMaxLagInMilliSeconds() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::MaxLagInMilliSeconds));
     }
 
     double T38FaxStatusEvent::getT38SessionDurationInSeconds() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::T38SessionDurationInSeconds));
     }
 
     double T38FaxStatusEvent::getAverageLagInMilliSeconds() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::AverageLagInMilliSeconds));
     }
 
     int T38FaxStatusEvent::getAverageTxDataRateInBps() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::AverageTxDataRateInBps));
     }
 
     int T38FaxStatusEvent::getAverageRxDataRateInBps() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::AverageRxDataRateInBps));
     }
 } /* namespace asteriskcpp */
@@ -21,19 +21,19 @@ namespace asteriskcpp {
     }
 
     const std::string& TransferEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& TransferEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     const std::string& TransferEvent::getTransferMethod() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferMethod));
     }
 
     const std::string& TransferEvent::getTransferType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferType));
     }
 
     bool TransferEvent::isAttended() const {
@@ -45,27 +45,27 @@ namespace asteriskcpp {
     }
 
     const std::string& TransferEvent::getSipCallId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipCallId));
     }
 
     const std::string& TransferEvent::getTargetChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TargetChannel));
     }
 
     const std::string& TransferEvent::getTargetUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TargetUniqueId));
     }
 
     const std::string& TransferEvent::getTransferExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferExten));
     }
 
     const std::string& TransferEvent::getTransferContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferContext));
     }
 
     bool TransferEvent::getTransfer2Parking() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Transfer2Parking));
     }
 
     bool TransferEvent::isParking() const {
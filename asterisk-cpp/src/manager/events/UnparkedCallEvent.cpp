@@ -18,6 +18,6 @@ namespace asteriskcpp {
     }
 
     const std::string& UnparkedCallEvent::getFrom() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::From));
     }
 } /* namespace asteriskcpp */
@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     const std::string& UserEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& UserEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 }/* namespace asteriskcpp */
@@ -18,18 +18,18 @@ namespace asteriskcpp {
     }
 
     const std::string& VarSetEvent::getChannel() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Channel));
     }
 
     const std::string& VarSetEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     const std::string& VarSetEvent::getVariable() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Variable));
     }
 
     const std::string& VarSetEvent::getValue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Value));
     }
 } /* namespace asteriskcpp */
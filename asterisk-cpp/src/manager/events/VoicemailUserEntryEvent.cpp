@@ -17,112 +17,112 @@ namespace asteriskcpp {
     }
 
     const std::string& VoicemailUserEntryEvent::getVmContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::VmContext));
     }
 
     const std::string& VoicemailUserEntryEvent::getVoicemailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Voicemailbox));
     }
 
     const std::string& VoicemailUserEntryEvent::getFullname() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Fullname));
     }
 
     const std::string& VoicemailUserEntryEvent::getEmail() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Email));
     }
 
     const std::string& VoicemailUserEntryEvent::getPager() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Pager));
     }
 
     const std::string& VoicemailUserEntryEvent::getServerEmail() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ServerEmail));
     }
 
     const std::string& VoicemailUserEntryEvent::getMailCommand() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::MailCommand));
     }
 
     const std::string& VoicemailUserEntryEvent::getLanguage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Language));
     }
 
     const std::string& VoicemailUserEntryEvent::getTimezone() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Timezone));
     }
 
     const std::string& VoicemailUserEntryEvent::getCallback() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Callback));
     }
 
     const std::string& VoicemailUserEntryEvent::getDialout() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Dialout));
     }
 
     const std::string& VoicemailUserEntryEvent::getUniqueId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::UniqueId));
     }
 
     const std::string& VoicemailUserEntryEvent::getExitContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ExitContext));
     }
 
     int VoicemailUserEntryEvent::getSayDurationMinimum() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::SayDurationMinimum));
     }
 
     bool VoicemailUserEntryEvent::getSayEnvelope() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SayEnvelope));
 
     }
 
     bool VoicemailUserEntryEvent::getSayCid() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SayCid));
     }
 
     bool VoicemailUserEntryEvent::getAttachMessage() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::AttachMessage));
     }
 
     const std::string& VoicemailUserEntryEvent::getAttachmentFormat() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AttachmentFormat));
     }
 
     bool VoicemailUserEntryEvent::getDeleteMessage() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::DeleteMessage));
     }
 
     double VoicemailUserEntryEvent::getVolumeGain() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::VolumeGain));
     }
 
     bool VoicemailUserEntryEvent::getCanReview() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::CanReview));
     }
 
     bool VoicemailUserEntryEvent::getCallOperator() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::CallOperator));
     }
 
     int VoicemailUserEntryEvent::getMaxMessageCount() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::MaxMessageCount));
     }
 
     int VoicemailUserEntryEvent::getMaxMessageLength() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::MaxMessageLength));
     }
 
     int VoicemailUserEntryEvent::getNewMessageCount() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::NewMessageCount));
     }
 
     int VoicemailUserEntryEvent::getOldMessageCount() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::OldMessageCount));
     }
 
     const std::string& VoicemailUserEntryEvent::getImapUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ImapUser));
 
     }
 }
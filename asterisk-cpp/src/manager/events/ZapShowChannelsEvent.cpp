@@ -18,23 +18,23 @@ namespace asteriskcpp {
     }
 
     int ZapShowChannelsEvent::getChannel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Channel));
     }
 
     const std::string& ZapShowChannelsEvent::getSignalling() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Signalling));
     }
 
     const std::string& ZapShowChannelsEvent::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     bool ZapShowChannelsEvent::getDnd() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Dnd));
     }
 
     const std::string& ZapShowChannelsEvent::getAlarm() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Alarm));
     }
 }
 /* namespace asteriskcpp */
@@ -16,7 +16,7 @@ namespace asteriskcpp {
     }
 
     std::string ChallengeResponse::getChallenge() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Challenge));
     }
 
 }
@@ -17,6 +17,14 @@ namespace asteriskcpp {
         boost::split(result, knull, boost::is_any_of(std::string("\n")));
     }
 
+    void CommandResponse::loadFrame(const SlabView& frame) {
+        ManagerResponse::loadFrame(frame);
+        std::string knull(this->getProperty(""));
+
+        result.clear();
+        boost::split(result, knull, boost::is_any_of(std::string("\n")));
+    }
+
     CommandResponse::~CommandResponse() {
 
     }
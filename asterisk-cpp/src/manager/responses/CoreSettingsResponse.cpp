@@ -18,46 +18,46 @@ namespace asteriskcpp {
     }
 
     const std::string& CoreSettingsResponse::getAmiVersion() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AmiVersion));
     }
 
     const std::string& CoreSettingsResponse::getAsteriskVersion() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AsteriskVersion));
     }
 
     const std::string& CoreSettingsResponse::getSystemName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SystemName));
     }
 
     int CoreSettingsResponse::getCoreMaxCalls() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CoreMaxCalls));
     }
 
     double CoreSettingsResponse::getCoreMaxLoadAvg() const {
-        return (getGetterValue<double>(__FUNCTION__));
+        return (getGetterValue<double>(keys::CoreMaxLoadAvg));
     }
 
     const std::string& CoreSettingsResponse::getCoreRunUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreRunUser));
     }
 
     const std::string& CoreSettingsResponse::getCoreRunGroup() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreRunGroup));
     }
 
     int CoreSettingsResponse::getCoreMaxFilehandles() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CoreMaxFilehandles));
     }
 
     bool CoreSettingsResponse::isCoreRealtimeEnabled() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::CoreRealtimeEnabled));
     }
 
     bool CoreSettingsResponse::isCoreCdrEnabled() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::CoreCdrEnabled));
     }
 
     bool CoreSettingsResponse::isCoreHttpEnabled() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::CoreHttpEnabled));
     }
 }
\ No newline at end of file
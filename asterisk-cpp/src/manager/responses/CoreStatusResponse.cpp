@@ -18,27 +18,27 @@ namespace asteriskcpp {
     }
 
     const std::string& CoreStatusResponse::getCoreReloadTime() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreReloadTime));
     }
 
     const std::string& CoreStatusResponse::getCoreReloadDate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreReloadDate));
     }
 
     const std::string& CoreStatusResponse::getCoreReloadDateTimeAsDate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreReloadDateTimeAsDate));
     }
 
     long CoreStatusResponse::getCoreReloadDateTimeAsDate(long timezone) const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::CoreReloadDateTimeAsDate));
     }
 
     const std::string& CoreStatusResponse::getCoreStartupDate() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreStartupDate));
     }
 
     const std::string& CoreStatusResponse::getCoreStartupTime() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CoreStartupTime));
     }
 
     long CoreStatusResponse::getCoreStartupDateTimeAsDate() const {
@@ -46,11 +46,11 @@ namespace asteriskcpp {
     }
 
     long CoreStatusResponse::getCoreStartupDateTimeAsDate(long timezone) const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::CoreStartupDateTimeAsDate));
     }
 
     const int CoreStatusResponse::getCoreCurrentCalls() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CoreCurrentCalls));
     }
 
 }
\ No newline at end of file
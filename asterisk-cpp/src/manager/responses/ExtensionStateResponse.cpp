@@ -18,18 +18,18 @@ namespace asteriskcpp {
     }
 
     const std::string& ExtensionStateResponse::getExten() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Exten));
     }
 
     const std::string& ExtensionStateResponse::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const int ExtensionStateResponse::getHint() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Hint));
     }
 
     const int ExtensionStateResponse::getStatus() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Status));
     }
 }
\ No newline at end of file
@@ -16,10 +16,10 @@ namespace asteriskcpp {
     }
 
     const std::string& GetVarResponse::getVariable() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Variable));
     }
 
     const std::string& GetVarResponse::getValue() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Value));
     }
 }
\ No newline at end of file
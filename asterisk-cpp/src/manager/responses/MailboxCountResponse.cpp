@@ -17,14 +17,14 @@ namespace asteriskcpp {
     }
 
     const std::string& MailboxCountResponse::getMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Mailbox));
     }
 
     int MailboxCountResponse::getNewMessages() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::NewMessages));
     }
 
     int MailboxCountResponse::getOldMessages() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::OldMessages));
     }
 }
\ No newline at end of file
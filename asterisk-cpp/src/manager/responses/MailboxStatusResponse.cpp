@@ -17,10 +17,10 @@ namespace asteriskcpp {
     }
 
     const std::string& MailboxStatusResponse::getMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Mailbox));
     }
 
     bool MailboxStatusResponse::getWaiting() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Waiting));
     }
 }
\ No newline at end of file
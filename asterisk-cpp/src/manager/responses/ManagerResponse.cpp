@@ -20,6 +20,10 @@ namespace asteriskcpp {
         convertStr(responseStr);
     }
 
+    void ManagerResponse::loadFrame(const SlabView& frame) {
+        convertFrame(frame);
+    }
+
     ManagerResponse::Type ManagerResponse::getType() {
         std::string sType = getProperty("Response");
         if (sType == TYPE_ERROR) {
@@ -17,6 +17,6 @@ namespace asteriskcpp {
     }
 
     int ModuleCheckResponse::getVersion() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Version));
     }
 }
@@ -18,10 +18,10 @@ namespace asteriskcpp {
     }
 
     const std::string& PingResponse::getPing() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Ping));
     }
 
     const std::string& PingResponse::getTimestamp() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Timestamp));
     }
 }
\ No newline at end of file
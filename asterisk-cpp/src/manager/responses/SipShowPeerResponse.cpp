@@ -17,227 +17,227 @@ namespace asteriskcpp {
     }
 
     const std::string& SipShowPeerResponse::getChannelType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChannelType));
     }
 
     const std::string& SipShowPeerResponse::getObjectName() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ObjectName));
     }
 
     const std::string& SipShowPeerResponse::getChanObjectType() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChanObjectType));
     }
 
     bool SipShowPeerResponse::getSecretExist() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SecretExist));
     }
 
     bool SipShowPeerResponse::getMd5SecretExist() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Md5SecretExist));
     }
 
     bool SipShowPeerResponse::getRemoteSecretExist() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::RemoteSecretExist));
     }
 
     const std::string& SipShowPeerResponse::getContext() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Context));
     }
 
     const std::string& SipShowPeerResponse::getLanguage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Language));
     }
 
     const std::string& SipShowPeerResponse::getAccountCode() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AccountCode));
     }
 
     const std::string& SipShowPeerResponse::getAmaFlags() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AmaFlags));
     }
 
     const std::string& SipShowPeerResponse::getCidCallingPres() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CidCallingPres));
     }
 
     const std::string& SipShowPeerResponse::getSipFromUser() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipFromUser));
     }
 
     const std::string& SipShowPeerResponse::getSipFromDomain() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipFromDomain));
     }
 
     const std::string& SipShowPeerResponse::getCallGroup() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallGroup));
     }
 
     const std::string& SipShowPeerResponse::getPickupGroup() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PickupGroup));
     }
 
     const std::string& SipShowPeerResponse::getVoiceMailbox() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::VoiceMailbox));
     }
 
     const std::string& SipShowPeerResponse::getTransferMode() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::TransferMode));
     }
 
     int SipShowPeerResponse::getLastMsgsSent() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::LastMsgsSent));
     }
 
     int SipShowPeerResponse::getCallLimit() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::CallLimit));
     }
 
     int SipShowPeerResponse::getBusyLevel() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::BusyLevel));
     }
 
     int SipShowPeerResponse::getMaxCallBr() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::MaxCallBr));
     }
 
     bool SipShowPeerResponse::getDynamic() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Dynamic));
     }
 
     const std::string& SipShowPeerResponse::getCallerId() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CallerId));
     }
 
     long SipShowPeerResponse::getRegExpire() const {
-        return (getGetterValue<long>(__FUNCTION__));
+        return (getGetterValue<long>(keys::RegExpire));
     }
 
     bool SipShowPeerResponse::getSipAuthInsecure() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipAuthInsecure));
     }
 
     bool SipShowPeerResponse::getSipNatSupport() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipNatSupport));
     }
 
     bool SipShowPeerResponse::getAcl() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::Acl));
     }
 
     bool SipShowPeerResponse::getSipT38support() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipT38support));
     }
 
     const std::string& SipShowPeerResponse::getSipT38ec() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipT38ec));
     }
 
     int SipShowPeerResponse::getSipT38MaxDtgrm() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::SipT38MaxDtgrm));
     }
 
     bool SipShowPeerResponse::getSipDirectMedia() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipDirectMedia));
     }
 
     bool SipShowPeerResponse::getSipCanReinvite() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipCanReinvite));
     }
 
     bool SipShowPeerResponse::getSipPromiscRedir() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipPromiscRedir));
     }
 
     bool SipShowPeerResponse::getSipUserPhone() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipUserPhone));
     }
 
     bool SipShowPeerResponse::getSipVideoSupport() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipVideoSupport));
     }
 
     bool SipShowPeerResponse::getSipTextSupport() const {
-        return (getGetterValue<bool>(__FUNCTION__));
+        return (getGetterValue<bool>(keys::SipTextSupport));
     }
 
     const std::string& SipShowPeerResponse::getSipSessTimers() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipSessTimers));
     }
 
     const std::string& SipShowPeerResponse::getSipSessRefresh() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipSessRefresh));
     }
 
     int SipShowPeerResponse::getSipSessExpires() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::SipSessExpires));
     }
 
     int SipShowPeerResponse::getSipSessMin() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::SipSessMin));
     }
 
     const std::string& SipShowPeerResponse::getSipDtmfMode() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipDtmfMode));
     }
 
     const std::string& SipShowPeerResponse::getToHost() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ToHost));
     }
 
     const std::string& SipShowPeerResponse::getAddressIp() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::AddressIp));
     }
 
     int SipShowPeerResponse::getAddressPort() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::AddressPort));
     }
 
     const std::string& SipShowPeerResponse::getDefaultAddrIp() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::DefaultAddrIp));
     }
 
     int SipShowPeerResponse::getDefaultAddrPort() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::DefaultAddrPort));
     }
 
     const std::string& SipShowPeerResponse::getDefaultUsername() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::DefaultUsername));
     }
 
     const std::string& SipShowPeerResponse::getRegExtension() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::RegExtension));
     }
 
     const std::string& SipShowPeerResponse::getCodecs() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Codecs));
     }
 
     const std::string& SipShowPeerResponse::getCodecOrder() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::CodecOrder));
     }
 
     const std::string& SipShowPeerResponse::getStatus() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Status));
     }
 
     const std::string& SipShowPeerResponse::getSipUserAgent() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::SipUserAgent));
     }
 
     const std::string& SipShowPeerResponse::getParkingLot() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ParkingLot));
     }
 
     const std::string& SipShowPeerResponse::getRegContact() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::RegContact));
     }
 
     int SipShowPeerResponse::getQualifyFreq() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::QualifyFreq));
     }
     
     //std::map<const std::string, const std::string>
     const std::string SipShowPeerResponse::getChanVariable() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::ChanVariable));
     }
 }
\ No newline at end of file
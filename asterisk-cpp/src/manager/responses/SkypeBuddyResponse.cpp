@@ -17,43 +17,43 @@ namespace asteriskcpp {
     }
 
     const std::string& SkypeBuddyResponse::getSkypename() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Skypename));
     }
 
     const std::string& SkypeBuddyResponse::getTimezone() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Timezone));
     }
 
     const std::string& SkypeBuddyResponse::getAvailability() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Availability));
     }
 
     const std::string& SkypeBuddyResponse::getFullname() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Fullname));
     }
 
     const std::string& SkypeBuddyResponse::getLanguage() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Language));
     }
 
     const std::string& SkypeBuddyResponse::getCountry() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::Country));
     }
 
     const std::string& SkypeBuddyResponse::getPhoneHome() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PhoneHome));
     }
 
     const std::string& SkypeBuddyResponse::getPhoneOffice() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PhoneOffice));
     }
 
     const std::string& SkypeBuddyResponse::getPhoneMobile() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::PhoneMobile));
     }
 
     const std::string& SkypeBuddyResponse::getAbout() const {
-        return (getGetterValue(__FUNCTION__));
+        return (getGetterValue(keys::About));
     }
 
 }
\ No newline at end of file
@@ -17,6 +17,6 @@ namespace asteriskcpp {
     }
 
     int SkypeLicenseStatusResponse::getSkypename() const {
-        return (getGetterValue<int>(__FUNCTION__));
+        return (getGetterValue<int>(keys::Skypename));
     }
 }
\ No newline at end of file
@@ -0,0 +1,211 @@
+/*
+ * IOReactor.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/net/IOReactor.h"
+#include <algorithm>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include "asteriskcpp/exceptions/RuntimeException.h"
+#include "asteriskcpp/utils/LogHandler.h"
+
+#define MAX_EVENTS 64
+
+namespace asteriskcpp {
+
+    IOHandler::~IOHandler() {
+    }
+
+    IOReactor::IOReactor() :
+    running(false), busy(NULL) {
+        if ((epollFD = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+            Throw(SystemException(std::string("Error creating epoll - ").append(strerror(errno))));
+        }
+        if ((wakeFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == -1) {
+            ::close(epollFD);
+            Throw(SystemException(std::string("Error creating eventfd - ").append(strerror(errno))));
+        }
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof (ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = wakeFD;
+        epoll_ctl(epollFD, EPOLL_CTL_ADD, wakeFD, &ev);
+    }
+
+    IOReactor::~IOReactor() {
+        stop();
+        ::close(wakeFD);
+        ::close(epollFD);
+    }
+
+    void IOReactor::add(int fd, IOHandler* h) {
+        boost::mutex::scoped_lock lock(handlersMutex);
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof (ev));
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.fd = fd;
+        if (epoll_ctl(epollFD, EPOLL_CTL_ADD, fd, &ev) == -1) {
+            Throw(SystemException(std::string("Error watching socket - ").append(strerror(errno))));
+        }
+        handlers[fd] = Registration(h);
+
+        if (!running) {
+            running = true;
+            Thread::start();
+        }
+    }
+
+    IOReactor::handlersMap_t::iterator IOReactor::find(IOHandler* h) {
+        // looked up by handler, the descriptor may already be closed and reused
+        handlersMap_t::iterator it = handlers.begin();
+        while (it != handlers.end() && it->second.handler != h) {
+            ++it;
+        }
+        return (it);
+    }
+
+    void IOReactor::remove(IOHandler* h) {
+        boost::mutex::scoped_lock lock(handlersMutex);
+
+        handlersMap_t::iterator it = find(h);
+        if (it != handlers.end()) {
+            if (!it->second.paused) {
+                epoll_ctl(epollFD, EPOLL_CTL_DEL, it->first, NULL);
+            }
+            handlers.erase(it);
+        }
+        resumed.erase(std::remove(resumed.begin(), resumed.end(), h), resumed.end());
+
+        // waits for a notification in progress on another thread
+        if (!isCurrent()) {
+            while (busy == h) {
+                idle.wait(lock);
+            }
+        }
+    }
+
+    void IOReactor::pause(IOHandler* h) {
+        boost::mutex::scoped_lock lock(handlersMutex);
+
+        handlersMap_t::iterator it = find(h);
+        if (it != handlers.end() && !it->second.paused) {
+            epoll_ctl(epollFD, EPOLL_CTL_DEL, it->first, NULL);
+            it->second.paused = true;
+        }
+    }
+
+    void IOReactor::resume(IOHandler* h) {
+        {
+            boost::mutex::scoped_lock lock(handlersMutex);
+            resumed.push_back(h);
+        }
+        // the descriptor is watched again from the reactor thread
+        wakeup();
+    }
+
+    void IOReactor::stop() {
+        if (running) {
+            setMustStop(true);
+            wakeup();
+            Thread::stop();
+            running = false;
+        }
+    }
+
+    void IOReactor::wakeup() {
+        uint64_t one = 1;
+        if (::write(wakeFD, &one, sizeof (one)) != sizeof (one)) {
+            LOG_WARN_STR(std::string("Error waking reactor - ") + strerror(errno));
+        }
+    }
+
+    void IOReactor::run() {
+        struct epoll_event events[MAX_EVENTS];
+
+        int count = epoll_wait(epollFD, events, MAX_EVENTS, -1);
+        if (count == -1) {
+            if (errno != EINTR) {
+                LOG_ERROR_STR(std::string("epoll_wait - ") + strerror(errno));
+            }
+            return;
+        }
+
+        bool woken = false;
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            if (fd == wakeFD) {
+                uint64_t value;
+                while (::read(wakeFD, &value, sizeof (value)) > 0) {
+                }
+                woken = true;
+                continue;
+            }
+
+            IOHandler* h = NULL;
+            {
+                boost::mutex::scoped_lock lock(handlersMutex);
+                handlersMap_t::iterator it = handlers.find(fd);
+                if (it != handlers.end() && !it->second.paused) {
+                    h = it->second.handler;
+                    busy = h;
+                }
+            }
+            if (h != NULL) {
+                notify(h);
+            }
+        }
+
+        if (woken) {
+            resumeHandlers();
+        }
+    }
+
+    void IOReactor::notify(IOHandler* h) {
+        // called unlocked, a handler may add, pause or remove itself
+        h->onReadable();
+
+        boost::mutex::scoped_lock lock(handlersMutex);
+        busy = NULL;
+        idle.notify_all();
+    }
+
+    void IOReactor::resumeHandlers() {
+        std::vector<IOHandler*> handlers2resume;
+        {
+            boost::mutex::scoped_lock lock(handlersMutex);
+            handlers2resume.swap(resumed);
+        }
+
+        for (std::vector<IOHandler*>::iterator h = handlers2resume.begin(); h != handlers2resume.end(); ++h) {
+            {
+                boost::mutex::scoped_lock lock(handlersMutex);
+                handlersMap_t::iterator it = find(*h);
+                if (it == handlers.end()) {
+                    // removed meanwhile
+                    continue;
+                }
+                if (it->second.paused) {
+                    struct epoll_event ev;
+                    memset(&ev, 0, sizeof (ev));
+                    ev.events = EPOLLIN | EPOLLRDHUP;
+                    ev.data.fd = it->first;
+                    if (epoll_ctl(epollFD, EPOLL_CTL_ADD, it->first, &ev) == -1) {
+                        LOG_ERROR_STR(std::string("Error watching socket - ").append(strerror(errno)));
+                    }
+                    it->second.paused = false;
+                }
+                busy = *h;
+            }
+            // what the handler kept while paused is taken now
+            notify(*h);
+        }
+    }
+
+}
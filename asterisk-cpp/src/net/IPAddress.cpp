@@ -7,9 +7,14 @@
 
 #include "asteriskcpp/utils/LogHandler.h"
 #include "asteriskcpp/net/IPAddress.h"
+#include "asteriskcpp/exceptions/IOException.h"
+#include "asteriskcpp/structs/TimerWheel.h"
+#include <algorithm>
+#include <map>
 
 #define inaddrr(x) (*(struct in_addr *) &ifr->x[sizeof sa.sin_port])
 #define IFRSIZE   ((int)(size * sizeof (struct ifreq)))
+#define DEFAULT_RESOLVE_CACHE_TIME 60
 
 const std::string localhost = "127.0.0.1";
 
@@ -17,26 +22,36 @@ namespace asteriskcpp {
 
     boost::mutex IPAddress::mut;
 
+    struct ResolveEntry {
+        std::vector<IPAddress> addresses;
+        uint64_t expires;
+    };
+
+    typedef std::map<std::string, ResolveEntry> resolveCache_t;
+
+    // guarded by IPAddress::mut
+    static resolveCache_t resolveCache;
+    static unsigned int resolveCacheTime = DEFAULT_RESOLVE_CACHE_TIME;
+
     IPAddress::IPAddress() {
-        this->host = localhost;
-        this->ip = 0;
         this->port = 0;
+        this->setIP(0);
+        this->host = localhost;
         this->getLocalIP();
         this->resolveAddr();
     }
 
     IPAddress::IPAddress(unsigned short port) {
-        this->host = localhost;
-        this->ip = 0;
         this->port = port;
+        this->setIP(0);
+        this->host = localhost;
         this->getLocalIP();
         this->resolveAddr();
     }
 
     IPAddress::IPAddress(int ip, unsigned short port) {
-        this->ip = ip;
         this->port = port;
-        this->toStringAddr();
+        this->setIP(ip);
     }
 
     IPAddress::IPAddress(const std::string& host, unsigned short port) {
@@ -45,9 +60,20 @@ namespace asteriskcpp {
         this->resolveAddr();
     }
 
+    IPAddress::IPAddress(const struct sockaddr* address, socklen_t length) {
+        this->port = 0;
+        this->setAddress(address, length);
+        if (address->sa_family == AF_INET6) {
+            this->port = ntohs(((const struct sockaddr_in6*) address)->sin6_port);
+        } else {
+            this->port = ntohs(((const struct sockaddr_in*) address)->sin_port);
+        }
+        this->toStringAddr();
+    }
+
     IPAddress::IPAddress(const IPAddress& ipAddress) {
         this->host = ipAddress.host;
-        this->ip = ipAddress.ip;
+        this->address = ipAddress.address;
         this->port = ipAddress.port;
     }
 
@@ -55,18 +81,40 @@ namespace asteriskcpp {
 
     }
 
+    IPAddress& IPAddress::operator=(const IPAddress& ipAddress) {
+        this->host = ipAddress.host;
+        this->address = ipAddress.address;
+        this->port = ipAddress.port;
+        return (*this);
+    }
+
     void IPAddress::setHost(const std::string& host) {
         this->host = host;
         this->resolveAddr();
     }
 
     void IPAddress::setIP(int ip) {
-        this->ip = ip;
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof (addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(ip);
+        this->setAddress((const struct sockaddr*) &addr, sizeof (addr));
         this->toStringAddr();
     }
 
     void IPAddress::setPort(unsigned short port) {
         this->port = port;
+        if (this->address.ss_family == AF_INET6) {
+            ((struct sockaddr_in6*) &this->address)->sin6_port = htons(port);
+        } else {
+            ((struct sockaddr_in*) &this->address)->sin_port = htons(port);
+        }
+    }
+
+    void IPAddress::setAddress(const struct sockaddr* address, socklen_t length) {
+        memset(&this->address, 0, sizeof (this->address));
+        memcpy(&this->address, address, std::min((size_t) length, sizeof (this->address)));
+        this->setPort(this->port);
     }
 
     std::string IPAddress::getHost() const {
@@ -74,62 +122,118 @@ namespace asteriskcpp {
     }
 
     int IPAddress::getIP() const {
-        return (this->ip);
+        if (this->address.ss_family != AF_INET) {
+            return (0);
+        }
+        return (ntohl(((const struct sockaddr_in*) &this->address)->sin_addr.s_addr));
     }
 
     unsigned short IPAddress::getPort() const {
         return (this->port);
     }
 
-    void IPAddress::resolveAddr() {
-        boost::mutex::scoped_lock lock(mut);
-        in_addr sin_addr;
+    int IPAddress::getFamily() const {
+        return (this->address.ss_family);
+    }
 
-        char* host = (char*) this->host.c_str();
-        struct hostent* h;
+    const struct sockaddr* IPAddress::getSockAddr() const {
+        return ((const struct sockaddr*) &this->address);
+    }
 
-#ifdef WIN32
-        assert(strlen(host) >= 1);
-        if (isdigit(host[0])) {
-            // assume it is a ip address
-            unsigned long a = inet_addr(host);
-            ip = ntohl(a);
-        } else {
-            // assume it is a host name
-            h = gethostbyname(host);
+    socklen_t IPAddress::getSockAddrLength() const {
+        return (this->address.ss_family == AF_INET6 ? sizeof (struct sockaddr_in6) : sizeof (struct sockaddr_in));
+    }
 
-            if (!h) {
+    std::vector<IPAddress> IPAddress::resolve(const std::string& host, unsigned short port) {
+        std::vector<IPAddress> addresses;
+        uint64_t now = TimerWheel::now();
+        {
+            boost::mutex::scoped_lock lock(mut);
+            resolveCache_t::const_iterator it = resolveCache.find(host);
+            if (it != resolveCache.end() && it->second.expires > now) {
+                addresses = it->second.addresses;
+            }
+        }
 
-                std::cerr << "IPAddress error was " << host << " : " << strerror(errno) << std::endl;
-                assert(errno != WSANOTINITIALISED);
+        if (addresses.empty()) {
+            // getaddrinfo is reentrant, lookups of different names run in parallel
+            struct addrinfo hints;
+            memset(&hints, 0, sizeof (hints));
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            hints.ai_protocol = IPPROTO_TCP;
+
+            struct addrinfo* result = NULL;
+            int error = getaddrinfo(host.c_str(), NULL, &hints, &result);
+            if (error != 0) {
+                Throw(UnknownHostException(std::string("Error resolving ") + host + " - " + gai_strerror(error)));
+            }
+            for (struct addrinfo* ai = result; ai != NULL; ai = ai->ai_next) {
+                if (ai->ai_family == AF_INET || ai->ai_family == AF_INET6) {
+                    addresses.push_back(IPAddress(ai->ai_addr, (socklen_t) ai->ai_addrlen));
+                }
+            }
+            freeaddrinfo(result);
+            if (addresses.empty()) {
+                Throw(UnknownHostException(std::string("No address for ") + host));
+            }
 
-                ip = ntohl(0x7F000001L);
-            } else {
-                sin_addr = *(struct in_addr*) h->h_addr;
-                ip = ntohl(sin_addr.s_addr);
+            boost::mutex::scoped_lock lock(mut);
+            if (resolveCacheTime > 0) {
+                ResolveEntry& entry = resolveCache[host];
+                entry.addresses = addresses;
+                entry.expires = now + resolveCacheTime * 1000ULL;
             }
         }
-#else
-        h = gethostbyname(host);
-        if (!h) {
-            std::cerr << "IPAddress error was " << host << " : " << strerror(errno) << std::endl;
-            ip = ntohl(0x7F000001L);
-        } else {
-            sin_addr = *(struct in_addr*) h->h_addr;
-            ip = ntohl(sin_addr.s_addr);
+
+        for (std::vector<IPAddress>::iterator it = addresses.begin(); it != addresses.end(); ++it) {
+            it->setPort(port);
         }
-#endif
+        return (addresses);
     }
 
-    void IPAddress::toStringAddr() {
-        std::ostringstream strm;
+    void IPAddress::setResolveCacheTime(unsigned int seconds) {
+        boost::mutex::scoped_lock lock(mut);
+        resolveCacheTime = seconds;
+        if (seconds == 0) {
+            resolveCache.clear();
+        }
+    }
 
-        strm << ((int) (ip >> 24) & 0xFF) << ".";
-        strm << ((int) (ip >> 16) & 0xFF) << ".";
-        strm << ((int) (ip >> 8) & 0xFF) << ".";
-        strm << ((int) (ip >> 0) & 0xFF);
+    unsigned int IPAddress::getResolveCacheTime() {
+        boost::mutex::scoped_lock lock(mut);
+        return (resolveCacheTime);
+    }
+
+    void IPAddress::clearResolveCache() {
+        boost::mutex::scoped_lock lock(mut);
+        resolveCache.clear();
+    }
+
+    void IPAddress::resolveAddr() {
+        try {
+            std::vector<IPAddress> addresses(resolve(this->host, this->port));
+            this->address = addresses.front().address;
+        } catch (UnknownHostException& e) {
+            std::cerr << "IPAddress error was " << host << " : " << e.getMessage() << std::endl;
+            std::string name(this->host);
+            this->setIP(0x7F000001);
+            this->host = name;
+        }
+    }
 
-        this->host = strm.str();
+    void IPAddress::toStringAddr() {
+        char buffer[INET6_ADDRSTRLEN];
+        const void* addr;
+        if (this->address.ss_family == AF_INET6) {
+            addr = &((const struct sockaddr_in6*) &this->address)->sin6_addr;
+        } else {
+            addr = &((const struct sockaddr_in*) &this->address)->sin_addr;
+        }
+
+        if (inet_ntop(this->address.ss_family, addr, buffer, sizeof (buffer)) != NULL) {
+            this->host = buffer;
+        }
     }
 
     void IPAddress::getLocalIP() {
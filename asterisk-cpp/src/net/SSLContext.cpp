@@ -12,6 +12,16 @@ namespace asteriskcpp {
     std::string SSLContext::password2check = "";
     std::vector<boost::mutex*> SSLContext::mutexVector;
 
+    SSLContext::SSLContext() {
+        boost::mutex::scoped_lock lock(SSLContext::mut);
+
+        createCTX();
+        ERR_clear_error();
+        SSL_CTX_set_default_verify_paths(ctx);
+        SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER, NULL);
+        SSL_CTX_set_verify_depth(ctx, SSL_VERIFY_DEPTH);
+    }
+
     SSLContext::SSLContext(const std::string& certFileList) {
         boost::mutex::scoped_lock lock(SSLContext::mut);
 
@@ -36,6 +46,7 @@ namespace asteriskcpp {
     }
 
     SSLContext::~SSLContext() {
+        clearSessions();
         if (ctx)
             SSL_CTX_free(ctx);
     }
@@ -44,6 +55,64 @@ namespace asteriskcpp {
         return (ctx);
     }
 
+    SSL_SESSION* SSLContext::getSession(const std::string& server) {
+        boost::mutex::scoped_lock lock(sessionsMutex);
+        std::map<std::string, SSL_SESSION*>::iterator it = sessions.find(server);
+        if (it == sessions.end()) {
+            return (NULL);
+        }
+        SSL_SESSION_up_ref(it->second);
+        return (it->second);
+    }
+
+    void SSLContext::clearSessions() {
+        boost::mutex::scoped_lock lock(sessionsMutex);
+        for (std::map<std::string, SSL_SESSION*>::iterator it = sessions.begin(); it != sessions.end(); ++it) {
+            SSL_SESSION_free(it->second);
+        }
+        sessions.clear();
+    }
+
+    bool SSLContext::setKernelTLS(bool enable) {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+        if (enable) {
+            SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+        } else {
+            SSL_CTX_clear_options(ctx, SSL_OP_ENABLE_KTLS);
+        }
+        return (true);
+#else
+        return (!enable);
+#endif
+    }
+
+    bool SSLContext::isKernelTLS() {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+        return ((SSL_CTX_get_options(ctx) & SSL_OP_ENABLE_KTLS) != 0);
+#else
+        return (false);
+#endif
+    }
+
+    // Keeps the sessions the servers hand out, TLS 1.3 ones arrive after the handshake.
+
+    int SSLContext::newSession(SSL* ssl, SSL_SESSION* session) {
+        SSLContext* context = (SSLContext*) SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl));
+        const std::string* server = (const std::string*) SSL_get_app_data(ssl);
+        if (context == NULL || server == NULL) {
+            return (0);
+        }
+
+        boost::mutex::scoped_lock lock(context->sessionsMutex);
+        SSL_SESSION*& last = context->sessions[*server];
+        if (last != NULL) {
+            SSL_SESSION_free(last);
+        }
+        // the reference is ours
+        last = session;
+        return (1);
+    }
+
     // The method describes which SSL protocol we will be using.
 
     void SSLContext::createCTX() {
@@ -69,6 +138,11 @@ namespace asteriskcpp {
         if (ctx == NULL) {
             Throw(RuntimeException(std::string("Unable to create ssl context - ") + strerror(errno)));
         }
+
+        // client sessions are resumed through getSession
+        SSL_CTX_set_app_data(ctx, this);
+        SSL_CTX_set_session_cache_mode(ctx, SSL_CTX_get_session_cache_mode(ctx) | SSL_SESS_CACHE_CLIENT);
+        SSL_CTX_sess_set_new_cb(ctx, &SSLContext::newSession);
     }
 
     //Load the public and private keys.
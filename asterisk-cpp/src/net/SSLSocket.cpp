@@ -4,120 +4,334 @@
  * Date: 2010						*
  ************************************/
 #include "asteriskcpp/net/SSLSocket.h"
+#include "asteriskcpp/structs/TimerWheel.h"
+#include "asteriskcpp/utils/StringUtils.h"
+#include <algorithm>
+#include <limits.h>
+#include <poll.h>
+
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+#define KERNEL_TLS
+#include <sys/socket.h>
+#endif
+
+// bigger writes are split in TLS records of this size anyway
+#define MAX_RECORD_SIZE 16384
+// a write waiting to read polls this long before trying again, the
+// reading thread may have taken what it waits for
+#define WANT_READ_RETRY 10
 
 namespace asteriskcpp {
 
     SSLSocket::SSLSocket(SSLContext* sslContext, const int socketFD) :
-    TCPSocket(socketFD) {
-        boost::mutex::scoped_lock lock(SSLContext::mut);
-
-        this->sslContext = sslContext;
-
+    TCPSocket(socketFD), ssl(NULL), certified(false), sslContext(sslContext), kernelSend(false), kernelReceive(false) {
         ERR_clear_error();
         this->ssl = SSL_new(sslContext->getContext());
+        if (ssl == NULL) {
+            Throw(SSLException(getError("Unable to set ssl protocol")));
+        }
 
         SSL_set_fd(ssl, socketFD);
 
         ERR_clear_error();
         if (SSL_accept(ssl) < 1) {
-            if (ssl) {
-                SSL_shutdown(ssl);
-                SSL_free(ssl);
-            }
-            this->close();
-            Throw(SocketException(std::string("Unable to set ssl protocol - ") + ERR_error_string(SSL_get_verify_result(ssl), NULL)));
+            std::string message(getError("Unable to set ssl protocol"));
+            freeSSL();
+            Throw(SocketException(message));
         }
 
-        this->certified = (SSL_get_verify_result(ssl) == X509_V_OK && SSL_get_peer_certificate(ssl) != NULL);
+        SSL_set_mode(ssl, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+        setBlocking(false);
+        checkKernelTLS();
+
+        X509* certificate = SSL_get_peer_certificate(ssl);
+        this->certified = (SSL_get_verify_result(ssl) == X509_V_OK && certificate != NULL);
+        if (certificate != NULL) {
+            X509_free(certificate);
+        }
     }
 
     SSLSocket::SSLSocket(SSLContext* sslContext, const IPAddress& ipAddress) :
-    TCPSocket(ipAddress) {
-        boost::mutex::scoped_lock lock(SSLContext::mut);
+    TCPSocket(ipAddress), ssl(NULL), certified(false), sslContext(sslContext), kernelSend(false), kernelReceive(false) {
+        connectSSL(ipAddress.getHost());
+    }
+
+    SSLSocket::SSLSocket(SSLContext* sslContext, const std::vector<IPAddress>& addresses, const std::string& serverName,
+            const unsigned long connectTimeout) :
+    TCPSocket(addresses, connectTimeout), ssl(NULL), certified(false), sslContext(sslContext), kernelSend(false), kernelReceive(false) {
+        connectSSL(serverName);
+    }
 
-        this->sslContext = sslContext;
+    SSLSocket::~SSLSocket() {
+        boost::mutex::scoped_lock lockRead(mutRead);
+        boost::mutex::scoped_lock lockWrite(mutWrite);
 
+        freeSSL();
+    }
+
+    void SSLSocket::connectSSL(const std::string& serverName) {
         ERR_clear_error();
         this->ssl = SSL_new(sslContext->getContext());
+        if (ssl == NULL) {
+            Throw(SSLException(getError("Unable to set ssl protocol")));
+        }
 
         SSL_set_fd(ssl, socketFD);
+        SSL_set_mode(ssl, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
 
-        ERR_clear_error();
-        if (SSL_connect(ssl) < 1) {
-            if (ssl) {
-                SSL_shutdown(ssl);
-                SSL_free(ssl);
+        this->server = serverName + ":" + convertToString(peerAddress.getPort());
+        SSL_set_app_data(ssl, &server);
+        if (!serverName.empty()) {
+            SSL_set_tlsext_host_name(ssl, serverName.c_str());
+            SSL_set1_host(ssl, serverName.c_str());
+        }
+
+        SSL_SESSION* session = sslContext->getSession(server);
+        if (session != NULL) {
+            SSL_set_session(ssl, session);
+            SSL_SESSION_free(session);
+        }
+
+        setBlocking(false);
+        for (;;) {
+            ERR_clear_error();
+            int result = SSL_connect(ssl);
+            if (result == 1) {
+                break;
             }
-            this->close();
-            Throw(SocketException(std::string("Unable to set ssl protocol - ") + ERR_error_string(SSL_get_verify_result(ssl), NULL)));
+
+            int error = SSL_get_error(ssl, result);
+            if (error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_WRITE) {
+                if (waitFor(error == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT, connectDeadline)) {
+                    continue;
+                }
+                freeSSL();
+                Throw(SSLException("Unable to set ssl protocol with " + server + " - Timeout exception"));
+            }
+
+            std::string message(getError("Unable to set ssl protocol with " + server));
+            freeSSL();
+            Throw(SSLException(message));
         }
+        checkKernelTLS();
 
-        this->certified = false;
+        X509* certificate = SSL_get_peer_certificate(ssl);
+        this->certified = (SSL_get_verify_result(ssl) == X509_V_OK && certificate != NULL);
+        if (certificate != NULL) {
+            X509_free(certificate);
+        }
     }
 
-    SSLSocket::~SSLSocket() {
-        boost::mutex::scoped_lock lockRead(mutRead);
-        boost::mutex::scoped_lock lockWrite(mutWrite);
+    void SSLSocket::freeSSL() {
+        boost::mutex::scoped_lock lock(sslMutex);
 
         if (ssl) {
-            SSL_shutdown(ssl);
+            // best effort, the descriptor does not block
+            if (!releaseForced && SSL_is_init_finished(ssl)) {
+                SSL_shutdown(ssl);
+            }
             SSL_free(ssl);
+            ssl = NULL;
         }
     }
 
-    int SSLSocket::readEncryptedData(char* buffer, const unsigned int length) {
-        boost::mutex::scoped_lock lock(mutRead);
+    void SSLSocket::checkKernelTLS() {
+#ifdef KERNEL_TLS
+        this->kernelSend = (BIO_get_ktls_send(SSL_get_wbio(ssl)) != 0);
+        this->kernelReceive = (BIO_get_ktls_recv(SSL_get_rbio(ssl)) != 0);
+#endif
+    }
 
-        if (!SSL_pending((SSL *) ssl)) {
-            fd_set fdList;
+    bool SSLSocket::waitFor(short events, uint64_t deadline) {
+        for (;;) {
+            if (this->releaseForced)
+                return (false);
+
+            int wait = -1;
+            if (deadline != UINT64_MAX) {
+                uint64_t now = TimerWheel::now();
+                if (now >= deadline)
+                    return (false);
+                wait = (int) (deadline - now);
+            }
 
-            FD_ZERO(&fdList);
-            FD_SET(socketFD, &fdList);
+            struct pollfd pfd;
+            pfd.fd = socketFD;
+            pfd.events = events;
+            pfd.revents = 0;
+            int value = ::poll(&pfd, 1, wait);
+            if (value > 0) {
+                return (true);
+            } else if (value == 0) {
+                return (false);
+            } else if (errno != EINTR) {
+                return (false);
+            }
+        }
+    }
 
-            int value;
+    std::string SSLSocket::getError(const std::string& what) {
+        std::string message(what);
 
-            struct timeval timeout = this->timeout;
-            do {
-                if (!timeout.tv_usec && !timeout.tv_sec)
-                    value = ::select(socketFD + 1, &fdList, NULL, NULL, NULL);
-                else
-                    value = ::select(socketFD + 1, &fdList, NULL, NULL, &timeout);
-            } while (value == -1 && errno == EINTR);
+        unsigned long code = ERR_get_error();
+        if (code != 0) {
+            char buffer[256];
+            ERR_error_string_n(code, buffer, sizeof (buffer));
+            message.append(" - ").append(buffer);
+        } else if (errno != 0) {
+            message.append(" - ").append(strerror(errno));
+        }
 
-            if (value == 0) {
-                Throw(SocketException(std::string("Error reading from ssl socket - Timeout exception")));
-            } else if (value == -1) {
-                Throw(SocketException(std::string("Error reading from ssl socket - ") + strerror(errno)));
+        if (ssl != NULL) {
+            long verify = SSL_get_verify_result(ssl);
+            if (verify != X509_V_OK) {
+                message.append(" (").append(X509_verify_cert_error_string(verify)).append(")");
             }
-
-            if (this->releaseForced)
-                return (0);
         }
+        return (message);
+    }
 
-        int readSize = SSL_read((SSL *) ssl, buffer, length);
+    int SSLSocket::receive(char* buf, const unsigned int length) {
+        boost::mutex::scoped_lock lockRead(this->mutRead);
+        boost::mutex::scoped_lock lock(this->sslMutex);
+
+        if (this->releaseForced || ssl == NULL)
+            return (0);
+
+        // all the records already there, a read of the socket each; with
+        // kTLS as well, OpenSSL takes the session tickets and key updates
+        unsigned int total = 0;
+        while (total < length) {
+            ERR_clear_error();
+            int readSize = SSL_read(ssl, buf + total, length - total);
+            if (kernelSend && SSL_get_key_update_type(ssl) != SSL_KEY_UPDATE_NONE) {
+                // the answer would need new keys for the kernel, the writes bypass OpenSSL
+                Throw(SocketException(std::string("Error reading from ssl socket - Key update with kernel TLS")));
+            }
+            if (readSize > 0) {
+                total += readSize;
+                continue;
+            }
 
-        if (readSize < 1) {
-            Throw(SocketException("Error reading from ssl socket"));
+            int error = SSL_get_error(ssl, readSize);
+            if (error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_WRITE || total > 0) {
+                // an error shows again on the next call
+                break;
+            } else if (error == SSL_ERROR_ZERO_RETURN || error == SSL_ERROR_SYSCALL) {
+                Throw(SocketException(std::string("Error reading from ssl socket - Disconnected")));
+            }
+            Throw(SocketException(getError("Error reading from ssl socket")));
         }
 
-        return (readSize);
+        return ((int) total);
     }
 
-    void SSLSocket::writeEncryptedData(const char* buffer, const unsigned int length) {
+    void SSLSocket::writeData(const char* buf, const unsigned int length) {
         if (!length)
             return;
 
-        boost::mutex::scoped_lock lock(mutWrite);
+        boost::mutex::scoped_lock lock(this->mutWrite);
+        if (kernelSend) {
+            sendAll(buf, length, 0);
+        } else {
+            writeAll(buf, length);
+        }
+    }
 
-        int writeSize = SSL_write((SSL *) ssl, buffer, length);
+    void SSLSocket::writeData(const std::vector<std::string>& buffers) {
+        boost::mutex::scoped_lock lock(this->mutWrite);
 
-        if (writeSize < 1) {
-            Throw(SocketException("Error while writing to ssl socket"));
+        if (kernelSend) {
+            // the kernel fills its records across the sends
+            for (size_t i = 0; i < buffers.size(); i++) {
+                sendAll(buffers[i].data(), buffers[i].size(), i + 1 < buffers.size() ? MSG_MORE : 0);
+            }
+            return;
         }
 
-#ifndef _WIN32
-        fsync(socketFD);
-#endif
+        // small actions share their records instead of one each
+        std::string record;
+        for (std::vector<std::string>::const_iterator it = buffers.begin(); it != buffers.end(); ++it) {
+            if (!record.empty() && record.size() + it->size() > MAX_RECORD_SIZE) {
+                writeAll(record.data(), record.size());
+                record.clear();
+            }
+            if (it->size() >= MAX_RECORD_SIZE) {
+                writeAll(it->data(), it->size());
+            } else {
+                record.append(*it);
+            }
+        }
+        if (!record.empty()) {
+            writeAll(record.data(), record.size());
+        }
+    }
+
+    void SSLSocket::writeAll(const char* buf, const size_t length) {
+        size_t sent = 0;
+        while (sent < length) {
+            int result;
+            int error = SSL_ERROR_NONE;
+            {
+                boost::mutex::scoped_lock lock(this->sslMutex);
+                if (this->releaseForced || ssl == NULL) {
+                    Throw(SocketException(std::string("Error writing to ssl socket - Disconnected")));
+                }
+                ERR_clear_error();
+                result = SSL_write(ssl, buf + sent, (int) std::min(length - sent, (size_t) INT_MAX));
+                if (result <= 0) {
+                    error = SSL_get_error(ssl, result);
+                }
+            }
+
+            if (result > 0) {
+                sent += result;
+            } else if (error == SSL_ERROR_WANT_WRITE) {
+                waitFor(POLLOUT, UINT64_MAX);
+            } else if (error == SSL_ERROR_WANT_READ) {
+                waitFor(POLLIN, TimerWheel::now() + WANT_READ_RETRY);
+            } else {
+                Throw(SocketException(getError("Error writing to ssl socket")));
+            }
+        }
+    }
+
+    void SSLSocket::sendAll(const char* buf, const size_t length, const int flags) {
+        size_t sent = 0;
+        while (sent < length) {
+            if (this->releaseForced) {
+                Throw(SocketException(std::string("Error writing to ssl socket - Disconnected")));
+            }
+
+            ssize_t writeSize = ::send(socketFD, buf + sent, length - sent, flags | MSG_NOSIGNAL);
+            if (writeSize > 0) {
+                sent += writeSize;
+            } else if (writeSize < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                waitFor(POLLOUT, UINT64_MAX);
+            } else if (writeSize < 0 && errno != EINTR) {
+                Throw(SocketException(std::string("Error writing to ssl socket - ").append(strerror(errno))));
+            }
+        }
+    }
+
+    int SSLSocket::readEncryptedData(char* buffer, const unsigned int length) {
+        uint64_t deadline = (getTimeout() != NO_TIMEOUT ? TimerWheel::now() + getTimeout() : UINT64_MAX);
+
+        for (;;) {
+            int readSize = receive(buffer, length);
+            if (readSize > 0 || this->releaseForced)
+                return (readSize);
+
+            if (!waitFor(POLLIN, deadline)) {
+                if (this->releaseForced)
+                    return (0);
+                Throw(SocketException(std::string("Error reading from ssl socket - Timeout exception")));
+            }
+        }
+    }
+
+    void SSLSocket::writeEncryptedData(const char* buffer, const unsigned int length) {
+        writeData(buffer, length);
     }
 
     void SSLSocket::setTimeout(const unsigned long timeout) {
@@ -133,24 +347,13 @@ namespace asteriskcpp {
     }
 
     bool SSLSocket::check4readData(unsigned long timeout) {
-        boost::mutex::scoped_lock lock(mutRead);
-
-        if (SSL_pending((SSL *) ssl))
-            return (true);
-
-        struct timeval time;
-        fd_set fdList;
-
-        time.tv_usec = (timeout % 1000) * 1000;
-        time.tv_sec = timeout / 1000;
-
-        FD_ZERO(&fdList);
-        FD_SET(socketFD, &fdList);
+        {
+            boost::mutex::scoped_lock lock(this->sslMutex);
+            if (ssl != NULL && SSL_pending(ssl))
+                return (true);
+        }
 
-        if (select(socketFD + 1, &fdList, NULL, NULL, &time) <= 0)
-            return (false);
-        else
-            return (true);
+        return (waitFor(POLLIN, TimerWheel::now() + timeout));
     }
 
     IPAddress SSLSocket::getLocalAddress() {
@@ -165,4 +368,17 @@ namespace asteriskcpp {
         return (this->certified);
     }
 
+    bool SSLSocket::isSessionReused() {
+        boost::mutex::scoped_lock lock(this->sslMutex);
+        return (ssl != NULL && SSL_session_reused(ssl) == 1);
+    }
+
+    bool SSLSocket::isKernelSend() {
+        return (this->kernelSend);
+    }
+
+    bool SSLSocket::isKernelReceive() {
+        return (this->kernelReceive);
+    }
+
 }
@@ -8,13 +8,65 @@
 //http://tldp.org/LDP/LG/issue74/tougher.html
 #include "asteriskcpp/net/TCPSocket.h"
 #include "asteriskcpp/exceptions/IOException.h"
+#include "asteriskcpp/structs/TimerWheel.h"
+#include <algorithm>
+#ifndef _WIN32
+#include <limits.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#else
+#define poll WSAPoll
+#endif
 
 #define RCVBUFSIZE 65536
+// between two connection attempts, as RFC 8305 recommends
+#define CONNECT_ATTEMPT_DELAY 250
+#ifdef IOV_MAX
+#define MAX_IOV IOV_MAX
+#else
+#define MAX_IOV 1024
+#endif
 
 namespace asteriskcpp {
 
+    static int lastSocketError() {
+#ifdef _WIN32
+        return (WSAGetLastError());
+#else
+        return (errno);
+#endif
+    }
+
+    static bool inProgress(int error) {
+#ifdef _WIN32
+        return (error == WSAEWOULDBLOCK);
+#else
+        return (error == EINPROGRESS);
+#endif
+    }
+
+    static void setBlockingFD(int fd, bool blocking) {
+#ifdef _WIN32
+        u_long mode = blocking ? 0 : 1;
+        ioctlsocket(fd, FIONBIO, &mode);
+#else
+        int flags = fcntl(fd, F_GETFL, 0);
+        fcntl(fd, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK));
+#endif
+    }
+
+    static void closeFD(int fd) {
+#ifdef _WIN32
+        closesocket(fd);
+#else
+        ::close(fd);
+#endif
+    }
+
     TCPSocket::TCPSocket(const int fd) :
-    socketFD(fd), releaseForced(false) {
+    socketFD(fd), releaseForced(false), ipAddress(0, 0), peerAddress(0, 0), connectDeadline(UINT64_MAX) {
         timeout.tv_usec = NO_TIMEOUT;
         timeout.tv_sec = NO_TIMEOUT;
 
@@ -22,29 +74,128 @@ namespace asteriskcpp {
         this->resolveLocalAddr();
     }
 
-    TCPSocket::TCPSocket(const IPAddress& ipAddress) :
-    releaseForced(false), peerAddress(ipAddress) {
-        struct sockaddr_in addr;
+    TCPSocket::TCPSocket(const IPAddress& ipAddress, const unsigned long connectTimeout) :
+    releaseForced(false), ipAddress(0, 0), peerAddress(ipAddress), connectDeadline(UINT64_MAX) {
+        timeout.tv_usec = NO_TIMEOUT;
+        timeout.tv_sec = NO_TIMEOUT;
 
-        if ((socketFD = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) == -1) {
-            Throw(SocketException(std::string("Error creating the socket - ").append(strerror(errno))));
-        }
+        this->connect(std::vector<IPAddress>(1, ipAddress), connectTimeout);
+        this->resolveLocalAddr();
+    }
 
-        memset(&addr, 0, sizeof (addr));
+    TCPSocket::TCPSocket(const std::vector<IPAddress>& addresses, const unsigned long connectTimeout) :
+    releaseForced(false), ipAddress(0, 0), peerAddress(0, 0), connectDeadline(UINT64_MAX) {
+        timeout.tv_usec = NO_TIMEOUT;
+        timeout.tv_sec = NO_TIMEOUT;
 
-        addr.sin_family = AF_INET;
-        addr.sin_port = htons(peerAddress.getPort());
-        addr.sin_addr.s_addr = htonl(peerAddress.getIP());
+        this->connect(addresses, connectTimeout);
+        this->resolveLocalAddr();
+    }
 
-        //Open the socket
-        if (::connect(this->socketFD, (struct sockaddr *) &addr, sizeof (addr)) != 0) {
-            Throw(SocketException(std::string("Error creating the socket - ").append(strerror(errno))));
+    void TCPSocket::connect(const std::vector<IPAddress>& addresses, const unsigned long connectTimeout) {
+        // the family of the preferred address first, then each in turn
+        std::vector<const IPAddress*> order;
+        std::vector<const IPAddress*> others;
+        for (std::vector<IPAddress>::const_iterator it = addresses.begin(); it != addresses.end(); ++it) {
+            (it->getFamily() == addresses.front().getFamily() ? order : others).push_back(&(*it));
+        }
+        for (size_t i = 0; i < others.size(); i++) {
+            order.insert(order.begin() + std::min(order.size(), 2 * i + 1), others[i]);
         }
 
-        timeout.tv_usec = NO_TIMEOUT;
-        timeout.tv_sec = NO_TIMEOUT;
+        uint64_t now = TimerWheel::now();
+        uint64_t deadline = (connectTimeout != NO_TIMEOUT ? now + connectTimeout : UINT64_MAX);
+        this->connectDeadline = deadline;
+        uint64_t nextAttempt = now;
+        size_t next = 0;
+        std::vector<struct pollfd> pending;
+        std::vector<const IPAddress*> pendingAddresses;
+        std::string error("no address");
+        int connected = -1;
+
+        while (connected == -1) {
+            while (next < order.size() && connected == -1 && now < deadline && (pending.empty() || now >= nextAttempt)) {
+                const IPAddress* address = order[next++];
+                int fd = ::socket(address->getFamily(), SOCK_STREAM, IPPROTO_TCP);
+                if (fd == -1) {
+                    error = strerror(lastSocketError());
+                    continue;
+                }
+
+                setBlockingFD(fd, false);
+                if (::connect(fd, address->getSockAddr(), address->getSockAddrLength()) == 0) {
+                    connected = fd;
+                    this->peerAddress = *address;
+                } else if (inProgress(lastSocketError())) {
+                    struct pollfd p;
+                    p.fd = fd;
+                    p.events = POLLOUT;
+                    p.revents = 0;
+                    pending.push_back(p);
+                    pendingAddresses.push_back(address);
+                    nextAttempt = now + CONNECT_ATTEMPT_DELAY;
+                } else {
+                    // unreachable family, refused... the next one starts at once
+                    error = strerror(lastSocketError());
+                    closeFD(fd);
+                }
+            }
+
+            if (connected != -1 || pending.empty()) {
+                break;
+            }
+            if (now >= deadline) {
+                error = "Timeout";
+                break;
+            }
+
+            uint64_t wakeup = (next < order.size() ? std::min(deadline, nextAttempt) : deadline);
+            int wait = (wakeup == UINT64_MAX ? -1 : (int) (wakeup - now));
+            if (::poll(&pending[0], pending.size(), wait) == -1 && lastSocketError() != EINTR) {
+                error = strerror(lastSocketError());
+                break;
+            }
+
+            now = TimerWheel::now();
+            for (size_t i = 0; i < pending.size();) {
+                if (pending[i].revents == 0) {
+                    i++;
+                    continue;
+                }
+
+                int result = 0;
+                socklen_t length = sizeof (result);
+                if (getsockopt(pending[i].fd, SOL_SOCKET, SO_ERROR, (char*) &result, &length) == -1) {
+                    result = lastSocketError();
+                }
+                if (result == 0) {
+                    connected = pending[i].fd;
+                    this->peerAddress = *pendingAddresses[i];
+                } else {
+                    error = strerror(result);
+                    closeFD(pending[i].fd);
+                    nextAttempt = now;
+                }
+                pending.erase(pending.begin() + i);
+                pendingAddresses.erase(pendingAddresses.begin() + i);
+                if (connected != -1) {
+                    break;
+                }
+            }
+        }
 
-        this->resolveLocalAddr();
+        // the losers of the race
+        for (std::vector<struct pollfd>::const_iterator it = pending.begin(); it != pending.end(); ++it) {
+            closeFD(it->fd);
+        }
+
+        if (connected == -1) {
+            std::string target(addresses.empty() ? std::string() : addresses.front().getHost());
+            Throw(SocketException(std::string("Error connecting to ") + target + " - " + error));
+        }
+
+        setBlockingFD(connected, true);
+        this->socketFD = connected;
     }
 
     TCPSocket::~TCPSocket() {
@@ -95,6 +246,26 @@ namespace asteriskcpp {
         return (readSize);
     }
 
+    int TCPSocket::receive(char* buf, const unsigned int length) {
+        boost::mutex::scoped_lock lock(this->mutRead);
+
+        if (this->releaseForced)
+            return (0);
+
+        int readSize = ::recv(socketFD, buf, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+        if (readSize == 0) {
+            Throw(SocketException(std::string("Error reading from socket - Disconnected")));
+        } else if (readSize == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                return (0);
+            }
+            Throw(SocketException(std::string("Error reading from socket - ").append(strerror(errno))));
+        }
+
+        return (readSize);
+    }
+
     std::string TCPSocket::readData() {
         char buffer[(RCVBUFSIZE + 1)] = "\0";
         int bytesRead = this->readData(buffer, RCVBUFSIZE);
@@ -127,6 +298,72 @@ namespace asteriskcpp {
         this->writeData(data.c_str(), (unsigned int) (data.length()));
     }
 
+    void TCPSocket::writeData(const std::vector<std::string>& buffers) {
+        boost::mutex::scoped_lock lock(this->mutWrite);
+
+#ifndef _WIN32
+        std::vector<struct iovec> iov;
+        iov.reserve(std::min(buffers.size(), (size_t) MAX_IOV));
+        size_t next = 0;
+        size_t first = 0;
+        while (next < buffers.size() || first < iov.size()) {
+            if (first == iov.size()) {
+                iov.clear();
+                first = 0;
+                for (; next < buffers.size() && iov.size() < MAX_IOV; next++) {
+                    if (!buffers[next].empty()) {
+                        struct iovec v;
+                        v.iov_base = const_cast<char*> (buffers[next].data());
+                        v.iov_len = buffers[next].length();
+                        iov.push_back(v);
+                    }
+                }
+                if (iov.empty()) {
+                    break;
+                }
+            }
+
+            struct msghdr msg;
+            memset(&msg, 0, sizeof (msg));
+            msg.msg_iov = &iov[first];
+            msg.msg_iovlen = iov.size() - first;
+            ssize_t writeSize = ::sendmsg(socketFD, &msg, MSG_NOSIGNAL);
+            if (writeSize < 0 && errno == EINTR) {
+                continue;
+            }
+            if (writeSize <= 0) {
+                Throw(SocketException(std::string("Error writing to socket - ").append(strerror(errno))));
+            }
+
+            // skips what was written, the rest of a partly written buffer is sent next
+            size_t written = (size_t) writeSize;
+            while (first < iov.size() && written >= iov[first].iov_len) {
+                written -= iov[first].iov_len;
+                first++;
+            }
+            if (written > 0) {
+                iov[first].iov_base = (char*) iov[first].iov_base + written;
+                iov[first].iov_len -= written;
+            }
+        }
+#else
+        for (std::vector<std::string>::const_iterator it = buffers.begin(); it != buffers.end(); ++it) {
+            size_t sent = 0;
+            while (sent < it->length()) {
+                int writeSize = ::send(socketFD, it->data() + sent, (int) (it->length() - sent), 0);
+                if (writeSize <= 0) {
+                    Throw(SocketException(std::string("Error writing to socket - ").append(strerror(errno))));
+                }
+                sent += writeSize;
+            }
+        }
+#endif
+    }
+
+    void TCPSocket::setBlocking(const bool blocking) {
+        setBlockingFD(this->socketFD, blocking);
+    }
+
     void TCPSocket::setTimeout(const unsigned long timeout) {
         this->timeout.tv_usec = (timeout % 1000) * 1000;
         this->timeout.tv_sec = timeout / 1000;
@@ -185,7 +422,7 @@ namespace asteriskcpp {
     }
 
     void TCPSocket::resolvePeerAddr() {
-        struct sockaddr_in client_addr;
+        struct sockaddr_storage client_addr;
 #ifdef _WIN32
         int size = sizeof (client_addr);
 #else
@@ -196,8 +433,7 @@ namespace asteriskcpp {
             Throw(SocketException(std::string("Error getting socket addr - ").append(strerror(errno))));
         }
 
-        this->peerAddress.setIP(ntohl(client_addr.sin_addr.s_addr));
-        this->peerAddress.setPort(ntohs(client_addr.sin_port));
+        this->peerAddress = IPAddress((struct sockaddr *) &client_addr, size);
     }
 
     int TCPSocket::getSocketFD() {
@@ -205,7 +441,7 @@ namespace asteriskcpp {
     }
 
     void TCPSocket::resolveLocalAddr() {
-        struct sockaddr_in local_addr;
+        struct sockaddr_storage local_addr;
 #ifdef _WIN32
         int size = sizeof (local_addr);
 #else
@@ -216,6 +452,6 @@ namespace asteriskcpp {
             Throw(SocketException(std::string("Error getting socket addr - ").append(strerror(errno))));
         }
 
-        this->ipAddress.setPort(ntohs(local_addr.sin_port));
+        this->ipAddress = IPAddress((struct sockaddr *) &local_addr, size);
     }
 }
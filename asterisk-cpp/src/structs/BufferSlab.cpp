@@ -0,0 +1,92 @@
+/*
+ * BufferSlab.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/structs/BufferSlab.h"
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+
+namespace asteriskcpp {
+
+    BufferSlab::BufferSlab(size_t capacity) :
+    buffer(new char[capacity]), size(capacity) {
+    }
+
+    BufferSlab::~BufferSlab() {
+        delete[] buffer;
+    }
+
+    char* BufferSlab::data() {
+        return (buffer);
+    }
+
+    const char* BufferSlab::data() const {
+        return (buffer);
+    }
+
+    size_t BufferSlab::capacity() const {
+        return (size);
+    }
+
+    SlabView::SlabView() :
+    ptr(NULL), len(0) {
+    }
+
+    SlabView::SlabView(const BufferSlabPtr& slab, size_t offset, size_t length) :
+    slab(slab), ptr(slab->data() + offset), len(length) {
+    }
+
+    SlabView SlabView::fromString(const std::string& str) {
+        BufferSlabPtr slab(new BufferSlab(str.length() + 1));
+        memcpy(slab->data(), str.data(), str.length());
+        return (SlabView(slab, 0, str.length()));
+    }
+
+    const char* SlabView::data() const {
+        return (ptr);
+    }
+
+    size_t SlabView::length() const {
+        return (len);
+    }
+
+    bool SlabView::empty() const {
+        return (len == 0);
+    }
+
+    SlabView SlabView::sub(size_t offset, size_t length) const {
+        SlabView view(*this);
+        if (offset > len) {
+            offset = len;
+        }
+        view.ptr = ptr + offset;
+        view.len = std::min(length, len - offset);
+        return (view);
+    }
+
+    size_t SlabView::find(const char* str, size_t from) const {
+        size_t n = strlen(str);
+        if (from >= len || n == 0 || n > len - from) {
+            return (std::string::npos);
+        }
+        const char* end = ptr + len;
+        const char* it = std::search(ptr + from, end, str, str + n);
+        return (it == end ? std::string::npos : (size_t) (it - ptr));
+    }
+
+    bool SlabView::istartsWith(const char* prefix) const {
+        size_t n = strlen(prefix);
+        if (n > len) {
+            return (false);
+        }
+        return (strncasecmp(ptr, prefix, n) == 0);
+    }
+
+    std::string SlabView::str() const {
+        return (std::string(ptr == NULL ? "" : ptr, len));
+    }
+
+}
@@ -6,26 +6,90 @@
  */
 
 #include "asteriskcpp/structs/PropertyMap.h"
-#include <vector>
-#include <boost/algorithm/string.hpp>
-#include <boost/regex.hpp>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
 #include "asteriskcpp/utils/LogHandler.h"
 #include <typeinfo>
 #include <stdio.h>
+#include <boost/thread/thread.hpp>
 
 #define SEP ": "
 #define NEWLINE "\r\n"
+// buffer is compacted once this many bytes, and half of it, are dead
+#define COMPACT_MIN_DEAD 1024
+#define NO_SLOT UINT32_MAX
 
 namespace asteriskcpp {
     const std::string strEmpty("");
 
-    PropertyMap::PropertyMap() {
+    PropertyMap::PropertyMap() :
+    dead(0), pending(false), cacheUsed(0) {
     }
 
-    PropertyMap::PropertyMap(const std::string & str) {
+    PropertyMap::PropertyMap(const std::string & str) :
+    dead(0), pending(false), cacheUsed(0) {
         convertStr(str);
     }
 
+    PropertyMap::PropertyMap(const PropertyMap& other) :
+    dead(0), pending(false), cacheUsed(0) {
+        *this = other;
+    }
+
+    PropertyMap& PropertyMap::operator=(const PropertyMap& other) {
+        if (this != &other) {
+            frame = other.frame;
+            buffer = other.buffer;
+            dead = other.dead;
+            fields = other.fields;
+            preloaded = other.preloaded;
+            pending.store(other.pending.load());
+            // the values cached are those of other
+            for (fieldsList_t::iterator it = fields.begin(); it != fields.end(); ++it) {
+                it->cached.store(NULL, boost::memory_order_relaxed);
+                it->slot = NO_SLOT;
+            }
+            for (fieldsList_t::iterator it = preloaded.begin(); it != preloaded.end(); ++it) {
+                it->cached.store(NULL, boost::memory_order_relaxed);
+                it->slot = NO_SLOT;
+            }
+            cacheUsed = 0;
+        }
+        return (*this);
+    }
+
+    PropertyMap::Field::Field() :
+    hash(0), keyOffset(0), keyLength(0), valueOffset(0), valueLength(0), local(false), cached(NULL), slot(NO_SLOT) {
+    }
+
+    PropertyMap::Field::Field(const Field& other) :
+    hash(other.hash), keyOffset(other.keyOffset), keyLength(other.keyLength), valueOffset(other.valueOffset),
+    valueLength(other.valueLength), local(other.local), cached(other.cached.load(boost::memory_order_relaxed)), slot(other.slot) {
+    }
+
+    PropertyMap::Field& PropertyMap::Field::operator=(const Field& other) {
+        hash = other.hash;
+        keyOffset = other.keyOffset;
+        keyLength = other.keyLength;
+        valueOffset = other.valueOffset;
+        valueLength = other.valueLength;
+        local = other.local;
+        cached.store(other.cached.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
+        slot = other.slot;
+        return (*this);
+    }
+
+    void PropertyMap::lock() const {
+        while (spin.test_and_set(boost::memory_order_acquire)) {
+            boost::this_thread::yield();
+        }
+    }
+
+    void PropertyMap::unlock() const {
+        spin.clear(boost::memory_order_release);
+    }
+
     PropertyMap::~PropertyMap() {
     }
 
@@ -38,71 +102,301 @@ namespace asteriskcpp {
     }
 
     const std::string PropertyMap::toString() const {
-        std::stringstream stream;
-        for (propertyIndex::const_iterator it = index.begin(); it != index.end(); it++) {
-            stream << makeStdLine(*it, getProperty(*it));
+        std::string str;
+        appendProperties(str);
+        str.append(NEWLINE);
+        return (str);
+    }
+
+    void PropertyMap::appendProperties(std::string& out) const {
+        ensureParsed();
+        size_t length = 0;
+        for (fieldsList_t::const_iterator it = fields.begin(); it != fields.end(); ++it) {
+            length += it->keyLength + it->valueLength + 4;
+        }
+        out.reserve(out.length() + length + 2);
+
+        for (fieldsList_t::const_iterator it = fields.begin(); it != fields.end(); ++it) {
+            const char* data = base(*it);
+            // same lines as makeStdLine
+            if (it->keyLength >= 2) {
+                out.append(data + it->keyOffset, it->keyLength);
+                out.append(SEP, 2);
+            }
+            out.append(data + it->valueOffset, it->valueLength);
+            out.append(NEWLINE, 2);
         }
-        stream << NEWLINE;
-        return (stream.str());
     }
 
     std::string PropertyMap::toLog() const {
         return (str2Log(this->toString()));
     }
 
+    uint32_t PropertyMap::hashKey(const char* key, size_t length) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; i++) {
+            hash ^= (uint32_t) (unsigned char) PropertyKey::lower(key[i]);
+            hash *= 16777619u;
+        }
+        return (hash);
+    }
+
+    const char* PropertyMap::base(const Field& field) const {
+        return (field.local ? buffer.data() : frame.data());
+    }
+
+    const PropertyMap::Field* PropertyMap::findField(const char* key, size_t length, uint32_t hash) const {
+        return (findField(fields, key, length, hash));
+    }
+
+    const PropertyMap::Field* PropertyMap::findField(const fieldsList_t& list, const char* key, size_t length, uint32_t hash) const {
+        // the last one wins, as when a repeated key replaced the previous value
+        for (fieldsList_t::const_reverse_iterator it = list.rbegin(); it != list.rend(); ++it) {
+            if (it->hash == hash && it->keyLength == length
+                    && strncasecmp(base(*it) + it->keyOffset, key, length) == 0) {
+                return (&(*it));
+            }
+        }
+        return (NULL);
+    }
+
+    const PropertyMap::Field* PropertyMap::lookupField(const char* key, size_t length, uint32_t hash) const {
+        if (pending.load(boost::memory_order_acquire)) {
+            const Field* field = findField(preloaded, key, length, hash);
+            if (field != NULL) {
+                return (field);
+            }
+            // not preloaded, time to parse the whole frame
+            ensureParsed();
+        }
+        return (findField(fields, key, length, hash));
+    }
+
+    const std::string& PropertyMap::lookup(const char* key, size_t length, uint32_t hash) const {
+        const Field* field = lookupField(key, length, hash);
+        if (field == NULL) {
+            return ((strEmpty));
+        }
+
+        const std::string* value = field->cached.load(boost::memory_order_acquire);
+        if (value == NULL) {
+            lock();
+            try {
+                // another reader may have been first
+                value = field->cached.load(boost::memory_order_relaxed);
+                if (value == NULL) {
+                    // a changed value is materialized again in the entry of the field
+                    if (field->slot == NO_SLOT) {
+                        if (cacheUsed == cache.size()) {
+                            cache.push_back(std::string());
+                        }
+                        field->slot = (uint32_t) cacheUsed++;
+                    }
+                    // the deque never moves its elements
+                    std::string& entry = cache[field->slot];
+                    entry.assign(base(*field) + field->valueOffset, field->valueLength);
+                    value = &entry;
+                    field->cached.store(value, boost::memory_order_release);
+                }
+            } catch (...) {
+                unlock();
+                throw;
+            }
+            unlock();
+        }
+        return (*value);
+    }
+
+    boost::string_ref PropertyMap::view(const Field* field) const {
+        if (field == NULL) {
+            return (boost::string_ref());
+        }
+        return (boost::string_ref(base(*field) + field->valueOffset, field->valueLength));
+    }
+
+    void PropertyMap::parseFrame() {
+        // the preloaded fields are parsed again with the others
+        parse(frame.data(), 0, frame.length(), false);
+    }
+
+    void PropertyMap::ensureParsed() const {
+        if (!pending.load(boost::memory_order_acquire)) {
+            return;
+        }
+
+        lock();
+        try {
+            if (pending.load(boost::memory_order_relaxed)) {
+                const_cast<PropertyMap*> (this)->parseFrame();
+                pending.store(false, boost::memory_order_release);
+            }
+        } catch (...) {
+            unlock();
+            throw;
+        }
+        unlock();
+    }
+
     void PropertyMap::setProperty(const std::string& key, const std::string& value) {
-        propertyMap::const_iterator it = values.find(key);
-        if (it != values.end())
-            editProperty(key, value);
-        else
-            addProperty(key, value);
+        ensureParsed();
+        storeProperty(key.data(), key.length(), hashKey(key.data(), key.length()), value);
     }
 
     const std::string& PropertyMap::getGetterValue(const char *functionName) const {
         return (getProperty(func2property(functionName)));
     }
 
+    const std::string& PropertyMap::getGetterValue(const PropertyKey& key) const {
+        return (lookup(key.name, key.length, key.hash));
+    }
+
     void PropertyMap::setSetterValue(const char *functionName, const std::string& value) {
         setProperty(func2property(functionName), value);
     }
 
+    void PropertyMap::setSetterValue(const PropertyKey& key, const std::string& value) {
+        ensureParsed();
+        storeProperty(key.name, key.length, key.hash, value);
+    }
+
     const std::string& PropertyMap::getProperty(const std::string& key) const {
-        propertyMap::const_iterator it = values.find(key);
-        if (it != values.end()) {
-            return (it->second);
+        return (lookup(key.data(), key.length(), hashKey(key.data(), key.length())));
+    }
+
+    boost::string_ref PropertyMap::getPropertyView(const std::string& key) const {
+        return (view(lookupField(key.data(), key.length(), hashKey(key.data(), key.length()))));
+    }
+
+    boost::string_ref PropertyMap::getPropertyView(const PropertyKey& key) const {
+        return (view(lookupField(key.name, key.length, key.hash)));
+    }
+
+    std::vector<std::string> PropertyMap::getProperties(const std::string& key) const {
+        ensureParsed();
+        std::vector<std::string> result;
+        uint32_t hash = hashKey(key.data(), key.length());
+        for (fieldsList_t::const_iterator it = fields.begin(); it != fields.end(); ++it) {
+            const char* data = base(*it);
+            if (it->hash == hash && it->keyLength == key.length()
+                    && strncasecmp(data + it->keyOffset, key.data(), key.length()) == 0) {
+                result.push_back(std::string(data + it->valueOffset, it->valueLength));
+            }
         }
+        return (result);
+    }
 
-        return ((strEmpty));
+    bool PropertyMap::hasProperty(const std::string& key) const {
+        ensureParsed();
+        return (findField(key.data(), key.length(), hashKey(key.data(), key.length())) != NULL);
     }
 
     void PropertyMap::convertStr(const std::string& propertyStr) {
-        std::string knull;
-        std::string::size_type lastPos = propertyStr.find_first_not_of(NEWLINE, 0);
-        std::string::size_type pos = propertyStr.find(NEWLINE);
-        while (std::string::npos != pos && std::string::npos != lastPos) {
-            std::string line = propertyStr.substr(lastPos, pos - lastPos);
-
-            size_t sep = line.find(SEP);
-            if (knull.size() == 0 && sep != line.npos && sep < 35) {
-                setProperty(line.substr(0, sep), line.substr(sep + 2));
-            } else {
-                //std::cout << "knull[" << str2Log(line) << "]" << std::endl;
-                knull.append(line);
+        size_t offset = buffer.length();
+        buffer.append(propertyStr);
+        parse(buffer.data(), offset, propertyStr.length(), true);
+    }
+
+    void PropertyMap::reset() {
+        frame = SlabView();
+        buffer.clear();
+        dead = 0;
+        fields.clear();
+        preloaded.clear();
+        pending.store(false);
+        cacheUsed = 0;
+    }
+
+    void PropertyMap::convertFrame(const SlabView& frame) {
+        attachFrame(frame);
+        ensureParsed();
+    }
+
+    void PropertyMap::attachFrame(const SlabView& frame) {
+        if (this->frame.empty()) {
+            this->frame = frame;
+            pending.store(true);
+        } else {
+            // fields can only refer to one frame
+            convertStr(frame.str());
+        }
+    }
+
+    void PropertyMap::preloadProperty(const PropertyKey& key) {
+        if (!pending.load()) {
+            return;
+        }
+
+        const char* data = frame.data();
+        size_t end = frame.length();
+        size_t pos = 0;
+        size_t found = std::string::npos;
+        size_t foundLength = 0;
+        while (pos < end) {
+            const char* lineEnd = std::search(data + pos, data + end, NEWLINE, NEWLINE + 2);
+            size_t lineLength = (lineEnd - data) - pos;
+            if (lineLength >= key.length + 2 && data[pos + key.length] == ':' && data[pos + key.length + 1] == ' '
+                    && strncasecmp(data + pos, key.name, key.length) == 0) {
+                found = pos;
+                foundLength = lineLength;
             }
+            pos += lineLength + 2;
+        }
 
-            std::string::size_type tmpLastPos = lastPos;
-            lastPos = propertyStr.find_first_not_of(NEWLINE, pos);
-            pos = propertyStr.find(NEWLINE, tmpLastPos);
+        if (found != std::string::npos) {
+            addField(preloaded, found, key.length, found + key.length + 2, foundLength - key.length - 2, false);
+        }
+    }
+
+    void PropertyMap::parse(const char* data, size_t offset, size_t length, bool local) {
+        std::string knull;
+        size_t end = offset + length;
+        size_t pos = offset;
+        while (pos < end) {
+            const char* lineEnd = std::search(data + pos, data + end, NEWLINE, NEWLINE + 2);
+            size_t lineLength = (lineEnd - data) - pos;
+
+            if (lineLength > 0) {
+                const char* line = data + pos;
+                const char* sep = std::search(line, line + lineLength, SEP, SEP + 2);
+                if (knull.size() == 0 && sep != line + lineLength && sep - line < 35) {
+                    size_t keyLength = sep - line;
+                    addField(fields, pos, keyLength, pos + keyLength + 2, lineLength - keyLength - 2, local);
+                } else {
+                    knull.append(line, lineLength);
+                }
+            }
+            pos += lineLength + 2;
         }
 
         if (knull.size())
-            setProperty("", knull);
+            storeProperty("", 0, hashKey("", 0), knull);
     }
 
-    void PropertyMap::addProperty(const std::string& key, const std::string& value) {
-        propertyPair p = std::make_pair(key, value);
-        index.push_back(key);
-        values.insert(p);
+    void PropertyMap::addField(fieldsList_t& list, size_t keyOffset, size_t keyLength, size_t valueOffset, size_t valueLength, bool local) {
+        Field field;
+        field.hash = hashKey((local ? buffer.data() : frame.data()) + keyOffset, keyLength);
+        field.keyOffset = (uint32_t) keyOffset;
+        field.keyLength = (uint32_t) keyLength;
+        field.valueOffset = (uint32_t) valueOffset;
+        field.valueLength = (uint32_t) valueLength;
+        field.local = local;
+        list.push_back(field);
+    }
+
+    void PropertyMap::storeProperty(const char* key, size_t length, uint32_t hash, const std::string& value) {
+        Field* field = const_cast<Field*> (findField(key, length, hash));
+        if (field != NULL)
+            editProperty(*field, value);
+        else
+            addProperty(key, length, value);
+    }
+
+    void PropertyMap::addProperty(const char* key, size_t length, const std::string& value) {
+        size_t keyOffset = buffer.length();
+        buffer.append(key, length);
+        size_t valueOffset = buffer.length();
+        buffer.append(value);
+        addField(fields, keyOffset, length, valueOffset, value.length(), true);
     }
 
     std::string PropertyMap::makeStdLine(const std::string & key, const std::string & value) {
@@ -112,8 +406,48 @@ namespace asteriskcpp {
         return (std::string(key + SEP + value + NEWLINE));
     }
 
-    void PropertyMap::editProperty(const std::string& key, const std::string& value) {
-        values[key] = value;
+    void PropertyMap::editProperty(Field& field, const std::string& value) {
+        field.cached.store(NULL, boost::memory_order_relaxed);
+        if (field.local && value.length() <= field.valueLength) {
+            // a reused action setting values of the same size again stays in place
+            value.copy(&buffer[field.valueOffset], value.length());
+            dead += field.valueLength - value.length();
+            field.valueLength = (uint32_t) value.length();
+            return;
+        }
+
+        if (!field.local) {
+            std::string key(frame.data() + field.keyOffset, field.keyLength);
+            field.keyOffset = (uint32_t) buffer.length();
+            buffer.append(key);
+            field.local = true;
+        } else {
+            dead += field.valueLength;
+        }
+        field.valueOffset = (uint32_t) buffer.length();
+        field.valueLength = (uint32_t) value.length();
+        buffer.append(value);
+
+        if (dead >= COMPACT_MIN_DEAD && dead * 2 >= buffer.length()) {
+            compact();
+        }
+    }
+
+    void PropertyMap::compact() {
+        std::string live;
+        live.reserve(buffer.length() - dead);
+        for (fieldsList_t::iterator it = fields.begin(); it != fields.end(); ++it) {
+            if (it->local) {
+                size_t keyOffset = live.length();
+                live.append(buffer, it->keyOffset, it->keyLength);
+                size_t valueOffset = live.length();
+                live.append(buffer, it->valueOffset, it->valueLength);
+                it->keyOffset = (uint32_t) keyOffset;
+                it->valueOffset = (uint32_t) valueOffset;
+            }
+        }
+        buffer.swap(live);
+        dead = 0;
     }
 
     const std::string PropertyMap::func2property(const char *functionName) {
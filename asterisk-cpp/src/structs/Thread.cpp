@@ -47,6 +47,10 @@ namespace asteriskcpp {
         }
     }
 
+    bool Thread::isCurrent() const {
+        return (m_thread != NULL && m_thread->get_id() == boost::this_thread::get_id());
+    }
+
     void Thread::run() {
         LOG_WARN_STR("This thread is running a empty method!!");
     }
@@ -0,0 +1,137 @@
+/*
+ * TimerWheel.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asteriskcpp/structs/TimerWheel.h"
+#include <time.h>
+
+namespace asteriskcpp {
+
+    TimerWheel::Timer::Timer() :
+    prev(NULL), next(NULL), deadline(0) {
+    }
+
+    TimerWheel::Timer::~Timer() {
+    }
+
+    bool TimerWheel::Timer::isScheduled() const {
+        return (next != NULL);
+    }
+
+    TimerWheel::TimerWheel(unsigned int tick, size_t slots) :
+    slots(slots), tick(tick > 0 ? tick : 1), current(now() / this->tick), count(0) {
+        // every slot is the sentinel of a circular list
+        for (std::vector<Timer>::iterator it = this->slots.begin(); it != this->slots.end(); ++it) {
+            it->prev = &(*it);
+            it->next = &(*it);
+        }
+    }
+
+    TimerWheel::~TimerWheel() {
+        clear();
+    }
+
+    uint64_t TimerWheel::now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ((uint64_t) ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+    }
+
+    TimerWheel::Timer& TimerWheel::slotOf(uint64_t tickNumber) {
+        return (slots[tickNumber % slots.size()]);
+    }
+
+    void TimerWheel::schedule(Timer* timer, unsigned int timeout) {
+        schedule(timer, timeout, now());
+    }
+
+    void TimerWheel::schedule(Timer* timer, unsigned int timeout, uint64_t now) {
+        cancel(timer);
+
+        timer->deadline = now + timeout;
+        // rounded up, a timer never expires early
+        uint64_t tickNumber = (timer->deadline + tick - 1) / tick;
+        if (tickNumber < current) {
+            tickNumber = current;
+        }
+
+        Timer& head = slotOf(tickNumber);
+        timer->next = &head;
+        timer->prev = head.prev;
+        head.prev->next = timer;
+        head.prev = timer;
+        count++;
+    }
+
+    void TimerWheel::cancel(Timer* timer) {
+        if (timer->isScheduled()) {
+            timer->prev->next = timer->next;
+            timer->next->prev = timer->prev;
+            timer->prev = NULL;
+            timer->next = NULL;
+            count--;
+        }
+    }
+
+    void TimerWheel::clear() {
+        for (std::vector<Timer>::iterator it = slots.begin(); it != slots.end(); ++it) {
+            while (it->next != &(*it)) {
+                cancel(it->next);
+            }
+        }
+    }
+
+    void TimerWheel::advance(uint64_t now, std::vector<Timer*>& expired) {
+        uint64_t last = now / tick;
+        if (last < current) {
+            return;
+        }
+        // a long pause is one turn, the later rounds are checked by deadline
+        if (count == 0 || last - current >= slots.size()) {
+            current = (count == 0 ? last + 1 : last + 1 - slots.size());
+        }
+
+        for (; current <= last && count > 0; current++) {
+            Timer& head = slotOf(current);
+            for (Timer* timer = head.next; timer != &head;) {
+                Timer* next = timer->next;
+                if (timer->deadline <= now) {
+                    cancel(timer);
+                    expired.push_back(timer);
+                }
+                timer = next;
+            }
+        }
+        current = last + 1;
+    }
+
+    uint64_t TimerWheel::getNextTick() const {
+        if (count == 0) {
+            return (UINT64_MAX);
+        }
+
+        // the first slot holding a timer of this turn has the earliest one,
+        // otherwise they are all in later turns
+        uint64_t earliest = UINT64_MAX;
+        for (uint64_t tickNumber = current; tickNumber < current + slots.size(); tickNumber++) {
+            const Timer& head = slots[tickNumber % slots.size()];
+            for (const Timer* timer = head.next; timer != &head; timer = timer->next) {
+                uint64_t due = (timer->deadline + tick - 1) / tick;
+                if (due <= tickNumber) {
+                    return (tickNumber * tick);
+                }
+                if (due < earliest) {
+                    earliest = due;
+                }
+            }
+        }
+        return (earliest * tick);
+    }
+
+    size_t TimerWheel::size() const {
+        return (count);
+    }
+
+}
@@ -15,7 +15,10 @@ namespace asteriskcpp {
 
     boost::mutex lockLogger;
 
+    boost::atomic<int> LogHandler::threshold(LL_TRACE);
+
     LogHandler::LogHandler() {
+        threshold = LL_TRACE;
         log4cplus::BasicConfigurator::doConfigure();
         log4cplus::Logger::getRoot().setLogLevel(log4cplus::TRACE_LOG_LEVEL);
     }
@@ -31,6 +34,7 @@ namespace asteriskcpp {
 
     void LogHandler::setLevel(const LogLevel& level) {
         boost::mutex::scoped_lock lock(lockLogger);
+        threshold = level;
         switch (level) {
             case LL_TRACE:
             {
@@ -115,8 +119,25 @@ namespace asteriskcpp {
         if (confFile.empty()) {
             log4cplus::BasicConfigurator::doConfigure();
             log4cplus::Logger::getRoot().setLogLevel(log4cplus::TRACE_LOG_LEVEL);
+            threshold = LL_TRACE;
         } else {
             log4cplus::PropertyConfigurator::doConfigure(confFile);
+
+            // the lines below the level of the root logger are not built at all
+            log4cplus::LogLevel level = log4cplus::Logger::getRoot().getChainedLogLevel();
+            if (level <= log4cplus::TRACE_LOG_LEVEL) {
+                threshold = LL_TRACE;
+            } else if (level <= log4cplus::DEBUG_LOG_LEVEL) {
+                threshold = LL_DEBUG;
+            } else if (level <= log4cplus::INFO_LOG_LEVEL) {
+                threshold = LL_INFO;
+            } else if (level <= log4cplus::WARN_LOG_LEVEL) {
+                threshold = LL_WARN;
+            } else if (level <= log4cplus::ERROR_LOG_LEVEL) {
+                threshold = LL_ERROR;
+            } else {
+                threshold = LL_FATAL;
+            }
         }
     }
 
@@ -10,13 +10,21 @@
 namespace asteriskcpp {
 
     std::string search_and_replace(const std::string& str, const std::string &oldsubstr, const std::string &newsubstr) {
+        if (oldsubstr.empty()) {
+            return (str);
+        }
+        // built in one pass, replacing in place is quadratic on big responses
+        std::string tmp;
+        tmp.reserve(str.size());
+        std::string::size_type from = 0;
         std::string::size_type startidx;
-        std::string tmp(str);
-        while ((startidx = tmp.find(oldsubstr)) != std::string::npos) {
-            tmp.replace(startidx, oldsubstr.size(), newsubstr);
+        while ((startidx = str.find(oldsubstr, from)) != std::string::npos) {
+            tmp.append(str, from, startidx - from);
+            tmp.append(newsubstr);
+            from = startidx + oldsubstr.size();
         }
+        tmp.append(str, from, std::string::npos);
         return (tmp);
-
     }
 
     time_t stringToTime(const std::string& str, const std::string& format) {
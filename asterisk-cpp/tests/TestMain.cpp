@@ -0,0 +1,9 @@
+/*
+ * TestMain.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+// the whole of Boost.Test is compiled here, the other test files only declare their cases
+#define BOOST_TEST_MODULE asteriskcpp
+#include <boost/test/included/unit_test.hpp>
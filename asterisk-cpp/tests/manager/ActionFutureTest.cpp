@@ -0,0 +1,129 @@
+/*
+ * ActionFutureTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include "asteriskcpp/manager/actions/PingAction.h"
+#include "FakeServer.h"
+
+#define RESPONSE_TIMEOUT 5000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    struct Connected {
+        FakeServer server;
+        ManagerConnection connection;
+
+        Connected() {
+            BOOST_REQUIRE(server.getPort() != 0);
+            BOOST_REQUIRE(connection.connect("127.0.0.1", server.getPort()));
+            BOOST_REQUIRE(connection.login("user", "secret"));
+            // the tests answer the pings themselves, or not at all
+            server.setReply("Ping", "");
+        }
+
+        void pong(const std::string& actionId) {
+            BOOST_REQUIRE(!actionId.empty());
+            server.send("Response: Success\r\nActionID: " + actionId + "\r\nPing: Pong\r\n\r\n");
+        }
+    };
+
+    void record(std::vector<int>* calls, int call, ManagerResponse** responses, ManagerResponse* mr) {
+        responses[calls->size()] = mr;
+        calls->push_back(call);
+    }
+
+    void pingAgain(ManagerConnection* connection, bool* called, ManagerResponse* mr) {
+        *called = (mr == NULL);
+        connection->sendAction(new PingAction());
+    }
+
+    void destroy(ManagerConnection* connection) {
+        delete connection;
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ActionFutureTest)
+
+BOOST_AUTO_TEST_CASE(continuationsRunInOrder) {
+    Connected connected;
+    ActionFuture future(connected.connection.sendAction(new PingAction()));
+    BOOST_CHECK(future.isValid());
+    BOOST_CHECK(!ActionFuture().isValid());
+
+    std::vector<int> calls;
+    ManagerResponse * responses[3] = {NULL, NULL, NULL};
+    future.then(boost::bind(&record, &calls, 1, responses, _1));
+    future.then(boost::bind(&record, &calls, 2, responses, _1));
+    BOOST_CHECK(!future.wait(20));
+    BOOST_CHECK(!future.isReady());
+    BOOST_CHECK(calls.empty());
+
+    connected.pong(connected.server.waitAction("Ping", RESPONSE_TIMEOUT));
+    ManagerResponse* mr = future.get();
+    BOOST_REQUIRE(mr != NULL);
+    BOOST_CHECK(mr->isTypeSuccess());
+    BOOST_CHECK(future.isReady());
+    BOOST_REQUIRE_EQUAL(calls.size(), 2u);
+    BOOST_CHECK_EQUAL(calls[0], 1);
+    BOOST_CHECK_EQUAL(calls[1], 2);
+
+    // too late, called right away
+    future.then(boost::bind(&record, &calls, 3, responses, _1));
+    BOOST_REQUIRE_EQUAL(calls.size(), 3u);
+    BOOST_CHECK_EQUAL(calls[2], 3);
+    for (size_t i = 0; i < calls.size(); i++) {
+        BOOST_CHECK(responses[i] == mr);
+    }
+
+    // copies share the response
+    ActionFuture copy(future);
+    BOOST_CHECK(copy.get() == mr);
+}
+
+BOOST_AUTO_TEST_CASE(timeoutCompletesWithAnError) {
+    Connected connected;
+    connected.connection.setDefaultResponseTimeout(100);
+    ActionFuture future(connected.connection.sendAction(new PingAction()));
+    BOOST_REQUIRE(future.wait(RESPONSE_TIMEOUT));
+    BOOST_REQUIRE(future.get() != NULL);
+    BOOST_CHECK(!future.get()->isTypeSuccess());
+    BOOST_CHECK_EQUAL(future.get()->getGetterValue(keys::Message), "Time Out");
+}
+
+BOOST_AUTO_TEST_CASE(disconnectionCompletesWithAnError) {
+    Connected connected;
+    ActionFuture future(connected.connection.sendAction(new PingAction()));
+    BOOST_REQUIRE(!connected.server.waitAction("Ping", RESPONSE_TIMEOUT).empty());
+    connected.server.disconnect();
+    BOOST_REQUIRE(future.wait(RESPONSE_TIMEOUT));
+    BOOST_REQUIRE(future.get() != NULL);
+    BOOST_CHECK_EQUAL(future.get()->getGetterValue(keys::Message), "Disconnected");
+}
+
+BOOST_AUTO_TEST_CASE(droppedFutureMaySendActions) {
+    FakeServer server;
+    server.setReply("Ping", "");
+    ManagerConnection* connection = new ManagerConnection();
+    BOOST_REQUIRE(connection->connect("127.0.0.1", server.getPort()));
+    BOOST_REQUIRE(connection->login("user", "secret"));
+
+    // still waiting when the connection goes, its continuation runs then
+    bool called = false;
+    ActionFuture future(connection->sendAction(new PingAction()));
+    future.then(boost::bind(&pingAgain, connection, &called, _1));
+    boost::thread destroyer(boost::bind(&destroy, connection));
+    BOOST_REQUIRE(destroyer.timed_join(boost::posix_time::milliseconds(RESPONSE_TIMEOUT)));
+    BOOST_CHECK(called);
+    BOOST_CHECK(future.get() == NULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
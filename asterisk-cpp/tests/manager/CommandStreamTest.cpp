@@ -0,0 +1,115 @@
+/*
+ * CommandStreamTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include "asteriskcpp/manager/actions/CommandAction.h"
+#include "asteriskcpp/manager/actions/PingAction.h"
+#include "asteriskcpp/utils/StringUtils.h"
+#include "FakeServer.h"
+
+// more than a read of the connection, the output comes in several parts
+#define LINES 5000
+#define RESPONSE_TIMEOUT 5000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    std::string line(size_t i) {
+        return ("line " + convertToString(i) + " of output");
+    }
+
+    std::string follows(size_t count) {
+        std::string reply("Response: Follows\r\nPrivilege: Command\r\nActionID: $ActionID\r\n");
+        for (size_t i = 0; i < count; i++) {
+            reply.append(line(i) + "\n");
+        }
+        reply.append("--END COMMAND--\r\n\r\n");
+        return (reply);
+    }
+
+    struct Connected {
+        FakeServer server;
+        ManagerConnection connection;
+
+        Connected() {
+            BOOST_REQUIRE(server.getPort() != 0);
+            BOOST_REQUIRE(connection.connect("127.0.0.1", server.getPort()));
+            BOOST_REQUIRE(connection.login("user", "secret"));
+        }
+    };
+
+}
+
+BOOST_AUTO_TEST_SUITE(CommandStreamTest)
+
+BOOST_AUTO_TEST_CASE(followsOutputLineByLine) {
+    Connected connected;
+    connected.server.setReply("Command", follows(LINES));
+    CommandStreamPtr stream(connected.connection.sendStreamingCommand(new CommandAction("core show channels")));
+    BOOST_CHECK_EQUAL(stream->getCapacity(), 0u);
+
+    std::string text;
+    size_t count = 0;
+    while (stream->nextLine(text)) {
+        BOOST_REQUIRE_EQUAL(text, line(count));
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, (size_t) LINES);
+    BOOST_CHECK(stream->isSuccess());
+    BOOST_CHECK_EQUAL(stream->getReceived(), (size_t) LINES);
+}
+
+BOOST_AUTO_TEST_CASE(outputHeadersOfPlainResponses) {
+    Connected connected;
+    connected.server.setReply("Command", "Response: Success\r\nActionID: $ActionID\r\nMessage: Command output follows\r\n"
+            "Output: first\r\nOutput: second\r\n\r\n");
+    CommandStreamPtr stream(connected.connection.sendStreamingCommand(new CommandAction("core show uptime")));
+    BOOST_REQUIRE(stream->wait(RESPONSE_TIMEOUT));
+    std::string text;
+    BOOST_REQUIRE(stream->nextLine(text));
+    BOOST_CHECK_EQUAL(text, "first");
+    BOOST_REQUIRE(stream->nextLine(text));
+    BOOST_CHECK_EQUAL(text, "second");
+    BOOST_CHECK(!stream->nextLine(text));
+    BOOST_CHECK(stream->isSuccess());
+}
+
+BOOST_AUTO_TEST_CASE(overflowFailsWithoutBlocking) {
+    Connected connected;
+    connected.server.setReply("Command", follows(LINES));
+    CommandStreamPtr stream(connected.connection.sendStreamingCommand(new CommandAction("core show channels"), 10));
+
+    // nothing taken, the dispatch goes on to the next response anyway
+    PingAction ping;
+    ManagerResponse* pong = connected.connection.syncSendAction(ping, RESPONSE_TIMEOUT);
+    BOOST_REQUIRE(pong != NULL);
+    BOOST_CHECK(pong->isTypeSuccess());
+    delete pong;
+
+    BOOST_REQUIRE(stream->wait(RESPONSE_TIMEOUT));
+    BOOST_CHECK(!stream->isSuccess());
+    BOOST_CHECK_EQUAL(stream->getMessage(), "Overflow");
+    std::string text;
+    size_t count = 0;
+    while (stream->nextLine(text)) {
+        BOOST_CHECK_EQUAL(text, line(count));
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, 10u);
+}
+
+BOOST_AUTO_TEST_CASE(errorResponseFailsTheStream) {
+    Connected connected;
+    connected.server.setReply("Command", "Response: Error\r\nActionID: $ActionID\r\nMessage: Permission denied\r\n\r\n");
+    CommandStreamPtr stream(connected.connection.sendStreamingCommand(new CommandAction("core stop now")));
+    BOOST_REQUIRE(stream->wait(RESPONSE_TIMEOUT));
+    BOOST_CHECK(!stream->isSuccess());
+    BOOST_CHECK_EQUAL(stream->getMessage(), "Permission denied");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
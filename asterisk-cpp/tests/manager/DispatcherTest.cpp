@@ -0,0 +1,155 @@
+/*
+ * DispatcherTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "asteriskcpp/manager/Dispatcher.h"
+
+#define WAIT_TIMEOUT 5000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    /**
+     * Notes the frames it is given, optionally detaching itself from the
+     * first one on, from the dispatch thread.
+     */
+    class Recorder : public Dispatcher {
+    public:
+
+        Recorder(DispatchGroup* group, bool detachSelf = false) :
+        group(group), detachSelf(detachSelf), delay(0) {
+        }
+
+        void dispatchAsteriskVersion(AsteriskVersion*) {
+        }
+
+        void dispatchResponse(const SlabView& response) {
+            received(response);
+        }
+
+        void dispatchResponsePart(const SlabView&, bool) {
+        }
+
+        void dispatchEvent(const SlabView& event) {
+            received(event);
+        }
+
+        void notifyDisconnect() {
+        }
+
+        /**
+         * Waits for frame, the frames before it were dispatched.
+         */
+        bool waitFor(const std::string& frame) {
+            boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(WAIT_TIMEOUT);
+            boost::mutex::scoped_lock lock(mutex);
+            while (std::find(frames.begin(), frames.end(), frame) == frames.end()) {
+                if (!cond.timed_wait(lock, deadline)) {
+                    return (false);
+                }
+            }
+            return (true);
+        }
+
+        std::vector<std::string> getFrames() {
+            boost::mutex::scoped_lock lock(mutex);
+            return (frames);
+        }
+
+        void setDelay(unsigned int delay) {
+            this->delay = delay;
+        }
+
+    private:
+        DispatchGroup* group;
+        bool detachSelf;
+        unsigned int delay;
+        std::vector<std::string> frames;
+        boost::mutex mutex;
+        boost::condition_variable cond;
+
+        void received(const SlabView& frame) {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(delay));
+            {
+                boost::mutex::scoped_lock lock(mutex);
+                frames.push_back(frame.str());
+                cond.notify_all();
+            }
+            if (detachSelf) {
+                detachSelf = false;
+                group->detach(this);
+            }
+        }
+    };
+
+    bool waitAttached(const DispatchGroup& group, Recorder* recorder) {
+        for (int waited = 0; group.isDetached(recorder); waited++) {
+            if (waited == WAIT_TIMEOUT) {
+                return (false);
+            }
+            boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+        }
+        return (true);
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(DispatcherTest)
+
+BOOST_AUTO_TEST_CASE(detachedFromAnEventHandler) {
+    DispatchGroup group;
+    Recorder self(&group, true);
+    Recorder other(&group);
+    // keeps the thread busy while the next frames are queued
+    other.setDelay(100);
+    group.putEvent(&other, SlabView::fromString("0"));
+    group.putEvent(&self, SlabView::fromString("1"));
+    group.putEvent(&self, SlabView::fromString("2"));
+    group.putEvent(&other, SlabView::fromString("3"));
+
+    // the handler went on, the frames queued for self were dropped
+    BOOST_REQUIRE(other.waitFor("3"));
+    BOOST_REQUIRE(waitAttached(group, &self));
+    BOOST_CHECK_EQUAL(self.getFrames().size(), 1u);
+
+    // both threads went past the barrier, self can be used again
+    group.putEvent(&self, SlabView::fromString("4"));
+    BOOST_REQUIRE(self.waitFor("4"));
+    BOOST_CHECK_EQUAL(self.getFrames().size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(detachedFromAResponseHandler) {
+    DispatchGroup group;
+    Recorder self(&group, true);
+    Recorder other(&group);
+    other.setDelay(100);
+    group.putResponse(&other, SlabView::fromString("0"));
+    group.putResponse(&self, SlabView::fromString("1"));
+    group.putResponse(&self, SlabView::fromString("2"));
+    group.putResponse(&other, SlabView::fromString("3"));
+
+    BOOST_REQUIRE(other.waitFor("3"));
+    BOOST_REQUIRE(waitAttached(group, &self));
+    BOOST_CHECK_EQUAL(self.getFrames().size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(detachWaitsForTheDispatch) {
+    DispatchGroup group;
+    Recorder slow(&group);
+    slow.setDelay(100);
+    group.putEvent(&slow, SlabView::fromString("1"));
+    group.putEvent(&slow, SlabView::fromString("2"));
+    boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+
+    group.detach(&slow);
+    BOOST_CHECK(!group.isDetached(&slow));
+    BOOST_CHECK_EQUAL(slow.getFrames().size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
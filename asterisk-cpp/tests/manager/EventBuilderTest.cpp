@@ -0,0 +1,87 @@
+/*
+ * EventBuilderTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/EventBuilder.h"
+#include "asteriskcpp/manager/events/HangupEvent.h"
+
+using namespace asteriskcpp;
+
+namespace {
+
+    const char HANGUP[] = "Event: Hangup\r\nPrivilege: call,all\r\nChannel: SIP/1-0001\r\n"
+            "Uniqueid: 1000.1\r\nCause: 16\r\nCause-txt: Normal Clearing";
+    const char HANGUP2[] = "Event: Hangup\r\nChannel: SIP/2-0002\r\nUniqueid: 1000.2\r\nCause: 17";
+
+    HangupEvent* build(EventBuilder& builder, const char* frame) {
+        ManagerEvent* event = builder.buildEvent(SlabView::fromString(frame));
+        BOOST_REQUIRE(event != NULL);
+        HangupEvent* hangup = dynamic_cast<HangupEvent*> (event);
+        BOOST_REQUIRE(hangup != NULL);
+        return (hangup);
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(EventBuilderTest)
+
+BOOST_AUTO_TEST_CASE(eagerByDefault) {
+    EventBuilder builder;
+    BOOST_CHECK(!builder.isLazy());
+
+    HangupEvent* event = build(builder, HANGUP);
+    BOOST_CHECK_EQUAL(event->getEventType(), EVENT_HANGUP);
+    BOOST_CHECK_EQUAL(event->getChannel(), "SIP/1-0001");
+    BOOST_CHECK_EQUAL(event->getCause(), 16);
+    builder.releaseEvent(event);
+}
+
+BOOST_AUTO_TEST_CASE(lazyEventsReadLikeEagerOnes) {
+    EventBuilder eager;
+    EventBuilder lazy;
+    lazy.setLazy(true, true);
+    BOOST_CHECK(lazy.isLazy());
+
+    HangupEvent* expected = build(eager, HANGUP);
+    HangupEvent* event = build(lazy, HANGUP);
+    BOOST_CHECK_EQUAL(event->getEventType(), EVENT_HANGUP);
+    BOOST_CHECK_EQUAL(event->getEventName(), "Hangup");
+    BOOST_CHECK_EQUAL(event->getUniqueID(), "1000.1");
+    BOOST_CHECK_EQUAL(event->getChannel(), expected->getChannel());
+    BOOST_CHECK_EQUAL(event->getCause(), expected->getCause());
+    BOOST_CHECK_EQUAL(event->getPrivilege(), "call,all");
+    BOOST_CHECK_EQUAL(event->toString(), expected->toString());
+    eager.releaseEvent(expected);
+    lazy.releaseEvent(event);
+}
+
+BOOST_AUTO_TEST_CASE(recycledEventsForgetTheirFrame) {
+    EventBuilder builder;
+    builder.setLazy(true);
+    builder.setServer("pbx1");
+
+    HangupEvent* event = build(builder, HANGUP);
+    BOOST_CHECK_EQUAL(event->getServer(), "pbx1");
+    BOOST_CHECK_EQUAL(event->getChannel(), "SIP/1-0001");
+    builder.releaseEvent(event);
+
+    // the pooled event comes back and must only show the new frame
+    event = build(builder, HANGUP2);
+    BOOST_CHECK_EQUAL(event->getUniqueID(), "1000.2");
+    BOOST_CHECK_EQUAL(event->getChannel(), "SIP/2-0002");
+    BOOST_CHECK_EQUAL(event->getCause(), 17);
+    BOOST_CHECK_EQUAL(event->getPrivilege(), "");
+    builder.releaseEvent(event);
+}
+
+BOOST_AUTO_TEST_CASE(framesWithoutEventAreSkipped) {
+    EventBuilder builder;
+    builder.setLazy(true);
+    BOOST_CHECK(builder.buildEvent(SlabView::fromString("Response: Success\r\nActionID: 1")) == NULL);
+    BOOST_CHECK(builder.buildEvent(SlabView::fromString("Event: ")) == NULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
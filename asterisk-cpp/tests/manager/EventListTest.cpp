@@ -0,0 +1,102 @@
+/*
+ * EventListTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include "asteriskcpp/manager/actions/PingAction.h"
+#include "asteriskcpp/manager/actions/SipPeersAction.h"
+#include "asteriskcpp/manager/events/PeerEntryEvent.h"
+#include "asteriskcpp/utils/StringUtils.h"
+#include "FakeServer.h"
+
+#define PEERS 20
+#define RESPONSE_TIMEOUT 5000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    std::string peers(size_t count) {
+        std::string reply("Response: Success\r\nActionID: $ActionID\r\nEventList: start\r\n"
+                "Message: Peer status list will follow\r\n\r\n");
+        for (size_t i = 0; i < count; i++) {
+            reply.append("Event: PeerEntry\r\nActionID: $ActionID\r\nChanneltype: SIP\r\nObjectName: "
+                    + convertToString(i) + "\r\n\r\n");
+        }
+        reply.append("Event: PeerlistComplete\r\nEventList: Complete\r\nListItems: " + convertToString(count)
+                + "\r\nActionID: $ActionID\r\n\r\n");
+        return (reply);
+    }
+
+    struct Connected {
+        FakeServer server;
+        ManagerConnection connection;
+
+        Connected() {
+            BOOST_REQUIRE(server.getPort() != 0);
+            BOOST_REQUIRE(connection.connect("127.0.0.1", server.getPort()));
+            BOOST_REQUIRE(connection.login("user", "secret"));
+        }
+    };
+
+}
+
+BOOST_AUTO_TEST_SUITE(EventListTest)
+
+BOOST_AUTO_TEST_CASE(entriesUntilComplete) {
+    Connected connected;
+    connected.server.setReply("SIPpeers", peers(PEERS));
+    EventListPtr list(connected.connection.sendEventListAction(new SipPeersAction()));
+    BOOST_CHECK_EQUAL(list->getCapacity(), 0u);
+
+    std::vector<ManagerEvent*> entries(list->getAll());
+    BOOST_CHECK(list->isSuccess());
+    BOOST_REQUIRE_EQUAL(entries.size(), (size_t) PEERS);
+    for (size_t i = 0; i < entries.size(); i++) {
+        PeerEntryEvent* entry = dynamic_cast<PeerEntryEvent*> (entries[i]);
+        BOOST_REQUIRE(entry != NULL);
+        BOOST_CHECK_EQUAL(entry->getObjectName(), convertToString(i));
+        delete entry;
+    }
+    BOOST_REQUIRE(list->getCompleteEvent() != NULL);
+    BOOST_CHECK_EQUAL(list->getCompleteEvent()->getEventName(), "PeerlistComplete");
+    BOOST_CHECK(list->next() == NULL);
+}
+
+BOOST_AUTO_TEST_CASE(overflowFailsWithoutBlocking) {
+    Connected connected;
+    connected.server.setReply("SIPpeers", peers(PEERS));
+    EventListPtr list(connected.connection.sendEventListAction(new SipPeersAction(), 5));
+
+    // nothing taken, the dispatch goes on to the next response anyway
+    PingAction ping;
+    ManagerResponse* pong = connected.connection.syncSendAction(ping, RESPONSE_TIMEOUT);
+    BOOST_REQUIRE(pong != NULL);
+    BOOST_CHECK(pong->isTypeSuccess());
+    delete pong;
+
+    BOOST_REQUIRE(list->wait(RESPONSE_TIMEOUT));
+    BOOST_CHECK(!list->isSuccess());
+    BOOST_CHECK_EQUAL(list->getMessage(), "Overflow");
+    BOOST_CHECK_EQUAL(list->getReceived(), (size_t) PEERS);
+    std::vector<ManagerEvent*> entries(list->getAll());
+    BOOST_CHECK_EQUAL(entries.size(), 5u);
+    for (size_t i = 0; i < entries.size(); i++) {
+        delete entries[i];
+    }
+}
+
+BOOST_AUTO_TEST_CASE(errorResponseFailsTheList) {
+    Connected connected;
+    connected.server.setReply("SIPpeers", "Response: Error\r\nActionID: $ActionID\r\nMessage: Permission denied\r\n\r\n");
+    EventListPtr list(connected.connection.sendEventListAction(new SipPeersAction()));
+    BOOST_REQUIRE(list->wait(RESPONSE_TIMEOUT));
+    BOOST_CHECK(!list->isSuccess());
+    BOOST_CHECK_EQUAL(list->getMessage(), "Permission denied");
+    BOOST_CHECK(list->next() == NULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
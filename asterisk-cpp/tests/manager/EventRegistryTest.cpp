@@ -0,0 +1,51 @@
+/*
+ * EventRegistryTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/algorithm/string/case_conv.hpp>
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/EventRegistry.h"
+
+using namespace asteriskcpp;
+
+namespace {
+
+    const EventDescriptor* find(const std::string& name) {
+        return (EventRegistry::find(name.data(), name.size()));
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(EventRegistryTest)
+
+BOOST_AUTO_TEST_CASE(everyNameFound) {
+    for (int type = 1; type < EVENT_TYPE_COUNT; type++) {
+        const std::string& name = EventRegistry::getName((EventType) type);
+        BOOST_REQUIRE(!name.empty());
+
+        const EventDescriptor* descriptor = find(name);
+        BOOST_REQUIRE_MESSAGE(descriptor != NULL, name << " not found");
+        BOOST_CHECK_EQUAL(descriptor->type, type);
+        BOOST_CHECK_EQUAL(descriptor, &EventRegistry::get((EventType) type));
+        BOOST_CHECK(descriptor->create != NULL);
+
+        // AMI does not always agree on the case
+        BOOST_CHECK_EQUAL(find(boost::to_lower_copy(name)), descriptor);
+        BOOST_CHECK_EQUAL(find(boost::to_upper_copy(name)), descriptor);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(unknownNames) {
+    BOOST_CHECK(find("") == NULL);
+    BOOST_CHECK(find("NoSuchEvent") == NULL);
+    // near misses of a known name must fail the compare after the probe
+    BOOST_CHECK(find("Newchan") == NULL);
+    BOOST_CHECK(find("NewchannelX") == NULL);
+    BOOST_CHECK(find("Newchannes") == NULL);
+    BOOST_CHECK(find(std::string("Newchannel", 11)) == NULL);
+    BOOST_CHECK(EventRegistry::find("NewchannelX", 10) != NULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+/*
+ * EventSubscriptionsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/EventSubscriptions.h"
+#include "asteriskcpp/manager/events/DtmfEvent.h"
+#include "asteriskcpp/manager/events/HangupEvent.h"
+#include "asteriskcpp/exceptions/Exception.h"
+
+using namespace asteriskcpp;
+
+namespace {
+
+    const char HANGUP_SIP[] = "Event: Hangup\r\nChannel: SIP/100-0001\r\nUniqueid: 1000.1\r\nCause: 16\r\n";
+    const char HANGUP_IAX[] = "Event: Hangup\r\nChannel: IAX2/100-0002\r\nUniqueid: 1000.2\r\nCause: 16\r\n";
+    const char DTMF[] = "Event: DTMF\r\nChannel: SIP/100-0001\r\nDigit: 5\r\n";
+
+    class NullListener : public ManagerEventListener {
+    public:
+
+        void onManagerEvent(const ManagerEvent&) {
+        }
+    };
+
+    /**
+     * Applies the filters as Asterisk does: an event passes if a filter
+     * matches anywhere in its text.
+     */
+    bool passes(const std::vector<std::string>& filters, const std::string& text) {
+        for (std::vector<std::string>::const_iterator it = filters.begin(); it != filters.end(); ++it) {
+            if (boost::regex_search(text, boost::regex(*it, boost::regex::extended))) {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(EventSubscriptionsTest)
+
+BOOST_AUTO_TEST_CASE(noSubscriptionTurnsEventsOff) {
+    EventSubscriptions subscriptions;
+    BOOST_CHECK_EQUAL(subscriptions.getEventMask(), "off");
+    BOOST_CHECK(subscriptions.getFilters().empty());
+}
+
+BOOST_AUTO_TEST_CASE(maskListsTheSubscribedCategories) {
+    EventSubscriptions subscriptions;
+    NullListener calls, dtmf;
+    subscriptions.subscribe(&calls, EVENT_HANGUP);
+    subscriptions.subscribe(&dtmf, EVENT_DTMF);
+    BOOST_CHECK_EQUAL(subscriptions.getEventMask(), "call,dtmf");
+    BOOST_CHECK_EQUAL(EventSubscriptions::getCategoryNames(CATEGORY_SYSTEM | CATEGORY_AGI), "system,agi");
+
+    // one listener wanting everything needs every event
+    NullListener all;
+    subscriptions.subscribeAll(&all);
+    BOOST_CHECK_EQUAL(subscriptions.getEventMask(), "on");
+    BOOST_CHECK(subscriptions.getFilters().empty());
+
+    subscriptions.unsubscribe(&all);
+    BOOST_CHECK_EQUAL(subscriptions.getEventMask(), "call,dtmf");
+}
+
+BOOST_AUTO_TEST_CASE(filtersLetThroughTheSubscribedEventsOnly) {
+    EventSubscriptions subscriptions;
+    NullListener listener;
+    subscriptions.subscribe(&listener, EVENT_HANGUP, "Channel", "SIP/");
+    subscriptions.subscribe(&listener, EVENT_DTMF);
+    subscriptions.subscribe(&listener, EVENT_DTMF);
+
+    std::vector<std::string> filters(subscriptions.getFilters());
+    BOOST_CHECK_EQUAL(filters.size(), 2u);
+    BOOST_CHECK(passes(filters, HANGUP_SIP));
+    BOOST_CHECK(!passes(filters, HANGUP_IAX));
+    BOOST_CHECK(passes(filters, DTMF));
+    BOOST_CHECK(passes(filters, "EVENT: hangup\r\nCHANNEL: SIP/200-0003\r\n"));
+    BOOST_CHECK(!passes(filters, "Event: HangupRequest\r\nChannel: SIP/100-0001\r\n"));
+    BOOST_CHECK(!passes(filters, "Event: Newchannel\r\nChannel: SIP/100-0001\r\n"));
+}
+
+BOOST_AUTO_TEST_CASE(eventsMatchedPerListener) {
+    EventSubscriptions subscriptions;
+    NullListener sip, dtmf, unknown;
+    subscriptions.subscribe(&sip, EVENT_HANGUP, "Channel", "SIP/");
+    subscriptions.subscribe(&dtmf, EVENT_DTMF);
+
+    HangupEvent hangupSip(HANGUP_SIP);
+    HangupEvent hangupIax(HANGUP_IAX);
+    DtmfEvent digit(DTMF);
+    BOOST_CHECK(subscriptions.accepts(&sip, hangupSip));
+    BOOST_CHECK(!subscriptions.accepts(&sip, hangupIax));
+    BOOST_CHECK(!subscriptions.accepts(&sip, digit));
+    BOOST_CHECK(subscriptions.accepts(&dtmf, digit));
+    BOOST_CHECK(!subscriptions.accepts(&dtmf, hangupSip));
+    // listeners without subscriptions get everything
+    BOOST_CHECK(subscriptions.accepts(&unknown, hangupIax));
+}
+
+BOOST_AUTO_TEST_CASE(snapshotsAreNotChanged) {
+    EventSubscriptions subscriptions;
+    NullListener listener;
+    subscriptions.subscribe(&listener, EVENT_DTMF);
+    EventSubscriptions::Snapshot before(subscriptions.getSnapshot());
+    subscriptions.subscribe(&listener, EVENT_HANGUP);
+
+    HangupEvent hangup(HANGUP_SIP);
+    BOOST_CHECK(!EventSubscriptions::accepts(before, &listener, hangup));
+    BOOST_CHECK(EventSubscriptions::accepts(subscriptions.getSnapshot(), &listener, hangup));
+}
+
+BOOST_AUTO_TEST_CASE(invalidPatternRejected) {
+    EventSubscriptions subscriptions;
+    NullListener listener;
+    BOOST_CHECK_THROW(subscriptions.subscribe(&listener, EVENT_HANGUP, "Channel", "SIP/("), Exception);
+    BOOST_CHECK_EQUAL(subscriptions.getEventMask(), "off");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/*
+ * FakeServer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "FakeServer.h"
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/algorithm/string/case_conv.hpp>
+
+#define BANNER "Asterisk Call Manager/1.1\r\n"
+#define DEFAULT_REPLY "Response: Success\r\nActionID: $ActionID\r\n\r\n"
+#define ACTION_ID_TAG "$ActionID"
+
+namespace asteriskcpp {
+
+    namespace {
+
+        /**
+         * Returns the value of header in frame, empty if it is not there.
+         */
+        std::string header(const std::string& frame, const char* header) {
+            size_t length = strlen(header);
+            for (size_t start = 0; start < frame.length();) {
+                size_t end = frame.find("\r\n", start);
+                if (end == std::string::npos) {
+                    end = frame.length();
+                }
+                if (end - start > length + 1 && strncasecmp(frame.data() + start, header, length) == 0 && frame[start + length] == ':') {
+                    size_t value = frame.find_first_not_of(' ', start + length + 1);
+                    return (value < end ? frame.substr(value, end - value) : std::string());
+                }
+                start = end + 2;
+            }
+            return (std::string());
+        }
+
+    }
+
+    FakeServer::FakeServer() :
+    listener(-1), client(-1), port(0) {
+        listener = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof (address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof (address);
+        if (listener != -1 && bind(listener, (struct sockaddr*) &address, length) == 0 && listen(listener, 1) == 0
+                && getsockname(listener, (struct sockaddr*) &address, &length) == 0) {
+            port = ntohs(address.sin_port);
+            thread = boost::thread(boost::bind(&FakeServer::run, this));
+        }
+    }
+
+    FakeServer::~FakeServer() {
+        // wakes up accept and recv
+        shutdown(listener, SHUT_RDWR);
+        disconnect();
+        if (thread.joinable()) {
+            thread.join();
+        }
+        close(listener);
+    }
+
+    unsigned short FakeServer::getPort() const {
+        return (port);
+    }
+
+    void FakeServer::setReply(const std::string& action, const std::string& reply) {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        replies[boost::algorithm::to_lower_copy(action)] = reply;
+    }
+
+    void FakeServer::send(const std::string& data) {
+        boost::lock_guard<boost::mutex> lock(sendMutex);
+        for (size_t sent = 0; client != -1 && sent < data.length();) {
+            ssize_t written = ::send(client, data.data() + sent, data.length() - sent, MSG_NOSIGNAL);
+            if (written <= 0) {
+                break;
+            }
+            sent += written;
+        }
+    }
+
+    void FakeServer::disconnect() {
+        boost::lock_guard<boost::mutex> lock(sendMutex);
+        if (client != -1) {
+            shutdown(client, SHUT_RDWR);
+        }
+    }
+
+    std::string FakeServer::waitAction(const std::string& action, unsigned int timeout) {
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(timeout);
+        std::string name(boost::algorithm::to_lower_copy(action));
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+        for (;;) {
+            while (!actions.empty()) {
+                std::pair<std::string, std::string> received(actions.front());
+                actions.erase(actions.begin());
+                if (received.first == name) {
+                    return (received.second);
+                }
+            }
+            if (!m_cond.timed_wait(lock, deadline)) {
+                return (std::string());
+            }
+        }
+    }
+
+    void FakeServer::run() {
+        for (;;) {
+            int fd = accept(listener, NULL, NULL);
+            if (fd == -1) {
+                return;
+            }
+            {
+                boost::lock_guard<boost::mutex> lock(sendMutex);
+                client = fd;
+            }
+            send(BANNER);
+            serve(fd);
+            {
+                boost::lock_guard<boost::mutex> lock(sendMutex);
+                client = -1;
+            }
+            close(fd);
+        }
+    }
+
+    void FakeServer::serve(int fd) {
+        std::string received;
+        char buffer[4096];
+        for (;;) {
+            ssize_t length = recv(fd, buffer, sizeof (buffer), 0);
+            if (length <= 0) {
+                return;
+            }
+            received.append(buffer, length);
+            size_t end;
+            while ((end = received.find("\r\n\r\n")) != std::string::npos) {
+                answer(received.substr(0, end));
+                received.erase(0, end + 4);
+            }
+        }
+    }
+
+    void FakeServer::answer(const std::string& frame) {
+        std::string name(boost::algorithm::to_lower_copy(header(frame, "Action")));
+        std::string actionId(header(frame, "ActionID"));
+        std::string reply(DEFAULT_REPLY);
+        {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            std::map<std::string, std::string>::const_iterator it = replies.find(name);
+            if (it != replies.end()) {
+                reply = it->second;
+            }
+            actions.push_back(std::make_pair(name, actionId));
+            m_cond.notify_all();
+        }
+
+        for (size_t tag = reply.find(ACTION_ID_TAG); tag != std::string::npos; tag = reply.find(ACTION_ID_TAG, tag + actionId.length())) {
+            reply.replace(tag, strlen(ACTION_ID_TAG), actionId);
+        }
+        send(reply);
+    }
+
+}
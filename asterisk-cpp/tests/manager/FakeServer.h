@@ -0,0 +1,78 @@
+/*
+ * FakeServer.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef FAKESERVER_H_
+#define FAKESERVER_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace asteriskcpp {
+
+    /**
+     * Asterisk manager on a loopback port, for the connection tests.<p>
+     * It serves one client at a time: the banner, then every action is
+     * answered with its reply, by default a Success response. In a reply
+     * $ActionID stands for the ActionID of the action, an empty reply
+     * leaves the action unanswered.
+     */
+    class FakeServer {
+    public:
+        FakeServer();
+        ~FakeServer();
+
+        unsigned short getPort() const;
+
+        /**
+         * Sets the reply of the actions named action, case insensitive.
+         */
+        void setReply(const std::string& action, const std::string& reply);
+
+        /**
+         * Sends data to the client, i.e. events.
+         */
+        void send(const std::string& data);
+
+        /**
+         * Closes the connection of the client.
+         */
+        void disconnect();
+
+        /**
+         * Waits at most timeout milliseconds for an action named action, the
+         * actions before it are skipped.
+         * @return its ActionID, empty if none came.
+         */
+        std::string waitAction(const std::string& action, unsigned int timeout);
+
+    private:
+        int listener;
+        int client;
+        unsigned short port;
+        std::map<std::string, std::string> replies;
+        // name and ActionID of the actions received and not waited for yet
+        std::vector<std::pair<std::string, std::string> > actions;
+        boost::mutex m_mutex;
+        boost::condition_variable m_cond;
+        boost::mutex sendMutex;
+        boost::thread thread;
+
+        void run();
+        void serve(int fd);
+        void answer(const std::string& frame);
+
+        FakeServer(const FakeServer&);
+        FakeServer& operator=(const FakeServer&);
+    };
+
+}
+
+#endif /* FAKESERVER_H_ */
@@ -0,0 +1,155 @@
+/*
+ * FramerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <string.h>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/Framer.h"
+
+#define SLAB_SIZE 256
+
+using namespace asteriskcpp;
+
+namespace {
+
+    struct Frame {
+        Framer::FrameType type;
+        SlabView view;
+    };
+
+    /**
+     * Feeds data to framer at most chunk bytes per read, as the Reader does,
+     * and appends the frames cut out. The views are kept, the slabs they
+     * are on must not be written again.
+     */
+    void feed(Framer& framer, const std::string& data, size_t chunk, std::vector<Frame>& frames) {
+        for (size_t pos = 0; pos < data.size();) {
+            char* buffer = framer.writePtr();
+            size_t length = std::min(std::min(chunk, framer.writeCapacity()), data.size() - pos);
+            memcpy(buffer, data.data() + pos, length);
+            framer.commit(length);
+            pos += length;
+
+            Frame frame;
+            while (framer.next(frame.view, frame.type)) {
+                frames.push_back(frame);
+            }
+        }
+    }
+
+    std::string event(int i) {
+        std::ostringstream out;
+        out << "Event: Newchannel\r\nChannel: SIP/" << i << "-0001\r\nUniqueid: 1000." << i << "\r\n";
+        return (out.str());
+    }
+
+    std::string output(int lines) {
+        std::ostringstream out;
+        for (int i = 0; i < lines; i++) {
+            out << "line " << i << " of output\n";
+        }
+        return (out.str());
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(FramerTest)
+
+BOOST_AUTO_TEST_CASE(framesOfEveryType) {
+    Framer framer(SLAB_SIZE);
+    std::vector<Frame> frames;
+    feed(framer, "Asterisk Call Manager/1.1\r\nResponse: Success\r\nActionID: 1\r\n\r\n"
+            "Event: FullyBooted\r\n\r\n\r\nSomething: else\r\n\r\n", 1024, frames);
+
+    BOOST_REQUIRE_EQUAL(frames.size(), 4u);
+    BOOST_CHECK_EQUAL(frames[0].type, Framer::FRAME_PROTOCOL);
+    BOOST_CHECK_EQUAL(frames[0].view.str(), "Asterisk Call Manager/1.1");
+    BOOST_CHECK_EQUAL(frames[1].type, Framer::FRAME_RESPONSE);
+    BOOST_CHECK_EQUAL(frames[1].view.str(), "Response: Success\r\nActionID: 1");
+    BOOST_CHECK_EQUAL(frames[2].type, Framer::FRAME_EVENT);
+    BOOST_CHECK_EQUAL(frames[2].view.str(), "Event: FullyBooted");
+    BOOST_CHECK_EQUAL(frames[3].type, Framer::FRAME_UNKNOWN);
+}
+
+BOOST_AUTO_TEST_CASE(framesAcrossReadsAndSlabs) {
+    std::string data;
+    for (int i = 0; i < 200; i++) {
+        data += event(i) + "\r\n";
+    }
+
+    // byte by byte, odd sizes and whole slabs: delimiters and frames straddle reads and slabs
+    size_t chunks[] = { 1, 7, 61, SLAB_SIZE };
+    for (size_t c = 0; c < sizeof (chunks) / sizeof (chunks[0]); c++) {
+        Framer framer(SLAB_SIZE, 2);
+        std::vector<Frame> frames;
+        feed(framer, data, chunks[c], frames);
+
+        BOOST_REQUIRE_EQUAL(frames.size(), 200u);
+        for (int i = 0; i < 200; i++) {
+            BOOST_CHECK_EQUAL(frames[i].type, Framer::FRAME_EVENT);
+            BOOST_CHECK_EQUAL(frames[i].view.str() + "\r\n", event(i));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(frameBiggerThanASlab) {
+    std::string big("Event: VarSet\r\nValue: ");
+    big.append(5 * SLAB_SIZE, 'x');
+    Framer framer(SLAB_SIZE);
+    std::vector<Frame> frames;
+    feed(framer, event(1) + "\r\n" + big + "\r\n\r\n" + event(2) + "\r\n", 100, frames);
+
+    BOOST_REQUIRE_EQUAL(frames.size(), 3u);
+    BOOST_CHECK_EQUAL(frames[0].view.str() + "\r\n", event(1));
+    BOOST_CHECK_EQUAL(frames[1].view.str(), big);
+    BOOST_CHECK_EQUAL(frames[2].view.str() + "\r\n", event(2));
+}
+
+BOOST_AUTO_TEST_CASE(followsInParts) {
+    std::string header("Response: Follows\r\nPrivilege: Command\r\nActionID: 9\r\n");
+    std::string body(output(200));
+    Framer framer(SLAB_SIZE);
+    std::vector<Frame> frames;
+    feed(framer, header + body + "--END COMMAND--\r\n\r\n" + event(3) + "\r\n", 50, frames);
+
+    // whole lines, then the end of the output, then the event after it
+    BOOST_REQUIRE_GT(frames.size(), 3u);
+    std::string whole;
+    for (size_t i = 0; i + 2 < frames.size(); i++) {
+        BOOST_CHECK_EQUAL(frames[i].type, Framer::FRAME_FOLLOWS_PART);
+        BOOST_CHECK_EQUAL(frames[i].view.data()[frames[i].view.length() - 1], '\n');
+        BOOST_CHECK_LE(frames[i].view.length(), (size_t) SLAB_SIZE);
+        whole += frames[i].view.str();
+    }
+    const Frame& last = frames[frames.size() - 2];
+    BOOST_CHECK_EQUAL(last.type, Framer::FRAME_FOLLOWS);
+    whole += last.view.str();
+    // the new line before --END COMMAND-- is part of the delimiter
+    BOOST_CHECK_EQUAL(whole, header + body.substr(0, body.size() - 1));
+
+    BOOST_CHECK_EQUAL(frames.back().type, Framer::FRAME_EVENT);
+    BOOST_CHECK_EQUAL(frames.back().view.str() + "\r\n", event(3));
+}
+
+BOOST_AUTO_TEST_CASE(smallFollowsInOneFrame) {
+    Framer framer(SLAB_SIZE);
+    std::vector<Frame> frames;
+    feed(framer, "Response: Follows\r\nActionID: 2\r\nNo such command\n--END COMMAND--\r\n\r\n", 3, frames);
+
+    BOOST_REQUIRE_EQUAL(frames.size(), 1u);
+    BOOST_CHECK_EQUAL(frames[0].type, Framer::FRAME_FOLLOWS);
+    BOOST_CHECK_EQUAL(frames[0].view.str(), "Response: Follows\r\nActionID: 2\r\nNo such command");
+}
+
+BOOST_AUTO_TEST_CASE(header) {
+    SlabView frame = SlabView::fromString("Response: Success\r\nActionID: 42\r\nMessage:   Pong\r\nEmpty:");
+    BOOST_CHECK_EQUAL(Framer::header(frame, "actionid").str(), "42");
+    BOOST_CHECK_EQUAL(Framer::header(frame, "Message").str(), "Pong");
+    BOOST_CHECK(Framer::header(frame, "Empty").empty());
+    BOOST_CHECK(Framer::header(frame, "Action").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+/*
+ * ManagerConnectionTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "asteriskcpp/manager/ManagerConnection.h"
+#include "asteriskcpp/manager/actions/PingAction.h"
+#include "FakeServer.h"
+
+#define WAIT_TIMEOUT 5000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    /**
+     * Disconnects its connection on the first event.
+     */
+    class Disconnecting : public ManagerEventListener {
+    public:
+
+        Disconnecting(ManagerConnection* connection) :
+        connection(connection), events(0), disconnected(false) {
+        }
+
+        void onManagerEvent(const ManagerEvent&) {
+            if (events++ == 0) {
+                connection->disconnect();
+                boost::mutex::scoped_lock lock(mutex);
+                disconnected = true;
+                cond.notify_all();
+            }
+        }
+
+        /**
+         * Waits for disconnect to return, the connection may not be used
+         * from two threads at once.
+         */
+        bool waitDisconnected() {
+            boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(WAIT_TIMEOUT);
+            boost::mutex::scoped_lock lock(mutex);
+            while (!disconnected) {
+                if (!cond.timed_wait(lock, deadline)) {
+                    return (false);
+                }
+            }
+            return (true);
+        }
+
+    private:
+        ManagerConnection* connection;
+        int events;
+        bool disconnected;
+        boost::mutex mutex;
+        boost::condition_variable cond;
+    };
+
+    void disconnect(ManagerConnection* connection, ManagerResponse*) {
+        connection->disconnect();
+    }
+
+    void login(ManagerConnection& connection, const FakeServer& server) {
+        BOOST_REQUIRE(connection.connect("127.0.0.1", server.getPort()));
+        BOOST_REQUIRE(connection.login("user", "secret"));
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(ManagerConnectionTest)
+
+BOOST_AUTO_TEST_CASE(closedFromAnEventListener) {
+    FakeServer server;
+    ManagerConnection connection;
+    Disconnecting listener(&connection);
+    connection.addEventListener(listener);
+    login(connection, server);
+
+    server.send("Event: PeerStatus\r\nPeer: SIP/1\r\nPeerStatus: Reachable\r\n\r\n"
+            "Event: PeerStatus\r\nPeer: SIP/2\r\nPeerStatus: Reachable\r\n\r\n");
+    BOOST_REQUIRE(listener.waitDisconnected());
+    BOOST_CHECK_EQUAL(connection.getState(), ManagerConnection::DISCONNECTED);
+
+    // and it can be used again
+    login(connection, server);
+    PingAction ping;
+    ManagerResponse* pong = connection.syncSendAction(ping, WAIT_TIMEOUT);
+    BOOST_REQUIRE(pong != NULL);
+    BOOST_CHECK(pong->isTypeSuccess());
+    delete pong;
+}
+
+BOOST_AUTO_TEST_CASE(closedFromAResponseCallback) {
+    FakeServer server;
+    ManagerConnection connection;
+    login(connection, server);
+
+    // ready once the continuations ran
+    ActionFuture future(connection.sendAction(new PingAction()));
+    future.then(boost::bind(&disconnect, &connection, _1));
+    BOOST_REQUIRE(future.wait(WAIT_TIMEOUT));
+    BOOST_CHECK_EQUAL(connection.getState(), ManagerConnection::DISCONNECTED);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
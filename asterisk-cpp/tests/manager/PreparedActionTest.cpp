@@ -0,0 +1,93 @@
+/*
+ * PreparedActionTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/actions/PreparedAction.h"
+#include "asteriskcpp/manager/actions/SetVarAction.h"
+#include "asteriskcpp/exceptions/Exception.h"
+
+using namespace asteriskcpp;
+
+namespace {
+
+    ActionTemplatePtr setVarTemplate(const char* const* parameters, size_t count) {
+        return (ActionTemplatePtr(new ActionTemplate(new SetVarAction("SIP/1-0001", "foo", "bar"),
+                std::vector<std::string>(parameters, parameters + count))));
+    }
+
+    std::string serialized(const ManagerAction& action) {
+        std::string text;
+        action.serialize(text);
+        return (text);
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(PreparedActionTest)
+
+BOOST_AUTO_TEST_CASE(sentAsTheActionItStandsFor) {
+    const char* const parameters[] = {"Channel", "Value"};
+    ActionTemplatePtr actionTemplate(setVarTemplate(parameters, 2));
+    BOOST_CHECK_EQUAL(actionTemplate->getAction(), "SetVar");
+    BOOST_CHECK_EQUAL(actionTemplate->getParameterCount(), 2u);
+
+    PreparedAction prepared(actionTemplate);
+    prepared.generateID("", 42);
+    prepared.setParameter("channel", "SIP/2-0002");
+    prepared.setParameter(1, "baz");
+
+    SetVarAction expected("SIP/2-0002", "foo", "baz");
+    expected.generateID("", 42);
+    BOOST_CHECK_EQUAL(serialized(prepared), serialized(expected));
+    BOOST_CHECK_EQUAL(prepared.getAction(), "SetVar");
+
+    // the slots are filled again on every send
+    prepared.generateID("", 43);
+    prepared.setParameter("Value", "");
+    expected.generateID("", 43);
+    expected.setValue("");
+    BOOST_CHECK_EQUAL(serialized(prepared), serialized(expected));
+}
+
+BOOST_AUTO_TEST_CASE(parametersStartWithThePrototypeValues) {
+    const char* const parameters[] = {"Channel", "Value"};
+    ActionTemplatePtr actionTemplate(setVarTemplate(parameters, 2));
+    PreparedAction first(actionTemplate);
+    PreparedAction second(actionTemplate);
+    first.setParameter("Value", "changed");
+    BOOST_CHECK_EQUAL(first.getParameter("Value"), "changed");
+    BOOST_CHECK_EQUAL(second.getParameter("Value"), "bar");
+    BOOST_CHECK_EQUAL(second.getParameter(0), "SIP/1-0001");
+}
+
+BOOST_AUTO_TEST_CASE(addedParametersSentWhenSet) {
+    const char* const parameters[] = {"Value", "Extra"};
+    ActionTemplatePtr actionTemplate(setVarTemplate(parameters, 2));
+    PreparedAction prepared(actionTemplate);
+    prepared.generateID("", 7);
+    BOOST_CHECK_EQUAL(prepared.getParameter("Extra"), "");
+    std::string text(serialized(prepared));
+    BOOST_CHECK_EQUAL(text.find("Extra"), std::string::npos);
+    BOOST_CHECK_EQUAL(text.compare(text.length() - 4, 4, "\r\n\r\n"), 0);
+
+    prepared.setParameter("Extra", "x");
+    text = serialized(prepared);
+    BOOST_CHECK_EQUAL(text.compare(text.length() - 12, 12, "Extra: x\r\n\r\n"), 0);
+    BOOST_CHECK_NE(text.find("ActionID: 7\r\n"), std::string::npos);
+    BOOST_CHECK_NE(text.find("Value: bar\r\n"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(unknownParametersRejected) {
+    const char* const parameters[] = {"Value"};
+    ActionTemplatePtr actionTemplate(setVarTemplate(parameters, 1));
+    PreparedAction prepared(actionTemplate);
+    BOOST_CHECK_EQUAL(actionTemplate->getParameterIndex("Channel"), 1u);
+    BOOST_CHECK_THROW(prepared.setParameter("Channel", "SIP/2-0002"), Exception);
+    BOOST_CHECK_THROW(prepared.getParameter(1), Exception);
+    BOOST_CHECK_THROW(actionTemplate->getParameterName(1), Exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,60 @@
+/*
+ * PropertyKeysTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/manager/PropertyKeys.h"
+#include "asteriskcpp/manager/actions/AtxferAction.h"
+#include "asteriskcpp/manager/events/MessageWaitingEvent.h"
+#include "asteriskcpp/manager/responses/MailboxCountResponse.h"
+
+using namespace asteriskcpp;
+
+BOOST_AUTO_TEST_SUITE(PropertyKeysTest)
+
+BOOST_AUTO_TEST_CASE(hashedAtCompileTimeAsAtRunTime) {
+    static_assert(keys::Channel.hash != keys::Context.hash, "keys are hashed at compile time");
+    BOOST_CHECK_EQUAL(keys::Channel.hash, PropertyMap::hashKey("Channel", 7));
+    BOOST_CHECK_EQUAL(keys::Channel.hash, PropertyMap::hashKey("CHANNEL", 7));
+    BOOST_CHECK_EQUAL(keys::UniqueId.hash, PropertyMap::hashKey("uniqueid", 8));
+    BOOST_CHECK_EQUAL(keys::Message.length, 7u);
+}
+
+BOOST_AUTO_TEST_CASE(typedEventGetters) {
+    MessageWaitingEvent event("Event: MessageWaiting\r\nmailbox: 100@default\r\nWaiting: 1\r\nNEW: 2\r\nOld: 3\r\n");
+    BOOST_CHECK_EQUAL(event.getMailbox(), "100@default");
+    BOOST_CHECK_EQUAL(event.getWaiting(), 1);
+    BOOST_CHECK_EQUAL(event.getNew(), 2);
+    BOOST_CHECK_EQUAL(event.getOld(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(typedResponseGetters) {
+    MailboxCountResponse response("Response: Success\r\nActionID: 7\r\nMessage: Mailbox Message Count\r\n"
+            "Mailbox: 100@default\r\nNewMessages: 4\r\nOldMessages: 5\r\n");
+    BOOST_CHECK_EQUAL(response.getMailbox(), "100@default");
+    BOOST_CHECK_EQUAL(response.getNewMessages(), 4);
+    BOOST_CHECK_EQUAL(response.getOldMessages(), 5);
+    BOOST_CHECK_EQUAL(response.getGetterValue(keys::Message), "Mailbox Message Count");
+}
+
+BOOST_AUTO_TEST_CASE(typedActionSetters) {
+    AtxferAction action("200", 1);
+    action.setChannel("SIP/100-0001");
+    action.setContext("default");
+    action.setPriority(2);
+    BOOST_CHECK_EQUAL(action.getChannel(), "SIP/100-0001");
+    BOOST_CHECK_EQUAL(action.getExten(), "200");
+    BOOST_CHECK_EQUAL(action.getPriority(), 2);
+
+    std::string text;
+    action.serialize(text);
+    BOOST_CHECK_NE(text.find("Channel: SIP/100-0001\r\n"), std::string::npos);
+    BOOST_CHECK_NE(text.find("Context: default\r\n"), std::string::npos);
+    BOOST_CHECK_NE(text.find("Exten: 200\r\n"), std::string::npos);
+    BOOST_CHECK_NE(text.find("Priority: 2\r\n"), std::string::npos);
+    BOOST_CHECK_EQUAL(text.find("Priority: 1"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
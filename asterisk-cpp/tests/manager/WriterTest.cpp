@@ -0,0 +1,172 @@
+/*
+ * WriterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "asteriskcpp/manager/Writer.h"
+
+// more than the loopback socket buffers hold, the writer thread blocks on it
+#define STUCK_SIZE (8 * 1024 * 1024)
+#define SOCKET_BUFFER 65536
+#define FLUSH_TIMEOUT 10000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    /**
+     * A Writer on one end of a loopback connection, the other end is read
+     * by the test.
+     */
+    class Connection {
+    public:
+
+        Connection() :
+        socket(NULL), peer(-1) {
+            int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+            BOOST_REQUIRE(listener != -1);
+            int size = SOCKET_BUFFER;
+            setsockopt(listener, SOL_SOCKET, SO_RCVBUF, &size, sizeof (size));
+            struct sockaddr_in address;
+            memset(&address, 0, sizeof (address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t length = sizeof (address);
+            BOOST_REQUIRE(bind(listener, (struct sockaddr*) &address, length) == 0);
+            BOOST_REQUIRE(listen(listener, 1) == 0);
+            BOOST_REQUIRE(getsockname(listener, (struct sockaddr*) &address, &length) == 0);
+
+            socket = new TCPSocket(IPAddress("127.0.0.1", ntohs(address.sin_port)));
+            setsockopt(socket->getSocketFD(), SOL_SOCKET, SO_SNDBUF, &size, sizeof (size));
+            peer = accept(listener, NULL, NULL);
+            close(listener);
+            BOOST_REQUIRE(peer != -1);
+            writer.start(socket);
+        }
+
+        ~Connection() {
+            writer.stop();
+            delete socket;
+            close(peer);
+        }
+
+        /**
+         * Queues a write the thread stays blocked on until the peer reads.
+         */
+        void stall() {
+            BOOST_REQUIRE(writer.write(std::string(STUCK_SIZE, 'x')));
+            while (writer.getQueueDepth() > 0) {
+                boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+            }
+        }
+
+        /**
+         * Reads everything written, the stalling write first.
+         */
+        std::string drain(size_t length) {
+            std::string data;
+            char buffer[SOCKET_BUFFER];
+            while (data.length() < STUCK_SIZE + length) {
+                ssize_t received = recv(peer, buffer, sizeof (buffer), 0);
+                BOOST_REQUIRE(received > 0);
+                data.append(buffer, received);
+            }
+            BOOST_REQUIRE(writer.flush(FLUSH_TIMEOUT));
+            BOOST_CHECK_EQUAL(data.find_first_not_of('x'), (size_t) STUCK_SIZE);
+            return (data.substr(STUCK_SIZE));
+        }
+
+        Writer writer;
+
+    private:
+        TCPSocket* socket;
+        int peer;
+    };
+
+    void blockedWrite(Writer* writer, const std::string* data, bool* written) {
+        *written = writer->write(*data);
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(WriterTest)
+
+BOOST_AUTO_TEST_CASE(failFastRefusesWhenFull) {
+    Connection connection;
+    connection.writer.setCapacity(2);
+    connection.writer.setOverflowMode(Writer::FAIL_FAST);
+    connection.stall();
+
+    BOOST_CHECK(connection.writer.write("a"));
+    BOOST_CHECK(connection.writer.write("b"));
+    BOOST_CHECK(!connection.writer.write("c"));
+    std::vector<std::string> pair(2, "d");
+    BOOST_CHECK(!connection.writer.write(pair));
+    BOOST_CHECK_EQUAL(connection.writer.getQueueDepth(), 2u);
+    BOOST_CHECK_EQUAL(connection.drain(2), "ab");
+
+    BOOST_CHECK(connection.writer.write(pair));
+    BOOST_CHECK(connection.writer.flush(FLUSH_TIMEOUT));
+}
+
+BOOST_AUTO_TEST_CASE(dropOldestKeepsTheLatest) {
+    Connection connection;
+    connection.writer.setCapacity(2);
+    connection.writer.setOverflowMode(Writer::DROP_OLDEST);
+    connection.stall();
+
+    BOOST_CHECK(connection.writer.write("a"));
+    BOOST_CHECK(connection.writer.write("b"));
+    BOOST_CHECK(connection.writer.write("c"));
+    BOOST_CHECK(connection.writer.write("d"));
+    BOOST_CHECK_EQUAL(connection.writer.getQueueDepth(), 2u);
+    BOOST_CHECK_EQUAL(connection.writer.getPendingBytes(), (size_t) STUCK_SIZE + 2);
+    BOOST_CHECK_EQUAL(connection.drain(2), "cd");
+}
+
+BOOST_AUTO_TEST_CASE(blockWaitsForRoom) {
+    Connection connection;
+    connection.writer.setCapacity(2);
+    BOOST_CHECK_EQUAL(connection.writer.getOverflowMode(), Writer::BLOCK);
+    connection.stall();
+
+    BOOST_CHECK(connection.writer.write("a"));
+    BOOST_CHECK(connection.writer.write("b"));
+    std::string last("c");
+    bool written = false;
+    boost::thread producer(boost::bind(&blockedWrite, &connection.writer, &last, &written));
+    BOOST_CHECK(!producer.timed_join(boost::posix_time::milliseconds(100)));
+    BOOST_CHECK_EQUAL(connection.writer.getQueueDepth(), 2u);
+
+    // nothing is lost once the peer reads again
+    BOOST_CHECK_EQUAL(connection.drain(3), "abc");
+    producer.join();
+    BOOST_CHECK(written);
+}
+
+BOOST_AUTO_TEST_CASE(stopReleasesBlockedWriters) {
+    Connection connection;
+    connection.writer.setCapacity(1);
+    connection.stall();
+
+    BOOST_CHECK(connection.writer.write("a"));
+    std::string last("b");
+    bool written = true;
+    boost::thread producer(boost::bind(&blockedWrite, &connection.writer, &last, &written));
+    BOOST_CHECK(!producer.timed_join(boost::posix_time::milliseconds(100)));
+    connection.writer.stop();
+    producer.join();
+    BOOST_CHECK(!written);
+    BOOST_CHECK(!connection.writer.write("c"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,316 @@
+/*
+ * SSLSocketTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include "asteriskcpp/net/SSLContext.h"
+#include "asteriskcpp/net/SSLSocket.h"
+#include "asteriskcpp/exceptions/Exception.h"
+
+// openssl s_server and the handshake on a loaded machine
+#define SERVER_START_TIMEOUT 10000
+#define SOCKET_TIMEOUT 10000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    /**
+     * openssl s_server on a loopback port, with a self signed certificate
+     * for localhost. It sends every line back reversed (-rev), or else what
+     * is given to type() and prints what it receives.
+     * Not running if the openssl command is not there.
+     */
+    class TLSServer {
+    public:
+
+        TLSServer(bool reverse = true) :
+        pid(-1), port(0), input(-1), reverse(reverse) {
+            char dirTemplate[] = "/tmp/asteriskcpp-tls-XXXXXX";
+            if (mkdtemp(dirTemplate) == NULL) {
+                return;
+            }
+            dir = dirTemplate;
+
+            std::string command("openssl req -x509 -newkey ec -pkeyopt ec_paramgen_curve:prime256v1 -nodes -days 1"
+                    " -subj /CN=localhost -addext subjectAltName=DNS:localhost"
+                    " -keyout " + path("key.pem") + " -out " + path("cert.pem") + " >/dev/null 2>&1");
+            if (system(command.c_str()) != 0) {
+                return;
+            }
+            start();
+        }
+
+        ~TLSServer() {
+            if (input != -1) {
+                close(input);
+            }
+            if (pid > 0) {
+                kill(pid, SIGTERM);
+                waitpid(pid, NULL, 0);
+            }
+            if (!dir.empty()) {
+                unlink(path("key.pem").c_str());
+                unlink(path("cert.pem").c_str());
+                unlink(path("server.log").c_str());
+                rmdir(dir.c_str());
+            }
+        }
+
+        bool isRunning() const {
+            return (port != 0);
+        }
+
+        unsigned short getPort() const {
+            return (port);
+        }
+
+        std::string path(const std::string& file) const {
+            return (dir + "/" + file);
+        }
+
+        /**
+         * Types line on the console of the server, which sends it, or runs
+         * it as a command: "k" updates the keys and asks the peer to do so.
+         */
+        void type(const std::string& line) {
+            std::string text(line + "\n");
+            BOOST_REQUIRE_EQUAL(write(input, text.data(), text.size()), (ssize_t) text.size());
+        }
+
+        /**
+         * Waits until what the server printed contains text.
+         */
+        bool waitLog(const std::string& text) {
+            for (int waited = 0; waited < SOCKET_TIMEOUT; waited += 10) {
+                std::ifstream in(path("server.log").c_str());
+                std::string log((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                if (log.find(text) != std::string::npos) {
+                    return (true);
+                }
+                boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+            }
+            return (false);
+        }
+
+    private:
+        std::string dir;
+        pid_t pid;
+        unsigned short port;
+        int input;
+        bool reverse;
+
+        void start() {
+            int log = open(path("server.log").c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            if (log == -1) {
+                return;
+            }
+            int console[2];
+            if (pipe(console) == -1) {
+                close(log);
+                return;
+            }
+            std::string cert(path("cert.pem"));
+            std::string key(path("key.pem"));
+            pid = fork();
+            if (pid == 0) {
+                dup2(console[0], STDIN_FILENO);
+                dup2(log, STDOUT_FILENO);
+                dup2(log, STDERR_FILENO);
+                close(console[1]);
+                if (reverse) {
+                    execlp("openssl", "openssl", "s_server", "-accept", "0", "-rev",
+                            "-cert", cert.c_str(), "-key", key.c_str(), (char*) NULL);
+                } else {
+                    execlp("openssl", "openssl", "s_server", "-accept", "0",
+                            "-cert", cert.c_str(), "-key", key.c_str(), (char*) NULL);
+                }
+                _exit(127);
+            }
+            close(log);
+            close(console[0]);
+            input = console[1];
+
+            // the port chosen by the system is in the first line: ACCEPT [::]:port
+            for (int waited = 0; pid > 0 && port == 0 && waited < SERVER_START_TIMEOUT; waited += 10) {
+                std::ifstream in(path("server.log").c_str());
+                std::string line;
+                while (std::getline(in, line)) {
+                    if (line.compare(0, 7, "ACCEPT ") == 0 && line.rfind(':') != std::string::npos) {
+                        port = (unsigned short) atoi(line.c_str() + line.rfind(':') + 1);
+                    }
+                }
+                if (port == 0) {
+                    if (waitpid(pid, NULL, WNOHANG) == pid) {
+                        pid = -1;
+                    }
+                    boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+                }
+            }
+        }
+
+        TLSServer(const TLSServer&);
+        TLSServer& operator=(const TLSServer&);
+    };
+
+    std::string reversed(const std::string& line) {
+        return (std::string(line.rbegin(), line.rend()));
+    }
+
+    /**
+     * Reads from socket until it has the length of expected.
+     */
+    std::string receive(SSLSocket& socket, const std::string& expected) {
+        std::string received;
+        char buffer[4096];
+        while (received.size() < expected.size()) {
+            int length = socket.readEncryptedData(buffer, std::min(sizeof (buffer), expected.size() - received.size()));
+            BOOST_REQUIRE_GT(length, 0);
+            received.append(buffer, length);
+        }
+        return (received);
+    }
+
+    /**
+     * Sends lines of every size through a connection to server and checks
+     * they all come back.
+     */
+    void echo(TLSServer& server, bool kernelTLS) {
+        if (!server.isRunning()) {
+            BOOST_TEST_MESSAGE("openssl s_server could not be started, skipped");
+            return;
+        }
+
+        SSLContext context(server.path("cert.pem"));
+        bool supported = context.setKernelTLS(kernelTLS);
+        BOOST_CHECK_EQUAL(context.isKernelTLS(), kernelTLS && supported);
+
+        SSLSocket socket(&context, IPAddress::resolve("localhost", server.getPort()), "localhost", SOCKET_TIMEOUT);
+        socket.setTimeout(SOCKET_TIMEOUT);
+        BOOST_CHECK(socket.isCertifiedConnection());
+        if (!context.isKernelTLS()) {
+            BOOST_CHECK(!socket.isKernelSend());
+            BOOST_CHECK(!socket.isKernelReceive());
+        }
+        BOOST_TEST_MESSAGE("kernel TLS asked " << kernelTLS << ", send " << socket.isKernelSend() << ", receive " << socket.isKernelReceive());
+
+        // one write per line first, then many lines and many records a write
+        std::vector<std::string> lines;
+        std::string expected;
+        for (int i = 0; i < 300; i++) {
+            std::ostringstream line;
+            line << "line " << i << " " << std::string(i * 3, 'a' + i % 26);
+            lines.push_back(line.str() + "\n");
+            expected += reversed(line.str()) + "\n";
+        }
+        for (size_t i = 0; i < 10; i++) {
+            socket.writeData(lines[i]);
+        }
+        socket.writeData(std::vector<std::string>(lines.begin() + 10, lines.end()));
+
+        BOOST_CHECK(receive(socket, expected) == expected);
+    }
+
+    /**
+     * Connects twice to server, the second connection resumes the session
+     * of the ticket the first one read along with the data.
+     */
+    void resume(TLSServer& server, bool kernelTLS) {
+        if (!server.isRunning()) {
+            BOOST_TEST_MESSAGE("openssl s_server could not be started, skipped");
+            return;
+        }
+
+        SSLContext context(server.path("cert.pem"));
+        context.setKernelTLS(kernelTLS);
+        for (int i = 0; i < 2; i++) {
+            SSLSocket socket(&context, IPAddress::resolve("localhost", server.getPort()), "localhost", SOCKET_TIMEOUT);
+            socket.setTimeout(SOCKET_TIMEOUT);
+            BOOST_CHECK_EQUAL(socket.isSessionReused(), i == 1);
+            socket.writeData(std::string("resumed\n"));
+            BOOST_CHECK_EQUAL(receive(socket, "demuser\n"), "demuser\n");
+        }
+    }
+
+    /**
+     * The server updates its keys and asks for ours to be updated, the data
+     * sent either way afterwards must go through.
+     */
+    void updateKeys(bool kernelTLS) {
+        TLSServer server(false);
+        if (!server.isRunning()) {
+            BOOST_TEST_MESSAGE("openssl s_server could not be started, skipped");
+            return;
+        }
+
+        SSLContext context(server.path("cert.pem"));
+        context.setKernelTLS(kernelTLS);
+        SSLSocket socket(&context, IPAddress::resolve("localhost", server.getPort()), "localhost", SOCKET_TIMEOUT);
+        socket.setTimeout(SOCKET_TIMEOUT);
+        socket.writeData(std::string("before update\n"));
+        BOOST_REQUIRE(server.waitLog("before update"));
+
+        server.type("k");
+        server.type("after update");
+        if (socket.isKernelSend()) {
+            // the kernel cannot take the new keys, the read fails instead of the stream
+            BOOST_CHECK_THROW(receive(socket, "after update\n"), Exception);
+            return;
+        }
+        BOOST_CHECK_EQUAL(receive(socket, "after update\n"), "after update\n");
+
+        socket.writeData(std::string("updated too\n"));
+        BOOST_CHECK(server.waitLog("updated too"));
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(SSLSocketTest)
+
+BOOST_FIXTURE_TEST_CASE(loopbackUserSpaceTLS, TLSServer) {
+    echo(*this, false);
+}
+
+BOOST_FIXTURE_TEST_CASE(loopbackKernelTLS, TLSServer) {
+    echo(*this, true);
+}
+
+BOOST_FIXTURE_TEST_CASE(sessionResumedUserSpaceTLS, TLSServer) {
+    resume(*this, false);
+}
+
+BOOST_FIXTURE_TEST_CASE(sessionResumedKernelTLS, TLSServer) {
+    resume(*this, true);
+}
+
+BOOST_AUTO_TEST_CASE(keyUpdateUserSpaceTLS) {
+    updateKeys(false);
+}
+
+BOOST_AUTO_TEST_CASE(keyUpdateKernelTLS) {
+    updateKeys(true);
+}
+
+BOOST_FIXTURE_TEST_CASE(handshakeRefusedForAnotherName, TLSServer) {
+    if (!isRunning()) {
+        BOOST_TEST_MESSAGE("openssl s_server could not be started, skipped");
+        return;
+    }
+
+    SSLContext context(path("cert.pem"));
+    BOOST_CHECK_THROW(SSLSocket(&context, IPAddress::resolve("localhost", getPort()), "asterisk.example.com", SOCKET_TIMEOUT), Exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+/*
+ * IdTableTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <map>
+#include <cstdlib>
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/structs/IdTable.h"
+
+using namespace asteriskcpp;
+
+namespace {
+
+    /**
+     * Slot of id in a table of size entries, as IdTable computes it.
+     */
+    size_t homeOf(uint64_t id, size_t size) {
+        return ((size_t) ((id * 0x9E3779B97F4A7C15ull) >> 32) & (size - 1));
+    }
+
+    /**
+     * Returns count ids which all want the last slot of a table of size
+     * entries, their probe sequences wrap around to the first slots.
+     */
+    std::vector<uint64_t> collidingIds(size_t count, size_t size) {
+        std::vector<uint64_t> ids;
+        for (uint64_t id = 1; ids.size() < count; id++) {
+            if (homeOf(id, size) == size - 1) {
+                ids.push_back(id);
+            }
+        }
+        return (ids);
+    }
+
+    void checkSame(const IdTable<int>& table, const std::map<uint64_t, int*>& expected, uint64_t maxId) {
+        BOOST_REQUIRE_EQUAL(table.size(), expected.size());
+        for (uint64_t id = 1; id <= maxId; id++) {
+            std::map<uint64_t, int*>::const_iterator it = expected.find(id);
+            BOOST_REQUIRE_EQUAL(table.find(id), (it == expected.end() ? NULL : it->second));
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(IdTableTest)
+
+BOOST_AUTO_TEST_CASE(insertFindErase) {
+    IdTable<int> table;
+    int a = 1;
+    int b = 2;
+    table.insert(7, &a);
+    table.insert(8, &b);
+    BOOST_CHECK_EQUAL(table.size(), 2u);
+    BOOST_CHECK_EQUAL(table.find(7), &a);
+    BOOST_CHECK_EQUAL(table.find(9), (int*) NULL);
+
+    table.insert(7, &b);
+    BOOST_CHECK_EQUAL(table.size(), 2u);
+    BOOST_CHECK_EQUAL(table.find(7), &b);
+
+    BOOST_CHECK_EQUAL(table.erase(7), &b);
+    BOOST_CHECK_EQUAL(table.erase(7), (int*) NULL);
+    BOOST_CHECK_EQUAL(table.find(8), &b);
+    BOOST_CHECK_EQUAL(table.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(eraseShiftsBackAcrossTheEnd) {
+    // capacity 4 is a table of 8 entries, holding up to 4 ids without growing
+    IdTable<int> table(4);
+    std::vector<uint64_t> ids = collidingIds(4, 8);
+    std::vector<int> values(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        table.insert(ids[i], &values[i]);
+    }
+
+    // each erase leaves a hole in the cluster, which must not end the probing
+    for (size_t erased = 0; erased < ids.size(); erased++) {
+        BOOST_REQUIRE_EQUAL(table.erase(ids[erased]), &values[erased]);
+        for (size_t i = 0; i < ids.size(); i++) {
+            BOOST_REQUIRE_EQUAL(table.find(ids[i]), (i <= erased ? NULL : &values[i]));
+        }
+    }
+    BOOST_CHECK(table.empty());
+}
+
+BOOST_AUTO_TEST_CASE(eraseInTheMiddleOfACluster) {
+    IdTable<int> table(4);
+    std::vector<uint64_t> ids = collidingIds(4, 8);
+    std::vector<int> values(ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        table.insert(ids[i], &values[i]);
+    }
+
+    BOOST_REQUIRE_EQUAL(table.erase(ids[1]), &values[1]);
+    BOOST_CHECK_EQUAL(table.find(ids[0]), &values[0]);
+    BOOST_CHECK_EQUAL(table.find(ids[2]), &values[2]);
+    BOOST_CHECK_EQUAL(table.find(ids[3]), &values[3]);
+
+    // the freed entry is used again
+    table.insert(ids[1], &values[1]);
+    for (size_t i = 0; i < ids.size(); i++) {
+        BOOST_CHECK_EQUAL(table.find(ids[i]), &values[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sameAsAMap) {
+    IdTable<int> table(16);
+    std::map<uint64_t, int*> expected;
+    std::vector<int> values(512);
+    srand(12345);
+    // few distinct ids, so inserts and erases keep hitting the same clusters
+    for (int i = 0; i < 20000; i++) {
+        uint64_t id = 1 + rand() % 512;
+        if (rand() % 3 == 0) {
+            std::map<uint64_t, int*>::iterator it = expected.find(id);
+            BOOST_REQUIRE_EQUAL(table.erase(id), (it == expected.end() ? NULL : it->second));
+            if (it != expected.end()) {
+                expected.erase(it);
+            }
+        } else {
+            table.insert(id, &values[id - 1]);
+            expected[id] = &values[id - 1];
+        }
+        if (i % 1000 == 0) {
+            checkSame(table, expected, 512);
+        }
+    }
+    checkSame(table, expected, 512);
+
+    std::vector<std::pair<uint64_t, int*> > items;
+    table.items(items);
+    BOOST_CHECK_EQUAL(items.size(), expected.size());
+    table.clear();
+    BOOST_CHECK(table.empty());
+    BOOST_CHECK_EQUAL(table.find(items.front().first), (int*) NULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
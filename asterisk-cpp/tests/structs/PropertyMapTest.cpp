@@ -0,0 +1,164 @@
+/*
+ * PropertyMapTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+#include "asteriskcpp/structs/PropertyMap.h"
+
+#define READERS 8
+
+using namespace asteriskcpp;
+
+namespace {
+
+    const char FRAME[] = "Event: Newchannel\r\nPrivilege: call,all\r\nChannel: SIP/1-0001\r\n"
+            "Uniqueid: 1000.1\r\nVariable: a=1\r\nVariable: b=2";
+
+    const PropertyKey UNIQUEID("Uniqueid");
+    const PropertyKey EXTEN("Exten");
+
+    /**
+     * Opens up the setters, as the actions do.
+     */
+    class TestMap : public PropertyMap {
+    public:
+
+        TestMap() {
+        }
+
+        TestMap(const std::string& str) :
+        PropertyMap(str) {
+        }
+
+        void set(const std::string& key, const std::string& value) {
+            setProperty(key, value);
+        }
+
+        void clear() {
+            reset();
+        }
+    };
+
+    void readAll(const TestMap* map, const std::string* expected, boost::atomic<int>* bad) {
+        for (int i = 0; i < 1000; i++) {
+            if (map->getProperty("Channel") != "SIP/1-0001" || map->getPropertyView(UNIQUEID) != "1000.1"
+                    || &map->getProperty("Channel") != expected) {
+                (*bad)++;
+            }
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(PropertyMapTest)
+
+BOOST_AUTO_TEST_CASE(parsedFromText) {
+    TestMap map("Response: Success\r\nActionID: 12\r\nmessage: Pong\r\nVariable: a\r\nVariable: b\r\n");
+    BOOST_CHECK_EQUAL(map.getProperty("response"), "Success");
+    BOOST_CHECK_EQUAL(map.getProperty("Message"), "Pong");
+    BOOST_CHECK_EQUAL(map.getProperty<int>("ActionID"), 12);
+    BOOST_CHECK(map.hasProperty("ACTIONID"));
+    BOOST_CHECK(!map.hasProperty("Channel"));
+    BOOST_CHECK_EQUAL(map.getProperty("Channel"), "");
+
+    // the last of a repeated key wins, all of them are kept
+    BOOST_CHECK_EQUAL(map.getProperty("Variable"), "b");
+    std::vector<std::string> variables = map.getProperties("variable");
+    BOOST_REQUIRE_EQUAL(variables.size(), 2u);
+    BOOST_CHECK_EQUAL(variables[0], "a");
+    BOOST_CHECK_EQUAL(variables[1], "b");
+}
+
+BOOST_AUTO_TEST_CASE(attachedFrameParsedWhenRead) {
+    TestMap map;
+    map.attachFrame(SlabView::fromString(FRAME));
+    map.preloadProperty(UNIQUEID);
+
+    // the preloaded key is found without parsing, anything else parses the frame
+    BOOST_CHECK_EQUAL(map.getPropertyView(UNIQUEID), "1000.1");
+    BOOST_CHECK_EQUAL(map.getGetterValue(UNIQUEID), "1000.1");
+    BOOST_CHECK_EQUAL(map.getProperty("Channel"), "SIP/1-0001");
+    BOOST_CHECK_EQUAL(map.getProperty("Uniqueid"), "1000.1");
+    BOOST_CHECK_EQUAL(map.getProperties("Variable").size(), 2u);
+    BOOST_CHECK_EQUAL(map.toString(), std::string(FRAME) + "\r\n\r\n");
+}
+
+BOOST_AUTO_TEST_CASE(concurrentFirstReads) {
+    for (int round = 0; round < 50; round++) {
+        TestMap map;
+        map.attachFrame(SlabView::fromString(FRAME));
+        map.preloadProperty(UNIQUEID);
+
+        // every reader sees the one value materialized, whoever parsed the frame
+        boost::atomic<int> bad(0);
+        const std::string* expected = &map.getProperty("Channel");
+        TestMap copy(map);
+        boost::thread_group threads;
+        for (int i = 0; i < READERS; i++) {
+            threads.create_thread(boost::bind(&readAll, &map, expected, &bad));
+        }
+        threads.join_all();
+        BOOST_REQUIRE_EQUAL(bad.load(), 0);
+        BOOST_CHECK_EQUAL(copy.getProperty("Channel"), "SIP/1-0001");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(editedValues) {
+    TestMap map;
+    map.convertFrame(SlabView::fromString(FRAME));
+    map.set("channel", "SIP/2-0002");
+    map.set("Context", "default");
+    BOOST_CHECK_EQUAL(map.getProperty("Channel"), "SIP/2-0002");
+    BOOST_CHECK_EQUAL(map.getProperty("Context"), "default");
+    // the key keeps its case and place
+    BOOST_CHECK_EQUAL(map.toString(), "Event: Newchannel\r\nPrivilege: call,all\r\nChannel: SIP/2-0002\r\n"
+            "Uniqueid: 1000.1\r\nVariable: a=1\r\nVariable: b=2\r\nContext: default\r\n\r\n");
+
+    // a copy is changed on its own
+    TestMap copy(map);
+    copy.set("Context", "other");
+    BOOST_CHECK_EQUAL(map.getProperty("Context"), "default");
+    BOOST_CHECK_EQUAL(copy.getProperty("Context"), "other");
+}
+
+BOOST_AUTO_TEST_CASE(valuesThatFitAreOverwritten) {
+    TestMap map("Action: Originate\r\nChannel: SIP/100\r\nExten: 200\r\n");
+    const std::string& exten = map.getProperty("Exten");
+    const char* text = map.getPropertyView(EXTEN).data();
+
+    map.set("Exten", "201");
+    BOOST_CHECK_EQUAL(map.getPropertyView(EXTEN).data(), text);
+    map.set("Exten", "2");
+    BOOST_CHECK_EQUAL(map.getPropertyView(EXTEN).data(), text);
+    BOOST_CHECK_EQUAL(map.getPropertyView(EXTEN), "2");
+
+    // the value is materialized again where the getter returned it
+    BOOST_CHECK_EQUAL(&map.getProperty("Exten"), &exten);
+    BOOST_CHECK_EQUAL(exten, "2");
+}
+
+BOOST_AUTO_TEST_CASE(reusedOverAndOver) {
+    TestMap map("Action: Originate\r\nChannel: SIP/100\r\nExten: 200\r\nPriority: 1\r\n");
+    const std::string& channel = map.getProperty("Channel");
+    // values growing and shrinking leave text behind, until it is compacted
+    for (int i = 0; i < 20000; i++) {
+        std::string value(1 + i % 97, 'a' + i % 26);
+        map.set("Channel", value);
+        map.set("Exten", value + value);
+        BOOST_REQUIRE_EQUAL(map.getProperty("Channel"), value);
+        BOOST_REQUIRE_EQUAL(&map.getProperty("Channel"), &channel);
+        BOOST_REQUIRE_EQUAL(map.getPropertyView(EXTEN), value + value);
+        BOOST_REQUIRE_EQUAL(map.getProperty("Priority"), "1");
+    }
+    BOOST_CHECK_EQUAL(map.getProperty("Action"), "Originate");
+
+    map.clear();
+    BOOST_CHECK(!map.hasProperty("Action"));
+    map.set("Action", "Ping");
+    BOOST_CHECK_EQUAL(map.toString(), "Action: Ping\r\n\r\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/*
+ * RingQueueTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+#include "asteriskcpp/structs/RingQueue.h"
+#include "asteriskcpp/structs/BlockingRingQueue.h"
+
+#define PRODUCERS 4
+#define VALUES_PER_PRODUCER 100000
+
+using namespace asteriskcpp;
+
+namespace {
+
+    void produce(RingQueue<int>* queue, int producer) {
+        for (int i = 0; i < VALUES_PER_PRODUCER; i++) {
+            while (!queue->tryPush(producer * VALUES_PER_PRODUCER + i + 1)) {
+                boost::this_thread::yield();
+            }
+        }
+    }
+
+    void consume(RingQueue<int>* queue, std::vector<int>* seen, boost::atomic<int>* left) {
+        int value;
+        while (left->load() > 0) {
+            if (queue->tryPop(value)) {
+                seen->push_back(value);
+                left->fetch_sub(1);
+            } else {
+                boost::this_thread::yield();
+            }
+        }
+    }
+
+    void count(int* calls) {
+        (*calls)++;
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(RingQueueTest)
+
+BOOST_AUTO_TEST_CASE(capacityIsAPowerOf2) {
+    RingQueue<int> queue(5);
+    BOOST_CHECK_EQUAL(queue.capacity(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(fullAndEmpty) {
+    RingQueue<int> queue(4);
+    int value;
+    BOOST_CHECK(!queue.tryPop(value));
+    for (int i = 0; i < 4; i++) {
+        BOOST_CHECK(queue.tryPush(i));
+    }
+    BOOST_CHECK(!queue.tryPush(4));
+    BOOST_CHECK(queue.tryPop(value));
+    BOOST_CHECK_EQUAL(value, 0);
+    BOOST_CHECK(queue.tryPush(4));
+}
+
+BOOST_AUTO_TEST_CASE(orderKeptAcrossWraparound) {
+    RingQueue<int> queue(4);
+    int pushed = 0;
+    int popped = 0;
+    int value;
+    // the indexes go around the cells many times, at every fill level
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i <= round % 4; i++) {
+            BOOST_REQUIRE(queue.tryPush(pushed++));
+        }
+        while (queue.tryPop(value)) {
+            BOOST_REQUIRE_EQUAL(value, popped++);
+        }
+    }
+    BOOST_CHECK_EQUAL(pushed, popped);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentProducersAndConsumers) {
+    RingQueue<int> queue(64);
+    boost::atomic<int> left(PRODUCERS * VALUES_PER_PRODUCER);
+    std::vector<std::vector<int> > seen(PRODUCERS);
+    boost::thread_group threads;
+    for (int i = 0; i < PRODUCERS; i++) {
+        threads.create_thread(boost::bind(&produce, &queue, i));
+        threads.create_thread(boost::bind(&consume, &queue, &seen[i], &left));
+    }
+    threads.join_all();
+
+    // every value once, in the order of its producer for each consumer
+    std::vector<bool> found(PRODUCERS * VALUES_PER_PRODUCER + 1, false);
+    for (int c = 0; c < PRODUCERS; c++) {
+        std::vector<int> last(PRODUCERS, 0);
+        for (std::vector<int>::const_iterator it = seen[c].begin(); it != seen[c].end(); ++it) {
+            BOOST_REQUIRE(!found[*it]);
+            found[*it] = true;
+            int producer = (*it - 1) / VALUES_PER_PRODUCER;
+            BOOST_REQUIRE_LT(last[producer], *it);
+            last[producer] = *it;
+        }
+    }
+    BOOST_CHECK(std::find(found.begin() + 1, found.end(), false) == found.end());
+}
+
+BOOST_AUTO_TEST_CASE(blockingTryPutCalledBackWhenRoomIsMade) {
+    BlockingRingQueue<int> queue(2);
+    int calls = 0;
+    BOOST_CHECK(queue.tryPut(1));
+    BOOST_CHECK(queue.tryPut(2, boost::bind(&count, &calls)));
+    BOOST_CHECK(!queue.tryPut(3, boost::bind(&count, &calls)));
+    BOOST_CHECK_EQUAL(calls, 0);
+
+    int value;
+    BOOST_CHECK(queue.tryTake(value));
+    BOOST_CHECK_EQUAL(value, 1);
+    BOOST_CHECK_EQUAL(calls, 1);
+    BOOST_CHECK(queue.tryPut(3));
+
+    // once called, a callback is forgotten
+    std::vector<int> batch;
+    queue.take(batch, 10);
+    BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+    BOOST_CHECK_EQUAL(batch[0], 2);
+    BOOST_CHECK_EQUAL(batch[1], 3);
+    BOOST_CHECK_EQUAL(calls, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
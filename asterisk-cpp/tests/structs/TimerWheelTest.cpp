@@ -0,0 +1,156 @@
+/*
+ * TimerWheelTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include "asteriskcpp/structs/TimerWheel.h"
+
+#define TICK 10
+#define SLOTS 8
+// one turn of the wheel
+#define TURN (TICK * SLOTS)
+
+using namespace asteriskcpp;
+
+namespace {
+
+    struct TestTimer : public TimerWheel::Timer {
+        uint64_t expiredAt;
+
+        TestTimer() :
+        expiredAt(0) {
+        }
+    };
+
+    /**
+     * Advances wheel one millisecond at a time from start to stop, noting
+     * when each timer expires.
+     */
+    void run(TimerWheel& wheel, uint64_t start, uint64_t stop) {
+        std::vector<TimerWheel::Timer*> expired;
+        for (uint64_t now = start; now <= stop; now++) {
+            expired.clear();
+            wheel.advance(now, expired);
+            for (std::vector<TimerWheel::Timer*>::iterator it = expired.begin(); it != expired.end(); ++it) {
+                BOOST_REQUIRE_EQUAL(static_cast<TestTimer*> (*it)->expiredAt, 0u);
+                static_cast<TestTimer*> (*it)->expiredAt = now;
+            }
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(TimerWheelTest)
+
+BOOST_AUTO_TEST_CASE(expiresWithinATick) {
+    TimerWheel wheel(TICK, SLOTS);
+    uint64_t start = TimerWheel::now();
+    unsigned int timeouts[] = { 0, 1, TICK - 1, TICK, TICK + 1, 35, TURN - 1 };
+    size_t count = sizeof (timeouts) / sizeof (timeouts[0]);
+    std::vector<TestTimer> timers(count);
+    for (size_t i = 0; i < count; i++) {
+        wheel.schedule(&timers[i], timeouts[i], start);
+    }
+    BOOST_CHECK_EQUAL(wheel.size(), count);
+
+    run(wheel, start, start + 2 * TURN);
+    BOOST_CHECK_EQUAL(wheel.size(), 0u);
+    for (size_t i = 0; i < count; i++) {
+        BOOST_CHECK_GE(timers[i].expiredAt, start + timeouts[i]);
+        BOOST_CHECK_LT(timers[i].expiredAt, start + timeouts[i] + TICK);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(laterTurnsWaitInTheirSlot) {
+    TimerWheel wheel(TICK, SLOTS);
+    uint64_t start = TimerWheel::now();
+    // all in the same slot, one, two and five turns apart
+    unsigned int timeouts[] = { 25, 25 + TURN, 25 + 2 * TURN, 25 + 5 * TURN, 12345 };
+    size_t count = sizeof (timeouts) / sizeof (timeouts[0]);
+    std::vector<TestTimer> timers(count);
+    for (size_t i = 0; i < count; i++) {
+        wheel.schedule(&timers[i], timeouts[i], start);
+    }
+
+    run(wheel, start, start + 13000);
+    for (size_t i = 0; i < count; i++) {
+        BOOST_CHECK_GE(timers[i].expiredAt, start + timeouts[i]);
+        BOOST_CHECK_LT(timers[i].expiredAt, start + timeouts[i] + TICK);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(longPauseExpiresOnlyWhatIsDue) {
+    TimerWheel wheel(TICK, SLOTS);
+    uint64_t start = TimerWheel::now();
+    std::vector<TestTimer> timers(50);
+    for (size_t i = 0; i < timers.size(); i++) {
+        wheel.schedule(&timers[i], (unsigned int) (i * 37), start);
+    }
+
+    // many turns at once
+    std::vector<TimerWheel::Timer*> expired;
+    wheel.advance(start + 1000, expired);
+    for (size_t i = 0; i < timers.size(); i++) {
+        bool due = (i * 37 <= 1000);
+        BOOST_CHECK_EQUAL(std::find(expired.begin(), expired.end(), &timers[i]) != expired.end(), due);
+        BOOST_CHECK_EQUAL(timers[i].isScheduled(), !due);
+    }
+
+    expired.clear();
+    wheel.advance(start + 5000, expired);
+    BOOST_CHECK_EQUAL(expired.size() + 1000 / 37 + 1, timers.size());
+    BOOST_CHECK_EQUAL(wheel.size(), 0u);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), UINT64_MAX);
+}
+
+BOOST_AUTO_TEST_CASE(cancelledAndRescheduled) {
+    TimerWheel wheel(TICK, SLOTS);
+    uint64_t start = TimerWheel::now();
+    TestTimer cancelled;
+    TestTimer moved;
+    wheel.schedule(&cancelled, 30, start);
+    wheel.schedule(&moved, 30, start);
+    wheel.cancel(&cancelled);
+    BOOST_CHECK(!cancelled.isScheduled());
+    wheel.schedule(&moved, 200, start);
+    BOOST_CHECK_EQUAL(wheel.size(), 1u);
+
+    run(wheel, start, start + 300);
+    BOOST_CHECK_EQUAL(cancelled.expiredAt, 0u);
+    BOOST_CHECK_GE(moved.expiredAt, start + 200);
+    BOOST_CHECK_LT(moved.expiredAt, start + 200 + TICK);
+}
+
+BOOST_AUTO_TEST_CASE(nextTickIsTheEarliestDeadline) {
+    TimerWheel wheel(TICK, SLOTS);
+    uint64_t start = TimerWheel::now();
+    uint64_t first = start / TICK * TICK;
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), UINT64_MAX);
+
+    TestTimer late;
+    TestTimer later;
+    TestTimer soon;
+    // same slot as soon, a turn after
+    wheel.schedule(&later, 30 + TURN, first);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), first + 30 + TURN);
+    wheel.schedule(&late, 200, first);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), first + TURN + 30);
+    wheel.schedule(&soon, 25, first);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), first + 30);
+
+    wheel.cancel(&soon);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), first + 30 + TURN);
+
+    // nothing due in between
+    std::vector<TimerWheel::Timer*> expired;
+    wheel.advance(wheel.getNextTick() - 1, expired);
+    BOOST_CHECK(expired.empty());
+    wheel.advance(wheel.getNextTick(), expired);
+    BOOST_CHECK_EQUAL(expired.size(), 1u);
+    BOOST_CHECK_EQUAL(wheel.getNextTick(), first + 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()